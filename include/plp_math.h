@@ -229,6 +229,120 @@ typedef struct {
     int32_t *pRes;       // pointer to result vector
 } plp_conv_instance_i8;
 
+/** -------------------------------------------------------
+    @brief Instance structure for parallel 8-bit integer correlation.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int8_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;    // number of samples in the second vector
+    uint8_t nPE;         // number of processing units
+    int32_t *pRes;       // pointer to result vector
+} plp_correlate_instance_i8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel 16-bit integer correlation.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int16_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;     // number of samples in the second vector
+    uint8_t nPE;          // number of processing units
+    int32_t *pRes;        // pointer to result vector
+} plp_correlate_instance_i16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel 32-bit integer correlation.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int32_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;     // number of samples in the second vector
+    uint8_t nPE;          // number of processing units
+    int32_t *pRes;        // pointer to result vector
+} plp_correlate_instance_i32;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel 8-bit fixed point correlation.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int8_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int8_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;    // number of samples in the second vector
+    uint32_t fracBits;   // number of fractional bits
+    uint8_t nPE;         // number of processing units
+    int32_t *pRes;       // pointer to result vector
+} plp_correlate_instance_q8;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel 16-bit fixed point correlation.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int16_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int16_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;     // number of samples in the second vector
+    uint32_t fracBits;    // number of fractional bits
+    uint8_t nPE;          // number of processing units
+    int32_t *pRes;        // pointer to result vector
+} plp_correlate_instance_q16;
+
+/** -------------------------------------------------------
+    @brief Instance structure for parallel 32-bit fixed point correlation.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  srcALen    length of the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  srcBLen    length of the second input vector
+    @param[in]  fracBits   number of fractional bits
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       output result returned here
+*/
+typedef struct {
+    const int32_t *pSrcA; // pointer to the first vector
+    uint32_t srcALen;
+    const int32_t *pSrcB; // pointer to the second vector
+    uint32_t srcBLen;     // number of samples in the second vector
+    uint32_t fracBits;    // number of fractional bits
+    uint8_t nPE;          // number of processing units
+    int32_t *pRes;        // pointer to result vector
+} plp_correlate_instance_q32;
+
 /** -------------------------------------------------------
     @brief Instance structure for basic integer convolution.
     @param[in]  addOffset
@@ -249,539 +363,1116 @@ typedef struct {
     uint8_t coresPerVector;
 } plp_conv_tree_add_instance;
 
-/**
- * @brief Instance structure for the fixed-point CFFT/CIFFT function.
- * @param[in]   fftLen              length of the FFT
- * @param[in]   pTwiddle            points to the Twiddle factor table
- * @param[in]   pBitRevTable        points to the bit reversal table
- * @param[in]   bitRevTableLength   bit reversal table length
- */
+/** -------------------------------------------------------
+    @struct plp_fir_instance_i8
+    @brief Instance structure for the 8-bit integer FIR filter
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients in time-reversed order, of length numTaps
+    @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+*/
 typedef struct {
-    uint16_t fftLen;             /*< length of the FFT. */
-    const int16_t *pTwiddle;     /*< points to the Twiddle factor table. */
-    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
-    uint16_t bitRevLength;       /*< bit reversal table length. */
-} plp_cfft_instance_q16;
+    uint32_t numTaps;
+    const int8_t *pCoeffs;
+    int8_t *pState;
+} plp_fir_instance_i8;
 
-/**
- * @brief Instance structure for the parallel CFFT Q16
- * @param[in]       fft_struct          cfft_q16 struct
- * @param[in/out]   p1                  points to the complex data buffer of size <code>2*fftLen</code>.
- * Processing occurs in-place.
- * @param[in]       ifftFlag            flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
- * transform.
- * @param[in]       bitReverseFlag      flag that enables (bitReverseFlag=1) of disables
- * (bitReverseFlag=0) bit reversal of output.
- * @param[in]       deciPoint           decimal point for right shift
- * @param[in]       nPE                 number of cores to use
- */
+/** -------------------------------------------------------
+    @struct plp_fir_instance_i8_parallel
+    @brief Instance structure for the 8-bit integer FIR filter (parallel version)
+    @param[in]  S          points to the instance of the FIR filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    plp_cfft_instance_q16 *S;
-    int16_t *p1;
-    uint8_t ifftFlag;
-    uint8_t bitReverseFlag;
-    uint32_t deciPoint;
+    const plp_fir_instance_i8 *S;
+    const int8_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-} plp_cfft_instance_q16_parallel;
-
-/**
- * @brief Instance structure for the fixed-point CFFT/CIFFT function.
- * @param[in]   fftLen              length of the FFT
- * @param[in]   pTwiddle            points to the Twiddle factor table
- * @param[in]   pBitRevTable        points to the bit reversal table
- * @param[in]   bitRevTableLength   bit reversal table length
- */
-typedef struct {
-    uint16_t fftLen;             /*< length of the FFT. */
-    const int32_t *pTwiddle;     /*< points to the Twiddle factor table. */
-    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
-    uint16_t bitRevLength;       /*< bit reversal table length. */
-} plp_cfft_instance_q32;
+    int32_t *pDst;
+} plp_fir_instance_i8_parallel;
 
 /** -------------------------------------------------------
-    @struct plp_fft_instance_f32
-    @brief Instance structure for floating-point FFT
-    @param[in]  length data length of the FFT
-    @param[in]  bitReverseFlag  flag that enables (bitReverseFlagR=1) or disables
-    (bitReverseFlagR=0) bit reversal of output
-    @param[in]  pTwiddleFactors pointer to the twiddle factors.
-    These values must be computed using this formula:
-    \f$W_N^k =   e^{-j \frac{\pi}{N} k}\f$,
-    where \f$N\f$ is the data length and \f$k\f$ is the index.
-    The user must provide \f$\frac{N}{2}\f$ values (\f$k = 0 .. \frac{N}{2}-1\f$).
-    @param[in]  pBitReverseLUT  pointer to the lookup table used for the bit reversal of output.
-    This table must include \f$N\f$ elements in the range \f$0 .. N-1\f$,
-    where each location \f$k\f$ contains the value \f$bitreverse(k)\f$.
+    @struct plp_fir_instance_i16
+    @brief Instance structure for the 16-bit integer FIR filter
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients in time-reversed order, of length numTaps
+    @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
 */
 typedef struct {
-    uint32_t FFTLength;
-    uint8_t bitReverseFlag;
-    const float32_t *pTwiddleFactors;
-    const uint16_t *pBitReverseLUT;
-} plp_fft_instance_f32;
+    uint32_t numTaps;
+    const int16_t *pCoeffs;
+    int16_t *pState;
+} plp_fir_instance_i16;
 
 /** -------------------------------------------------------
-    @struct plp_fft_instance_f32_parallel
-    @brief Instance structure for floating-point FFT (parallel version)
-    @param[in]  S         pointer to a plp_fft_instance_f32 data structure (FFT parameters)
-    @param[in]  pSrc      pointer to the input data buffer
-    @param[in]  nPE       number of cores
-    @param[out] pDst      pointer to the output data buffer
+    @struct plp_fir_instance_i16_parallel
+    @brief Instance structure for the 16-bit integer FIR filter (parallel version)
+    @param[in]  S          points to the instance of the FIR filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
 */
 typedef struct {
-    plp_fft_instance_f32 *S;
-    const float32_t *pSrc;
-    const uint32_t nPE;
-    float32_t *pDst;
-} plp_fft_instance_f32_parallel;
+    const plp_fir_instance_i16 *S;
+    const int16_t *pSrc;
+    uint32_t blockSize;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_fir_instance_i16_parallel;
 
 /** -------------------------------------------------------
-    @struct Complex_type_f32
-    @brief Helper type to represent complex values with float32 components.
-    @param  re  Real part
-    @param  im  Imaginary part
+    @struct plp_fir_instance_q16
+    @brief Instance structure for the 16-bit fixed point FIR filter
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients in time-reversed order, of length numTaps
+    @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+    @param[in]  fracBits   number of fractional bits of the coefficients
 */
 typedef struct {
-    float32_t re;
-    float32_t im;
-} Complex_type_f32;
+    uint32_t numTaps;
+    const int16_t *pCoeffs;
+    int16_t *pState;
+    uint32_t fracBits;
+} plp_fir_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
- */
+    @struct plp_fir_instance_q16_parallel
+    @brief Instance structure for the 16-bit fixed point FIR filter (parallel version)
+    @param[in]  S          points to the instance of the FIR filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const plp_fir_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i8;
+    int16_t *pDst;
+} plp_fir_instance_q16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
- */
+    @struct plp_fir_instance_q32
+    @brief Instance structure for the 32-bit fixed point FIR filter
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients in time-reversed order, of length numTaps
+    @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+    @param[in]  fracBits   number of fractional bits of the coefficients
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i16;
+    uint32_t numTaps;
+    const int32_t *pCoeffs;
+    int32_t *pState;
+    uint32_t fracBits;
+} plp_fir_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix multiplication.
- */
+    @struct plp_fir_instance_q32_parallel
+    @brief Instance structure for the 32-bit fixed point FIR filter (parallel version)
+    @param[in]  S          points to the instance of the FIR filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const plp_fir_instance_q32 *S;
+    const int32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_i32;
+    int32_t *pDst;
+} plp_fir_instance_q32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix multiplication.
- */
+    @struct plp_fir_instance_f32
+    @brief Instance structure for the 32-bit floating point FIR filter
+    @param[in]  numTaps    number of filter coefficients
+    @param[in]  pCoeffs    points to the coefficients in time-reversed order, of length numTaps
+    @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    float *__restrict__ pDstC;
-} plp_mat_mult_instance_f32;
+    uint32_t numTaps;
+    const float32_t *pCoeffs;
+    float32_t *pState;
+} plp_fir_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel matrix multiplication.
- */
+    @struct plp_fir_instance_f32_parallel
+    @brief Instance structure for the 32-bit floating point FIR filter (parallel version)
+    @param[in]  S          points to the instance of the FIR filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const plp_fir_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int8_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q8;
+    float32_t *pDst;
+} plp_fir_instance_f32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
- */
+    @struct plp_biquad_cascade_df1_instance_q16
+    @brief Instance structure for the 16-bit fixed point biquad cascade filter (DF1)
+    @param[in]  numStages  number of second order stages
+    @param[in]  pState     points to the state buffer of length 4 * numStages
+    @param[in]  pCoeffs    points to the coefficients, 6 per stage
+    @param[in]  fracBits   number of fractional bits of the coefficients
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
-    uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q16;
+    uint32_t numStages;
+    int16_t *pState;
+    const int16_t *pCoeffs;
+    uint32_t fracBits;
+} plp_biquad_cascade_df1_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
- */
+    @struct plp_biquad_cascade_df1_instance_q16_parallel
+    @brief Instance structure for the parallel 16-bit fixed point biquad cascade filter
+    @param[in]  S          points to the array of nChannels filter instances
+    @param[in]  nChannels  number of independent channels
+    @param[in]  pSrc       points to the input samples, blockSize per channel
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the output samples, blockSize per channel
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const plp_biquad_cascade_df1_instance_q16 *S;
+    uint32_t nChannels;
+    const int16_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_instance_q32;
+    int16_t *pDst;
+} plp_biquad_cascade_df1_instance_q16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
- */
+    @struct plp_biquad_cascade_df1_instance_q32
+    @brief Instance structure for the 32-bit fixed point biquad cascade filter (DF1)
+    @param[in]  numStages  number of second order stages
+    @param[in]  pState     points to the state buffer of length 4 * numStages
+    @param[in]  pCoeffs    points to the coefficients, 5 per stage
+    @param[in]  fracBits   number of fractional bits of the coefficients
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i8;
+    uint32_t numStages;
+    int32_t *pState;
+    const int32_t *pCoeffs;
+    uint32_t fracBits;
+} plp_biquad_cascade_df1_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
- */
+    @struct plp_biquad_cascade_df1_instance_q32_parallel
+    @brief Instance structure for the parallel 32-bit fixed point biquad cascade filter
+    @param[in]  S          points to the array of nChannels filter instances
+    @param[in]  nChannels  number of independent channels
+    @param[in]  pSrc       points to the input samples, blockSize per channel
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the output samples, blockSize per channel
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const plp_biquad_cascade_df1_instance_q32 *S;
+    uint32_t nChannels;
+    const int32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i16;
+    int32_t *pDst;
+} plp_biquad_cascade_df1_instance_q32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex matrix matrix multiplication.
- */
+    @struct plp_biquad_cascade_df2T_instance_f32
+    @brief Instance structure for the 32-bit floating point biquad cascade filter (DF2T)
+    @param[in]  numStages  number of second order stages
+    @param[in]  pState     points to the state buffer of length 2 * numStages
+    @param[in]  pCoeffs    points to the coefficients, 5 per stage
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_i32;
+    uint32_t numStages;
+    float32_t *pState;
+    const float32_t *pCoeffs;
+} plp_biquad_cascade_df2T_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
- */
+    @struct plp_biquad_cascade_df2T_instance_f32_parallel
+    @brief Instance structure for the parallel 32-bit floating point biquad cascade filter
+    @param[in]  S          points to the array of nChannels filter instances
+    @param[in]  nChannels  number of independent channels
+    @param[in]  pSrc       points to the input samples, blockSize per channel
+    @param[in]  blockSize  number of samples per channel
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the output samples, blockSize per channel
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
+    const plp_biquad_cascade_df2T_instance_f32 *S;
+    uint32_t nChannels;
+    const float32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    float *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_f32;
+    float32_t *pDst;
+} plp_biquad_cascade_df2T_instance_f32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel complex matrix matrix multiplication.
- */
+    @struct plp_fir_decimate_instance_q16
+    @brief Instance structure for the 16-bit fixed point FIR decimation filter
+    @param[in]  M            decimation factor
+    @param[in]  numTaps      number of filter coefficients
+    @param[in]  pCoeffs      points to the coefficients in time-reversed order
+    @param[in]  pState       points to the state buffer of length numTaps + blockSize - 1
+    @param[in]  fracBits     number of fractional bits of the coefficients
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
     uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
-    uint32_t nPE;
-    int8_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q8;
+    uint32_t numTaps;
+    const int16_t *pCoeffs;
+    int16_t *pState;
+    uint32_t fracBits;
+} plp_fir_decimate_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel complex matrix matrix multiplication.
- */
+    @struct plp_fir_decimate_instance_q16_parallel
+    @brief Instance structure for the parallel 16-bit fixed point FIR decimation filter
+    @param[in]  S          points to the instance of the filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of input samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
+    const plp_fir_decimate_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int16_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q16;
+    int16_t *pDst;
+} plp_fir_decimate_instance_q16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel complex matrix matrix multiplication.
- */
+    @struct plp_fir_decimate_instance_q32
+    @brief Instance structure for the 32-bit fixed point FIR decimation filter
+    @param[in]  M            decimation factor
+    @param[in]  numTaps      number of filter coefficients
+    @param[in]  pCoeffs      points to the coefficients in time-reversed order
+    @param[in]  pState       points to the state buffer of length numTaps + blockSize - 1
+    @param[in]  fracBits     number of fractional bits of the coefficients
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
     uint32_t M;
-    uint32_t N;
-    uint32_t O;
-    uint32_t shift;
-    uint32_t nPE;
-    int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_instance_q32;
+    uint32_t numTaps;
+    const int32_t *pCoeffs;
+    int32_t *pState;
+    uint32_t fracBits;
+} plp_fir_decimate_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
- */
+    @struct plp_fir_decimate_instance_q32_parallel
+    @brief Instance structure for the parallel 32-bit fixed point FIR decimation filter
+    @param[in]  S          points to the instance of the filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of input samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const plp_fir_decimate_instance_q32 *S;
+    const int32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_add_instance_i8;
+    int32_t *pDst;
+} plp_fir_decimate_instance_q32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
- */
+    @struct plp_fir_decimate_instance_f32
+    @brief Instance structure for the 32-bit floating point FIR decimation filter
+    @param[in]  M            decimation factor
+    @param[in]  numTaps      number of filter coefficients
+    @param[in]  pCoeffs      points to the coefficients in time-reversed order
+    @param[in]  pState       points to the state buffer of length numTaps + blockSize - 1
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
     uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_add_instance_i16;
+    uint32_t numTaps;
+    const float32_t *pCoeffs;
+    float32_t *pState;
+} plp_fir_decimate_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix addition.
- */
+    @struct plp_fir_decimate_instance_f32_parallel
+    @brief Instance structure for the parallel 32-bit floating point FIR decimation filter
+    @param[in]  S          points to the instance of the filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of input samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const plp_fir_decimate_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_add_instance_i32;
+    float32_t *pDst;
+} plp_fir_decimate_instance_f32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix addition.
- */
+    @struct plp_fir_interpolate_instance_q16
+    @brief Instance structure for the 16-bit fixed point FIR interpolation filter
+    @param[in]  L            interpolation factor
+    @param[in]  phaseLength  number of coefficients per phase, numTaps / L
+    @param[in]  pCoeffs      points to the coefficients in time-reversed order
+    @param[in]  pState       points to the state buffer of length numTaps / L + blockSize - 1
+    @param[in]  fracBits     number of fractional bits of the coefficients
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_add_instance_f32;
+    uint32_t L;
+    uint32_t phaseLength;
+    const int16_t *pCoeffs;
+    int16_t *pState;
+    uint32_t fracBits;
+} plp_fir_interpolate_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
- */
+    @struct plp_fir_interpolate_instance_q16_parallel
+    @brief Instance structure for the parallel 16-bit fixed point FIR interpolation filter
+    @param[in]  S          points to the instance of the filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of input samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrcA;
-    const int8_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const plp_fir_interpolate_instance_q16 *S;
+    const int16_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_sub_instance_i8;
+    int16_t *pDst;
+} plp_fir_interpolate_instance_q16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
- */
+    @struct plp_fir_interpolate_instance_q32
+    @brief Instance structure for the 32-bit fixed point FIR interpolation filter
+    @param[in]  L            interpolation factor
+    @param[in]  phaseLength  number of coefficients per phase, numTaps / L
+    @param[in]  pCoeffs      points to the coefficients in time-reversed order
+    @param[in]  pState       points to the state buffer of length numTaps / L + blockSize - 1
+    @param[in]  fracBits     number of fractional bits of the coefficients
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrcA;
-    const int16_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_sub_instance_i16;
+    uint32_t L;
+    uint32_t phaseLength;
+    const int32_t *pCoeffs;
+    int32_t *pState;
+    uint32_t fracBits;
+} plp_fir_interpolate_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix subtraction.
- */
+    @struct plp_fir_interpolate_instance_q32_parallel
+    @brief Instance structure for the parallel 32-bit fixed point FIR interpolation filter
+    @param[in]  S          points to the instance of the filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of input samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrcA;
-    const int32_t *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
+    const plp_fir_interpolate_instance_q32 *S;
+    const int32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_sub_instance_i32;
+    int32_t *pDst;
+} plp_fir_interpolate_instance_q32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix subtraction.
- */
+    @struct plp_fir_interpolate_instance_f32
+    @brief Instance structure for the 32-bit floating point FIR interpolation filter
+    @param[in]  L            interpolation factor
+    @param[in]  phaseLength  number of coefficients per phase, numTaps / L
+    @param[in]  pCoeffs      points to the coefficients in time-reversed order
+    @param[in]  pState       points to the state buffer of length numTaps / L + blockSize - 1
+*/
 typedef struct {
-    const float *__restrict__ pSrcA;
-    const float *__restrict__ pSrcB;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_sub_instance_f32;
+    uint32_t L;
+    uint32_t phaseLength;
+    const float32_t *pCoeffs;
+    float32_t *pState;
+} plp_fir_interpolate_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
- */
+    @struct plp_fir_interpolate_instance_f32_parallel
+    @brief Instance structure for the parallel 32-bit floating point FIR interpolation filter
+    @param[in]  S          points to the instance of the filter
+    @param[in]  pSrc       points to the block of input samples
+    @param[in]  blockSize  number of input samples to process
+    @param[in]  nPE        number of cores
+    @param[out] pDst       points to the block of output samples
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int8_t scaleFactor;
-    int32_t shift;
+    const plp_fir_interpolate_instance_f32 *S;
+    const float32_t *pSrc;
+    uint32_t blockSize;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_scale_instance_i8;
+    float32_t *pDst;
+} plp_fir_interpolate_instance_f32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
- */
+    @struct plp_lms_instance_q16
+    @brief Instance structure for the 16-bit fixed point LMS filter
+    @param[in]     numTaps  number of filter coefficients
+    @param[in/out] pState   points to the state buffer of length numTaps + blockSize - 1
+    @param[in/out] pCoeffs  points to the coefficients in time-reversed order
+    @param[in]     mu       step size
+    @param[in]     fracBits number of fractional bits of all values
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int16_t scaleFactor;
-    int32_t shift;
-    uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_scale_instance_i16;
+    uint32_t numTaps;
+    int16_t *pState;
+    int16_t *pCoeffs;
+    int16_t mu;
+    uint32_t fracBits;
+} plp_lms_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix scale.
- */
+    @struct plp_lms_instance_q32
+    @brief Instance structure for the 32-bit fixed point LMS filter
+    @param[in]     numTaps  number of filter coefficients
+    @param[in/out] pState   points to the state buffer of length numTaps + blockSize - 1
+    @param[in/out] pCoeffs  points to the coefficients in time-reversed order
+    @param[in]     mu       step size
+    @param[in]     fracBits number of fractional bits of all values
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    int32_t scaleFactor;
-    int32_t shift;
-    uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_scale_instance_i32;
+    uint32_t numTaps;
+    int32_t *pState;
+    int32_t *pCoeffs;
+    int32_t mu;
+    uint32_t fracBits;
+} plp_lms_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel matrix scale.
- */
+    @struct plp_lms_instance_f32
+    @brief Instance structure for the 32-bit floating point LMS filter
+    @param[in]     numTaps  number of filter coefficients
+    @param[in/out] pState   points to the state buffer of length numTaps + blockSize - 1
+    @param[in/out] pCoeffs  points to the coefficients in time-reversed order
+    @param[in]     mu       step size
+*/
 typedef struct {
-    const float *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    float scaleFactor;
-    uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_scale_instance_f32;
+    uint32_t numTaps;
+    float32_t *pState;
+    float32_t *pCoeffs;
+    float32_t mu;
+} plp_lms_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_lms_norm_instance_q16
+    @brief Instance structure for the 16-bit fixed point normalized LMS filter
+    @param[in]     numTaps  number of filter coefficients
+    @param[in/out] pState   points to the state buffer of length numTaps + blockSize - 1
+    @param[in/out] pCoeffs  points to the coefficients in time-reversed order
+    @param[in]     mu       step size
+    @param[in]     fracBits number of fractional bits of all values
+    @param[in/out] energy   energy of the samples in the delay line
+    @param[in/out] x0       oldest sample of the delay line
+*/
+typedef struct {
+    uint32_t numTaps;
+    int16_t *pState;
+    int16_t *pCoeffs;
+    int16_t mu;
+    uint32_t fracBits;
+    int32_t energy;
+    int16_t x0;
+} plp_lms_norm_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
- */
+    @struct plp_lms_norm_instance_q32
+    @brief Instance structure for the 32-bit fixed point normalized LMS filter
+    @param[in]     numTaps  number of filter coefficients
+    @param[in/out] pState   points to the state buffer of length numTaps + blockSize - 1
+    @param[in/out] pCoeffs  points to the coefficients in time-reversed order
+    @param[in]     mu       step size
+    @param[in]     fracBits number of fractional bits of all values
+    @param[in/out] energy   energy of the samples in the delay line
+    @param[in/out] x0       oldest sample of the delay line
+*/
 typedef struct {
-    const int8_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_trans_instance_i8;
+    uint32_t numTaps;
+    int32_t *pState;
+    int32_t *pCoeffs;
+    int32_t mu;
+    uint32_t fracBits;
+    int64_t energy;
+    int32_t x0;
+} plp_lms_norm_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
- */
+    @struct plp_lms_norm_instance_f32
+    @brief Instance structure for the 32-bit floating point normalized LMS filter
+    @param[in]     numTaps  number of filter coefficients
+    @param[in/out] pState   points to the state buffer of length numTaps + blockSize - 1
+    @param[in/out] pCoeffs  points to the coefficients in time-reversed order
+    @param[in]     mu       step size
+    @param[in/out] energy   energy of the samples in the delay line
+    @param[in/out] x0       oldest sample of the delay line
+*/
 typedef struct {
-    const int16_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
-    uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_trans_instance_i16;
+    uint32_t numTaps;
+    float32_t *pState;
+    float32_t *pCoeffs;
+    float32_t mu;
+    float32_t energy;
+    float32_t x0;
+} plp_lms_norm_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel matrix transpose.
- */
+    @struct plp_conv2d_instance_i8
+    @brief Instance structure for the 8-bit integer parallel tiled 2D convolution
+*/
 typedef struct {
-    const int32_t *__restrict__ pSrc;
-    uint32_t M;
-    uint32_t N;
+    const int8_t *__restrict__ pSrc; // input image, in L2
+    uint32_t srcRows;
+    uint32_t srcCols;
+    uint32_t kerRows;
+    uint32_t kerCols;
+    uint32_t tileRows; // maximal number of rows of an output tile
+    uint32_t tileCols; // maximal number of columns of an output tile
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_trans_instance_i32;
+    int8_t *pBufSrc;              // two L1 buffers of the input tiles including the halo
+    int8_t *pBufKer;              // filter kernel, in L1
+    int32_t *pBufDst;             // two L1 buffers of the output tiles
+    hal_cl_dma_cmd_t dmaLoad[2];  // transfers of the input tiles into pBufSrc
+    hal_cl_dma_cmd_t dmaStore[2]; // transfers of the output tiles back to L2
+    int32_t *__restrict__ pDst;   // output image, in L2
+} plp_conv2d_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
- */
+    @struct plp_conv2d_instance_i16
+    @brief Instance structure for the 16-bit integer parallel tiled 2D convolution
+*/
 typedef struct {
-    uint32_t N;
+    const int16_t *__restrict__ pSrc; // input image, in L2
+    uint32_t srcRows;
+    uint32_t srcCols;
+    uint32_t kerRows;
+    uint32_t kerCols;
+    uint32_t tileRows; // maximal number of rows of an output tile
+    uint32_t tileCols; // maximal number of columns of an output tile
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i8;
+    int16_t *pBufSrc;             // two L1 buffers of the input tiles including the halo
+    int16_t *pBufKer;             // filter kernel, in L1
+    int32_t *pBufDst;             // two L1 buffers of the output tiles
+    hal_cl_dma_cmd_t dmaLoad[2];  // transfers of the input tiles into pBufSrc
+    hal_cl_dma_cmd_t dmaStore[2]; // transfers of the output tiles back to L2
+    int32_t *__restrict__ pDst;   // output image, in L2
+} plp_conv2d_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
- */
+    @struct plp_conv2d_instance_f32
+    @brief Instance structure for the 32-bit floating point parallel tiled 2D convolution
+*/
 typedef struct {
-    uint32_t N;
+    const float32_t *__restrict__ pSrc; // input image, in L2
+    uint32_t srcRows;
+    uint32_t srcCols;
+    uint32_t kerRows;
+    uint32_t kerCols;
+    uint32_t tileRows; // maximal number of rows of an output tile
+    uint32_t tileCols; // maximal number of columns of an output tile
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i16;
+    float32_t *pBufSrc;           // two L1 buffers of the input tiles including the halo
+    float32_t *pBufKer;           // filter kernel, in L1
+    float32_t *pBufDst;           // two L1 buffers of the output tiles
+    hal_cl_dma_cmd_t dmaLoad[2];  // transfers of the input tiles into pBufSrc
+    hal_cl_dma_cmd_t dmaStore[2]; // transfers of the output tiles back to L2
+    float32_t *__restrict__ pDst; // output image, in L2
+} plp_conv2d_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel identity matrix creation.
- */
+    @struct plp_conv_rep_instance_i8
+    @brief Instance structure for the 8-bit integer convolution with data replication, set up by
+           plp_conv_rep_init_i8
+*/
 typedef struct {
-    uint32_t N;
-    uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_i32;
+    int8_t *pSrcA;    // longer vector, zero-padded and replicated 4 times, in L1
+    uint32_t srcALen; // length of the padded longer vector
+    uint32_t srcAMem; // distance between two copies
+    int8_t *pSrcB;    // shorter vector, reversed for correlation, in L1
+    uint32_t srcBLen; // length of the shorter vector
+    uint32_t revRes;  // the result has to be reversed
+    uint32_t memSize; // size of the L1 buffer starting at pSrcA, in bytes
+    uint32_t nPE;     // number of processing units
+    int32_t *pRes;    // output vector
+} plp_conv_rep_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_conv_rep_instance_i16
+    @brief Instance structure for the 16-bit integer convolution with data replication, set up by
+           plp_conv_rep_init_i16
+*/
+typedef struct {
+    int16_t *pSrcA;   // longer vector, zero-padded and replicated 2 times, in L1
+    uint32_t srcALen; // length of the padded longer vector
+    uint32_t srcAMem; // distance between two copies
+    int16_t *pSrcB;   // shorter vector, reversed for correlation, in L1
+    uint32_t srcBLen; // length of the shorter vector
+    uint32_t revRes;  // the result has to be reversed
+    uint32_t memSize; // size of the L1 buffer starting at pSrcA, in bytes
+    uint32_t nPE;     // number of processing units
+    int32_t *pRes;    // output vector
+} plp_conv_rep_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_fast_math_vec_instance_q16
+    @brief Instance structure for the parallel 16-bit fixed point vector fast math functions
+           with one input vector, e.g. plp_sin_vec_q16_parallel or plp_exp_vec_q16_parallel
+*/
+typedef struct {
+    const int16_t *pSrc; // input vector
+    int16_t *pDst;       // output vector
+    uint32_t blockSize;  // number of samples
+    uint32_t fracBits;   // fractional bits of the input (unused by plp_sin_vec and plp_cos_vec)
+    uint32_t nPE;        // number of processing units
+} plp_fast_math_vec_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel identity matrix creation.
- */
+    @struct plp_fast_math_vec_instance_q32
+    @brief Instance structure for the parallel 32-bit fixed point vector fast math functions
+           with one input vector, e.g. plp_sin_vec_q32_parallel or plp_exp_vec_q32_parallel
+*/
 typedef struct {
-    uint32_t N;
-    uint32_t nPE;
-    float *__restrict__ pDst;
-} plp_mat_fill_I_instance_f32;
+    const int32_t *pSrc; // input vector
+    int32_t *pDst;       // output vector
+    uint32_t blockSize;  // number of samples
+    uint32_t fracBits;   // fractional bits of the input (unused by plp_sin_vec and plp_cos_vec)
+    uint32_t nPE;        // number of processing units
+} plp_fast_math_vec_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
+    @struct plp_fast_math_vec_instance_f32
+    @brief Instance structure for the parallel 32-bit floating point vector fast math functions
+           with one input vector, e.g. plp_sin_vec_f32_parallel or plp_exp_vec_f32_parallel
+*/
+typedef struct {
+    const float32_t *pSrc; // input vector
+    float32_t *pDst;       // output vector
+    uint32_t blockSize;    // number of samples
+    uint32_t nPE;          // number of processing units
+} plp_fast_math_vec_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_atan2_vec_instance_q16
+    @brief Instance structure for plp_atan2_vec_q16_parallel
+*/
+typedef struct {
+    const int16_t *pSrcY; // y coordinates
+    const int16_t *pSrcX; // x coordinates
+    int16_t *pDst;        // output vector
+    uint32_t blockSize;   // number of samples
+    uint32_t nPE;         // number of processing units
+} plp_atan2_vec_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_atan2_vec_instance_q32
+    @brief Instance structure for plp_atan2_vec_q32_parallel
+*/
+typedef struct {
+    const int32_t *pSrcY; // y coordinates
+    const int32_t *pSrcX; // x coordinates
+    int32_t *pDst;        // output vector
+    uint32_t blockSize;   // number of samples
+    uint32_t nPE;         // number of processing units
+} plp_atan2_vec_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_atan2_vec_instance_f32
+    @brief Instance structure for plp_atan2_vec_f32_parallel
+*/
+typedef struct {
+    const float32_t *pSrcY; // y coordinates
+    const float32_t *pSrcX; // x coordinates
+    float32_t *pDst;        // output vector
+    uint32_t blockSize;     // number of samples
+    uint32_t nPE;           // number of processing units
+} plp_atan2_vec_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_var_partial_f32
+    @brief Partial statistics of a block of a 32-bit float vector, which are merged with
+           plp_var_merge_f32
+*/
+typedef struct {
+    uint32_t count; // number of samples
+    float32_t mean; // mean of the samples
+    float32_t m2;   // sum of the squared deviations from the mean
+} plp_var_partial_f32;
+
+/** -------------------------------------------------------
+    @struct plp_var_partial_q
+    @brief Partial statistics of a block of a fixed point vector. The sums are exact and relative
+           to a reference sample; partial statistics with the same reference are merged with
+           plp_var_merge_q. The sum of the squares has 96 bits, since the squared deviations of
+           a 32-bit vector already need 64 bits.
+*/
+typedef struct {
+    uint32_t count;   // number of samples
+    int64_t sum;      // sum of the deviations from the reference
+    uint64_t sumSq;   // sum of the squared deviations from the reference, lower 64 bits
+    uint32_t sumSqHi; // sum of the squared deviations from the reference, upper 32 bits
+} plp_var_partial_q;
+
+/** -------------------------------------------------------
+    @struct plp_var_instance_f32
+    @brief Instance structure for plp_var_f32_parallel
+*/
+typedef struct {
+    const float32_t *pSrc;         // input vector
+    uint32_t blockSize;            // number of samples
+    uint32_t nPE;                  // number of processing units
+    plp_var_partial_f32 *pPartial; // partial statistics, one per core
+} plp_var_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_var_instance_q32
+    @brief Instance structure for plp_var_q32_parallel
+*/
+typedef struct {
+    const int32_t *pSrc;         // input vector
+    uint32_t blockSize;          // number of samples
+    uint32_t nPE;                // number of processing units
+    plp_var_partial_q *pPartial; // partial statistics, one per core
+} plp_var_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_var_instance_q16
+    @brief Instance structure for plp_var_q16_parallel
+*/
+typedef struct {
+    const int16_t *pSrc;         // input vector
+    uint32_t blockSize;          // number of samples
+    uint32_t nPE;                // number of processing units
+    plp_var_partial_q *pPartial; // partial statistics, one per core
+} plp_var_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_var_instance_q8
+    @brief Instance structure for plp_var_q8_parallel
+*/
+typedef struct {
+    const int8_t *pSrc;          // input vector
+    uint32_t blockSize;          // number of samples
+    uint32_t nPE;                // number of processing units
+    plp_var_partial_q *pPartial; // partial statistics, one per core
+} plp_var_instance_q8;
+
+/** -------------------------------------------------------
+    @struct plp_stats_instance_i32
+    @brief Instance structure for the parallel statistics functions of 32-bit vectors, e.g.
+           plp_max_i32_parallel
+*/
+typedef struct {
+    const int32_t *pSrc; // input vector
+    uint32_t blockSize;  // number of samples
+    uint32_t fracBits;   // number of fractional bits (fixed point only)
+    uint32_t nPE;        // number of processing units
+    int32_t *resBuffer;  // partial results, one per core
+} plp_stats_instance_i32;
+
+/** -------------------------------------------------------
+    @struct plp_stats_instance_i16
+    @brief Instance structure for the parallel statistics functions of 16-bit vectors, e.g.
+           plp_max_i16_parallel
+*/
+typedef struct {
+    const int16_t *pSrc; // input vector
+    uint32_t blockSize;  // number of samples
+    uint32_t fracBits;   // number of fractional bits (fixed point only)
+    uint32_t nPE;        // number of processing units
+    int32_t *resBuffer;  // partial results, one per core
+} plp_stats_instance_i16;
+
+/** -------------------------------------------------------
+    @struct plp_stats_instance_i8
+    @brief Instance structure for the parallel statistics functions of 8-bit vectors, e.g.
+           plp_max_i8_parallel
+*/
+typedef struct {
+    const int8_t *pSrc; // input vector
+    uint32_t blockSize; // number of samples
+    uint32_t fracBits;  // number of fractional bits (fixed point only)
+    uint32_t nPE;       // number of processing units
+    int32_t *resBuffer; // partial results, one per core
+} plp_stats_instance_i8;
+
+/** -------------------------------------------------------
+    @struct plp_stats_instance_f32
+    @brief Instance structure for the parallel statistics functions of 32-bit float vectors, e.g.
+           plp_max_f32_parallel
+*/
+typedef struct {
+    const float *pSrc;  // input vector
+    uint32_t blockSize; // number of samples
+    uint32_t fracBits;  // number of fractional bits (fixed point only)
+    uint32_t nPE;       // number of processing units
+    float *resBuffer;   // partial results, one per core
+} plp_stats_instance_f32;
+
+/**
+ * @brief Instance structure for the fixed-point CFFT/CIFFT function.
+ * @param[in]   fftLen              length of the FFT
+ * @param[in]   pTwiddle            points to the Twiddle factor table
+ * @param[in]   pBitRevTable        points to the bit reversal table
+ * @param[in]   bitRevTableLength   bit reversal table length
  */
 typedef struct {
-    uint32_t N;
-    int32_t fracBits;
+    uint16_t fftLen;             /*< length of the FFT. */
+    const int16_t *pTwiddle;     /*< points to the Twiddle factor table. */
+    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
+    uint16_t bitRevLength;       /*< bit reversal table length. */
+} plp_cfft_instance_q16;
+
+/**
+ * @brief Instance structure for the parallel CFFT Q16
+ * @param[in]       fft_struct          cfft_q16 struct
+ * @param[in/out]   p1                  points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]       ifftFlag            flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]       bitReverseFlag      flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]       deciPoint           decimal point for right shift
+ * @param[in]       nPE                 number of cores to use
+ */
+typedef struct {
+    plp_cfft_instance_q16 *S;
+    int16_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
+    uint32_t deciPoint;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q8;
+} plp_cfft_instance_q16_parallel;
 
-/** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
+/**
+ * @brief Instance structure for the fixed-point CFFT/CIFFT function.
+ * @param[in]   fftLen              length of the FFT
+ * @param[in]   pTwiddle            points to the Twiddle factor table
+ * @param[in]   pBitRevTable        points to the bit reversal table
+ * @param[in]   bitRevTableLength   bit reversal table length
  */
 typedef struct {
-    uint32_t N;
+    uint16_t fftLen;             /*< length of the FFT. */
+    const int32_t *pTwiddle;     /*< points to the Twiddle factor table. */
+    const int16_t *pBitRevTable; /*< points to the bit reversal table. */
+    uint16_t bitRevLength;       /*< bit reversal table length. */
+} plp_cfft_instance_q32;
+
+/**
+ * @brief Instance structure for the parallel CFFT Q32
+ * @param[in]       S                   cfft_q32 struct
+ * @param[in/out]   p1                  points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]       ifftFlag            flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * transform.
+ * @param[in]       bitReverseFlag      flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]       fracBits            decimal point for right shift (input format
+ * Q(32-fracBits).fracBits)
+ * @param[in]       nPE                 number of cores to use
+ */
+typedef struct {
+    const plp_cfft_instance_q32 *S;
+    int32_t *p1;
+    uint8_t ifftFlag;
+    uint8_t bitReverseFlag;
     uint32_t fracBits;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q16;
+} plp_cfft_instance_q32_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for fix-point parallel identity matrix creation.
- */
+    @struct plp_rfft_instance_q16
+    @brief Instance structure for the 16-bit fixed-point FFT on real input data
+    @param[in]  fftLenReal    length N of the real FFT
+    @param[in]  pCfft         points to the instance of the complex FFT of length N/2
+    @param[in]  pTwiddleRFFT  points to the twiddle factors (cos, sin) of \f$\frac{2 \pi}{N} k\f$
+    for \f$k = 0 .. \frac{N}{4}\f$, in the format of the complex FFT twiddle tables. The twiddle
+    table of the complex FFT of length N can be used.
+*/
 typedef struct {
-    uint32_t N;
-    uint32_t fracBits;
+    uint16_t fftLenReal;
+    const plp_cfft_instance_q16 *pCfft;
+    const int16_t *pTwiddleRFFT;
+} plp_rfft_instance_q16;
+
+/** -------------------------------------------------------
+    @struct plp_rfft_instance_q32
+    @brief Instance structure for the 32-bit fixed-point FFT on real input data
+    @param[in]  fftLenReal    length N of the real FFT
+    @param[in]  pCfft         points to the instance of the complex FFT of length N/2
+    @param[in]  pTwiddleRFFT  points to the twiddle factors (cos, sin) of \f$\frac{2 \pi}{N} k\f$
+    for \f$k = 0 .. \frac{N}{4}\f$, in the format of the complex FFT twiddle tables. The twiddle
+    table of the complex FFT of length N can be used.
+*/
+typedef struct {
+    uint16_t fftLenReal;
+    const plp_cfft_instance_q32 *pCfft;
+    const int32_t *pTwiddleRFFT;
+} plp_rfft_instance_q32;
+
+/** -------------------------------------------------------
+    @struct plp_rfft_instance_q16_parallel
+    @brief Instance structure for the 16-bit fixed-point FFT on real input data (parallel version)
+    @param[in]  S         points to the instance of the real FFT
+    @param[in]  pSrc      pointer to the input data buffer
+    @param[in]  nPE       number of cores
+    @param[out] pDst      pointer to the output data buffer
+*/
+typedef struct {
+    const plp_rfft_instance_q16 *S;
+    const int16_t *pSrc;
     uint32_t nPE;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_I_instance_q32;
+    int16_t *pDst;
+} plp_rfft_instance_q16_parallel;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
+    @struct plp_rfft_instance_q32_parallel
+    @brief Instance structure for the 32-bit fixed-point FFT on real input data (parallel version)
+    @param[in]  S         points to the instance of the real FFT
+    @param[in]  pSrc      pointer to the input data buffer
+    @param[in]  nPE       number of cores
+    @param[out] pDst      pointer to the output data buffer
+*/
+typedef struct {
+    const plp_rfft_instance_q32 *S;
+    const int32_t *pSrc;
+    uint32_t nPE;
+    int32_t *pDst;
+} plp_rfft_instance_q32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_fft_instance_f32
+    @brief Instance structure for floating-point FFT
+    @param[in]  length data length of the FFT
+    @param[in]  bitReverseFlag  flag that enables (bitReverseFlagR=1) or disables
+    (bitReverseFlagR=0) bit reversal of output
+    @param[in]  pTwiddleFactors pointer to the twiddle factors.
+    These values must be computed using this formula:
+    \f$W_N^k =   e^{-j \frac{2 \pi}{N} k}\f$,
+    where \f$N\f$ is the data length and \f$k\f$ is the index.
+    The user must provide \f$\frac{N}{2}\f$ values (\f$k = 0 .. \frac{N}{2}-1\f$).
+    @param[in]  pBitReverseLUT  pointer to the lookup table used for the bit reversal of output.
+    This table must include \f$N\f$ elements in the range \f$0 .. N-1\f$,
+    where each location \f$k\f$ contains the value \f$bitreverse(k)\f$.
+*/
+typedef struct {
+    uint32_t FFTLength;
+    uint8_t bitReverseFlag;
+    const float32_t *pTwiddleFactors;
+    const uint16_t *pBitReverseLUT;
+} plp_fft_instance_f32;
+
+/** -------------------------------------------------------
+    @struct plp_fft_instance_f32_parallel
+    @brief Instance structure for floating-point FFT (parallel version)
+    @param[in]  S         pointer to a plp_fft_instance_f32 data structure (FFT parameters)
+    @param[in]  pSrc      pointer to the input data buffer
+    @param[in]  nPE       number of cores
+    @param[out] pDst      pointer to the output data buffer
+*/
+typedef struct {
+    const plp_fft_instance_f32 *S;
+    const float32_t *pSrc;
+    const uint32_t nPE;
+    float32_t *pDst;
+} plp_fft_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct Complex_type_f32
+    @brief Helper type to represent complex values with float32 components.
+    @param  re  Real part
+    @param  im  Imaginary part
+*/
+typedef struct {
+    float32_t re;
+    float32_t im;
+} Complex_type_f32;
+
+#define PLP_CFFT_MIXED_MAX_STAGES 20
+
+/** -------------------------------------------------------
+    @struct plp_cfft_mixed_plan_f32
+    @brief Plan for the floating-point mixed-radix FFT, created by plp_cfft_mixed_plan_init_f32
+    @param[in]  FFTLength  length N of the FFT, of the form 2^a 3^b 5^c
+    @param[in]  nStages    number of radix stages
+    @param[in]  radix      radix (2, 3, 4, 5 or 8) of each stage, in the order of execution
+    @param[in]  pTwiddle   points to the N twiddle factors \f$W_N^k = e^{-j \frac{2 \pi}{N} k}\f$
+    @param[in]  pScratch   points to a scratch buffer of N complex values
+*/
+typedef struct {
+    uint32_t FFTLength;
+    uint32_t nStages;
+    uint8_t radix[PLP_CFFT_MIXED_MAX_STAGES];
+    const Complex_type_f32 *pTwiddle;
+    Complex_type_f32 *pScratch;
+} plp_cfft_mixed_plan_f32;
+
+/** -------------------------------------------------------
+    @struct plp_cfft_mixed_instance_f32_parallel
+    @brief Instance structure for the floating-point mixed-radix FFT (parallel version)
+    @param[in]  S         points to the plan of the mixed-radix FFT
+    @param[in]  pSrc      pointer to the input data buffer
+    @param[in]  nPE       number of cores
+    @param[out] pDst      pointer to the output data buffer
+*/
+typedef struct {
+    const plp_cfft_mixed_plan_f32 *S;
+    const float32_t *pSrc;
+    uint32_t nPE;
+    float32_t *pDst;
+} plp_cfft_mixed_instance_f32_parallel;
+
+/** -------------------------------------------------------
+    @struct plp_fft_plan_f32
+    @brief Plan of a floating-point complex FFT, with the tables generated at runtime
+    @param[in]  S         FFT instance for plp_cfft_f32, pointing to the generated tables
+    @param[in]  pMem      memory allocated by the plan, NULL if provided by the caller
+    @param[in]  memSize   size of the plan and its tables in bytes
+*/
+typedef struct {
+    plp_fft_instance_f32 S;
+    void *pMem;
+    uint32_t memSize;
+} plp_fft_plan_f32;
+
+/** -------------------------------------------------------
+    @struct plp_fft_plan_q16
+    @brief Plan of a 16-bit fixed-point complex FFT, with the tables generated at runtime
+    @param[in]  S         FFT instance for plp_cfft_q16, pointing to the generated tables
+    @param[in]  pMem      memory allocated by the plan, NULL if provided by the caller
+    @param[in]  memSize   size of the plan and its tables in bytes
+*/
+typedef struct {
+    plp_cfft_instance_q16 S;
+    void *pMem;
+    uint32_t memSize;
+} plp_fft_plan_q16;
+
+/** -------------------------------------------------------
+    @struct plp_fft_plan_q32
+    @brief Plan of a 32-bit fixed-point complex FFT, with the tables generated at runtime
+    @param[in]  S         FFT instance for plp_cfft_q32, pointing to the generated tables
+    @param[in]  pMem      memory allocated by the plan, NULL if provided by the caller
+    @param[in]  memSize   size of the plan and its tables in bytes
+*/
+typedef struct {
+    plp_cfft_instance_q32 S;
+    void *pMem;
+    uint32_t memSize;
+} plp_fft_plan_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -789,15 +1480,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i8;
+} plp_mat_mult_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -805,15 +1493,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i16;
+} plp_mat_mult_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix multiplication.
+ * @brief Instance structure for integer parallel matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -821,15 +1506,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_i32;
+} plp_mat_mult_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix multiplication.
+ * @brief Instance structure for floating-point parallel matrix multiplication.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
@@ -837,15 +1519,75 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     float *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_f32;
+} plp_mat_mult_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 8-bit fix-point parallel matrix multiplication.
+ * @brief Instance structure for 8-bit integer parallel tiled matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA; // first input matrix, in L2
+    const int8_t *__restrict__ pSrcB; // second input matrix, in L2
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM; // maximal number of rows of a tile of A and C
+    uint32_t tileN; // maximal number of columns of a tile of A and rows of a tile of B
+    uint32_t tileO; // maximal number of columns of a tile of B and C
+    uint32_t nPE;
+    int8_t *pBufA;                // two L1 buffers of tileM * tileN elements
+    int8_t *pBufB;                // two L1 buffers of tileN * tileO elements
+    int32_t *pBufC;               // two L1 buffers of tileM * tileO elements
+    hal_cl_dma_cmd_t dmaLoad[2];  // transfers of the A and B tiles into pBufA and pBufB
+    hal_cl_dma_cmd_t dmaStore[2]; // transfers of the C tiles back to L2
+    int32_t *__restrict__ pDstC;  // output matrix, in L2
+} plp_mat_mult_tiled_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit integer parallel tiled matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA; // first input matrix, in L2
+    const int16_t *__restrict__ pSrcB; // second input matrix, in L2
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM; // maximal number of rows of a tile of A and C
+    uint32_t tileN; // maximal number of columns of a tile of A and rows of a tile of B
+    uint32_t tileO; // maximal number of columns of a tile of B and C
+    uint32_t nPE;
+    int16_t *pBufA;               // two L1 buffers of tileM * tileN elements
+    int16_t *pBufB;               // two L1 buffers of tileN * tileO elements
+    int32_t *pBufC;               // two L1 buffers of tileM * tileO elements
+    hal_cl_dma_cmd_t dmaLoad[2];  // transfers of the A and B tiles into pBufA and pBufB
+    hal_cl_dma_cmd_t dmaStore[2]; // transfers of the C tiles back to L2
+    int32_t *__restrict__ pDstC;  // output matrix, in L2
+} plp_mat_mult_tiled_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel tiled matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA; // first input matrix, in L2
+    const float *__restrict__ pSrcB; // second input matrix, in L2
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t tileM; // maximal number of rows of a tile of A and C
+    uint32_t tileN; // maximal number of columns of a tile of A and rows of a tile of B
+    uint32_t tileO; // maximal number of columns of a tile of B and C
+    uint32_t nPE;
+    float *pBufA;                 // two L1 buffers of tileM * tileN elements
+    float *pBufB;                 // two L1 buffers of tileN * tileO elements
+    float *pBufC;                 // two L1 buffers of tileM * tileO elements
+    hal_cl_dma_cmd_t dmaLoad[2];  // transfers of the A and B tiles into pBufA and pBufB
+    hal_cl_dma_cmd_t dmaStore[2]; // transfers of the C tiles back to L2
+    float *__restrict__ pDstC;    // output matrix, in L2
+} plp_mat_mult_tiled_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -853,16 +1595,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int8_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q8;
+} plp_mat_mult_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 16-bit fix-point parallel matrix multiplication.
+ * @brief Instance structure for 16-bit fix-point parallel matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -870,16 +1609,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int16_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q16;
+} plp_mat_mult_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided 32-bit fix-point parallel matrix multiplication.
+ * @brief Instance structure for 32-bit fix-point parallel matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -887,16 +1623,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_stride_instance_q32;
+} plp_mat_mult_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -904,15 +1637,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i8;
+} plp_mat_mult_cmplx_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -920,15 +1650,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i16;
+} plp_mat_mult_cmplx_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ * @brief Instance structure for integer parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -936,16 +1663,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_i32;
+} plp_mat_mult_cmplx_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for floating-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
@@ -953,16 +1676,12 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t nPE;
     float *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_f32;
+} plp_mat_mult_cmplx_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for 8-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
@@ -970,17 +1689,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int8_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q8;
+} plp_mat_mult_cmplx_instance_q8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for 16-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
@@ -988,17 +1703,13 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int16_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q16;
+} plp_mat_mult_cmplx_instance_q16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel complex strided matrix matrix
- * multiplication.
+ * @brief Instance structure for 32-bit fix-point parallel complex matrix matrix multiplication.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
@@ -1006,2715 +1717,9420 @@ typedef struct {
     uint32_t M;
     uint32_t N;
     uint32_t O;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideC;
     uint32_t shift;
     uint32_t nPE;
     int32_t *__restrict__ pDstC;
-} plp_mat_mult_cmplx_stride_instance_q32;
+} plp_mat_mult_cmplx_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Instance structure for integer parallel matrix addition.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
     const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
     uint32_t nPE;
     int8_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i8;
+} plp_mat_add_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Instance structure for integer parallel matrix addition.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
     const int16_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i16;
+} plp_mat_add_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix addition.
+ * @brief Instance structure for integer parallel matrix addition.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
     const int32_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_add_stride_instance_i32;
+} plp_mat_add_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix addition.
+ * @brief Instance structure for floating-point parallel matrix addition.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
     const float *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_add_stride_instance_f32;
+} plp_mat_add_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for integer parallel matrix subtraction.
  */
 typedef struct {
     const int8_t *__restrict__ pSrcA;
     const int8_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
     uint32_t nPE;
     int8_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i8;
+} plp_mat_sub_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for integer parallel matrix subtraction.
  */
 typedef struct {
     const int16_t *__restrict__ pSrcA;
     const int16_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i16;
+} plp_mat_sub_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix subtraction.
+ * @brief Instance structure for integer parallel matrix subtraction.
  */
 typedef struct {
     const int32_t *__restrict__ pSrcA;
     const int32_t *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_sub_stride_instance_i32;
+} plp_mat_sub_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix subtraction.
+ * @brief Instance structure for floating-point parallel matrix subtraction.
  */
 typedef struct {
     const float *__restrict__ pSrcA;
     const float *__restrict__ pSrcB;
     uint32_t M;
     uint32_t N;
-    uint32_t strideA;
-    uint32_t strideB;
-    uint32_t strideY;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_sub_stride_instance_f32;
+} plp_mat_sub_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
     const int8_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     int8_t scaleFactor;
     int32_t shift;
     uint32_t nPE;
     int8_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i8;
+} plp_mat_scale_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
     const int16_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     int16_t scaleFactor;
     int32_t shift;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i16;
+} plp_mat_scale_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided integer parallel matrix scale.
+ * @brief Instance structure for integer parallel matrix scale.
  */
 typedef struct {
     const int32_t *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     int32_t scaleFactor;
     int32_t shift;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_scale_stride_instance_i32;
+} plp_mat_scale_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for strided floating-point parallel matrix scale.
+ * @brief Instance structure for floating-point parallel matrix scale.
  */
 typedef struct {
     const float *__restrict__ pSrc;
     uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     float scaleFactor;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_scale_stride_instance_f32;
+} plp_mat_scale_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix transpose.
  */
 typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
     int8_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i8;
+} plp_mat_trans_instance_i8;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix transpose.
  */
 typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i16;
+} plp_mat_trans_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided identity matrix creation.
+ * @brief Instance structure for integer parallel matrix transpose.
  */
 typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_i32;
+} plp_mat_trans_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel strided identity matrix creation.
+ * @brief Instance structure for floating-point parallel matrix inversion.
  */
 typedef struct {
+    float *__restrict__ pSrc;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_f32;
+    uint32_t pivot; // row of the current pivot, shared between the cores
+    float pivotInv; // reciprocal of the current pivot, shared between the cores
+    int32_t ret;    // 0: Success, 1: Matrix is singular
+} plp_mat_inv_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 8-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for floating-point parallel LU decomposition.
  */
 typedef struct {
+    float *__restrict__ pSrc;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
-    int32_t fracBits;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q8;
+    uint32_t *__restrict__ pPerm;
+    int32_t ret; // 0: Success, 1: Matrix is singular
+} plp_mat_lu_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 16-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for fix-point parallel LU decomposition.
  */
 typedef struct {
+    int32_t *__restrict__ pSrc;
     uint32_t N;
-    uint32_t stride;
+    uint32_t fracBits;
     uint32_t nPE;
-    int32_t fracBits;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q16;
+    uint32_t *__restrict__ pPerm;
+    int32_t ret; // 0: Success, 1: Matrix is singular
+} plp_mat_lu_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for 32-bit fix-point parallel strided identity matrix creation.
+ * @brief Instance structure for floating-point parallel Cholesky decomposition.
  */
 typedef struct {
+    const float *__restrict__ pSrc;
     uint32_t N;
-    uint32_t stride;
     uint32_t nPE;
-    int32_t fracBits;
-    int32_t *__restrict__ pDst;
-} plp_mat_fill_I_stride_instance_q32;
+    float *__restrict__ pDst;
+    int32_t ret; // 0: Success, 1: Matrix is not positive definite
+} plp_mat_cholesky_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for fix-point parallel Cholesky decomposition.
  */
 typedef struct {
-    uint32_t M;
+    const int32_t *__restrict__ pSrc;
     uint32_t N;
-    uint32_t stride;
-    int8_t value;
+    uint32_t fracBits;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i8;
+    int32_t *__restrict__ pDst;
+    int32_t ret; // 0: Success, 1: Matrix is not positive definite
+} plp_mat_cholesky_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for floating-point parallel linear system solver with LU
+ * decomposition.
  */
 typedef struct {
-    uint32_t M;
+    const float *__restrict__ pLU;
+    const uint32_t *__restrict__ pPerm;
     uint32_t N;
-    uint32_t stride;
-    int16_t value;
+    const float *__restrict__ pB;
+    uint32_t K;
     uint32_t nPE;
-    int16_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i16;
+    float *__restrict__ pDst;
+} plp_mat_solve_lu_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling an integer matrix in parallel.
+ * @brief Instance structure for fix-point parallel linear system solver with LU decomposition.
  */
 typedef struct {
-    uint32_t M;
+    const int32_t *__restrict__ pLU;
+    const uint32_t *__restrict__ pPerm;
     uint32_t N;
-    uint32_t stride;
-    int32_t value;
+    const int32_t *__restrict__ pB;
+    uint32_t K;
+    uint32_t fracBits;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_fill_stride_instance_i32;
+} plp_mat_solve_lu_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for filling a floating-point matrix in parallel.
+ * @brief Instance structure for floating-point parallel linear system solver with Cholesky
+ * decomposition.
  */
 typedef struct {
-    uint32_t M;
+    const float *__restrict__ pL;
     uint32_t N;
-    uint32_t stride;
-    float value;
+    const float *__restrict__ pB;
+    uint32_t K;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_fill_stride_instance_f32;
+} plp_mat_solve_cholesky_instance_f32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for fix-point parallel linear system solver with Cholesky
+ * decomposition.
  */
 typedef struct {
-    const int8_t *__restrict__ pSrc;
-    uint32_t M;
+    const int32_t *__restrict__ pL;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
+    const int32_t *__restrict__ pB;
+    uint32_t K;
+    uint32_t fracBits;
     uint32_t nPE;
-    int8_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i8;
+    int32_t *__restrict__ pDst;
+} plp_mat_solve_cholesky_instance_q32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for integer parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel identity matrix creation.
  */
 typedef struct {
-    const int16_t *__restrict__ pSrc;
-    uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     uint32_t nPE;
     int16_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i16;
+} plp_mat_fill_I_instance_i16;
 
 /** -------------------------------------------------------
- * @brief Instance structure for integer parallel strided matrix copy.
+ * @brief Instance structure for integer parallel identity matrix creation.
  */
 typedef struct {
-    const int32_t *__restrict__ pSrc;
-    uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     uint32_t nPE;
     int32_t *__restrict__ pDst;
-} plp_mat_copy_stride_instance_i32;
+} plp_mat_fill_I_instance_i32;
 
 /** -------------------------------------------------------
- * @brief Instance structure for floating-point parallel strided matrix copy.
+ * @brief Instance structure for floating-point parallel identity matrix creation.
  */
 typedef struct {
-    const float *__restrict__ pSrc;
-    uint32_t M;
     uint32_t N;
-    uint32_t strideSrc;
-    uint32_t strideDst;
     uint32_t nPE;
     float *__restrict__ pDst;
-} plp_mat_copy_stride_instance_f32;
+} plp_mat_fill_I_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
-
-void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pRes);
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    int32_t fracBits;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q8;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
-
-void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t deciPoint,
-                               uint32_t nPE,
-                               int32_t *__restrict__ pRes);
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q16;
 
 /** -------------------------------------------------------
-    @brief Glue code for parallel dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  nPE        number of parallel processing units
-    @param[out] pRes     output result returned here
-    @return     none
-*/
-
-void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t nPE,
-                               float32_t *__restrict__ pRes);
+ * @brief Instance structure for fix-point parallel identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t fracBits;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_instance_q32;
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
-    extension.
-    @param[in]  S     points to the instance structure for integer parallel dot product
-    @return     none
-*/
-
-void plp_dot_prod_i32p_xpulpv2(void *S);
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i8;
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit fixed point vectors kernel for
-    XPULPV2 extension.
-    @param[in]  S     points to the instance structure for fixed point parallel dot product
-    @return     none
-*/
-
-void plp_dot_prod_q32p_xpulpv2(void *S);
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i16;
 
 /** -------------------------------------------------------
-    @brief Parallel dot product with interleaved access of 32-bit float vectors kernel for XPULPV2
-    extension.
-    @param[in]  S     points to the instance structure for float parallel dot product
-    @return     none
-*/
+ * @brief Instance structure for strided integer parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_i32;
 
-void plp_dot_prod_f32p_xpulpv2(void *S);
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_f32;
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-*/
-void plp_dot_prod_i32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      int32_t *__restrict__ pRes);
+ * @brief Instance structure for strided 8-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q8;
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-*/
-void plp_dot_prod_i32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+ * @brief Instance structure for strided 16-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q16;
 
 /** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-*/
-void plp_dot_prod_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               int32_t *__restrict__ pRes);
+ * @brief Instance structure for strided 32-bit fix-point parallel matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_stride_instance_q32;
 
 /** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit fixed point vectors.
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel complex strided matrix matrix multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t nPE;
+    float *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel complex strided matrix matrix
+ * multiplication.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t O;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideC;
+    uint32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDstC;
+} plp_mat_mult_cmplx_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix addition.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_add_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix addition.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_add_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrcA;
+    const int8_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrcA;
+    const int16_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix subtraction.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrcA;
+    const int32_t *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_sub_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix subtraction.
+ */
+typedef struct {
+    const float *__restrict__ pSrcA;
+    const float *__restrict__ pSrcB;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideA;
+    uint32_t strideB;
+    uint32_t strideY;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_sub_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int8_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int16_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided integer parallel matrix scale.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    int32_t scaleFactor;
+    int32_t shift;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_scale_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for strided floating-point parallel matrix scale.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    float scaleFactor;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_scale_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 8-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 16-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for 32-bit fix-point parallel strided identity matrix creation.
+ */
+typedef struct {
+    uint32_t N;
+    uint32_t stride;
+    uint32_t nPE;
+    int32_t fracBits;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_I_stride_instance_q32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int8_t value;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int16_t value;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling an integer matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    int32_t value;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_fill_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for filling a floating-point matrix in parallel.
+ */
+typedef struct {
+    uint32_t M;
+    uint32_t N;
+    uint32_t stride;
+    float value;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_fill_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int8_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int8_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i8;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int16_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int16_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i16;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for integer parallel strided matrix copy.
+ */
+typedef struct {
+    const int32_t *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    int32_t *__restrict__ pDst;
+} plp_mat_copy_stride_instance_i32;
+
+/** -------------------------------------------------------
+ * @brief Instance structure for floating-point parallel strided matrix copy.
+ */
+typedef struct {
+    const float *__restrict__ pSrc;
+    uint32_t M;
+    uint32_t N;
+    uint32_t strideSrc;
+    uint32_t strideDst;
+    uint32_t nPE;
+    float *__restrict__ pDst;
+} plp_mat_copy_stride_instance_f32;
+
+/** -------------------------------------------------------
+ * @brief Part of an output matrix assigned to one core by plp_mat_partition.
+ */
+typedef struct {
+    uint32_t rowStart; // first row of the tile
+    uint32_t rowEnd;   // one past the last row of the tile
+    uint32_t colStart; // first column of the tile
+    uint32_t colEnd;   // one past the last column of the tile
+} plp_mat_tile;
+
+/** -------------------------------------------------------
+    @brief      Work partitioning of an MxO output matrix among the cores of a parallel kernel.
+    @param[in]  M         number of rows of the output matrix
+    @param[in]  O         number of columns of the output matrix
+    @param[in]  colBlock  granularity of the column split, e.g. the SIMD width of the kernel
+    @param[in]  nPE       number of parallel processing units
+    @param[in]  core_id   id of the calling core
+    @param[out] tile      contiguous block of rows and columns computed by the calling core
+    @return     none
+
+    @par
+    The cores are arranged in a grid of row blocks times column blocks, chosen such that the
+    largest tile is as small as possible. Among equally good grids, the one with the most row
+    blocks is taken. Hence, tall matrices are split by rows only, while skinny ones (e.g. matrix
+    vector products with M=1 or outer products) are split by columns or in 2D tiles, using all
+    cores. Every core works on contiguous rows, which avoids the bank conflicts of an interleaved
+    row distribution. If there is less work than cores, the remaining cores get an empty tile.
+*/
+static inline void plp_mat_partition(
+    uint32_t M, uint32_t O, uint32_t colBlock, uint32_t nPE, uint32_t core_id, plp_mat_tile *tile) {
+
+    uint32_t nCols = (O + colBlock - 1) / colBlock; // number of column blocks
+    uint32_t bestRows = 1;
+    uint32_t bestCols = 1;
+    uint32_t bestWork = 0xFFFFFFFF;
+
+    for (uint32_t rows = 1; rows <= nPE; rows++) {
+        uint32_t cols = nPE / rows;
+        uint32_t r = (rows < M) ? rows : M;
+        uint32_t c = (cols < nCols) ? cols : nCols;
+        if (r == 0 || c == 0) {
+            break;
+        }
+        uint32_t work = ((M + r - 1) / r) * ((nCols + c - 1) / c);
+        if (work <= bestWork) {
+            bestWork = work;
+            bestRows = r;
+            bestCols = c;
+        }
+    }
+
+    uint32_t rowId = core_id / bestCols;
+    uint32_t colId = core_id % bestCols;
+
+    if (bestWork == 0xFFFFFFFF || rowId >= bestRows) {
+        tile->rowStart = 0;
+        tile->rowEnd = 0;
+        tile->colStart = 0;
+        tile->colEnd = 0;
+        return;
+    }
+
+    // balanced split, the first (M % bestRows) row blocks get one row more
+    uint32_t rowStep = M / bestRows;
+    uint32_t rowRem = M % bestRows;
+    uint32_t colStep = nCols / bestCols;
+    uint32_t colRem = nCols % bestCols;
+
+    tile->rowStart = rowId * rowStep + ((rowId < rowRem) ? rowId : rowRem);
+    tile->rowEnd = tile->rowStart + rowStep + ((rowId < rowRem) ? 1 : 0);
+    tile->colStart = (colId * colStep + ((colId < colRem) ? colId : colRem)) * colBlock;
+    tile->colEnd = tile->colStart + (colStep + ((colId < colRem) ? 1 : 0)) * colBlock;
+    if (tile->colEnd > O) {
+        tile->colEnd = O;
+    }
+}
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_i32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32_parallel(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               uint32_t nPE,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for parallel dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes     output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32_parallel(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t nPE,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with interleaved access of 32-bit integer vectors kernel for XPULPV2
+    extension.
+    @param[in]  S     points to the instance structure for integer parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_i32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with interleaved access of 32-bit fixed point vectors kernel for
+    XPULPV2 extension.
+    @param[in]  S     points to the instance structure for fixed point parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_q32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Parallel dot product with interleaved access of 32-bit float vectors kernel for XPULPV2
+    extension.
+    @param[in]  S     points to the instance structure for float parallel dot product
+    @return     none
+*/
+
+void plp_dot_prod_f32p_xpulpv2(void *S);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+*/
+void plp_dot_prod_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
+                      const int32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      uint32_t deciPoint,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32s_rv32im(const int32_t *__restrict__ pSrcA,
+                              const int32_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 32-bit fixed point vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                               const int32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
+                      const float32_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
+    @param[in]  pSrcA      points to the first input vector
+    @param[in]  pSrcB      points to the second input vector
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 32-bit float vectors.
     @param[in]  pSrcA      points to the first input vector
     @param[in]  pSrcB      points to the second input vector
     @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
+    @param[out] pRes       output result returned here
+    @return     none
+*/
+
+void plp_dot_prod_f32s_rv32im(const float32_t *__restrict__ pSrcA,
+                               const float32_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pRes);
+
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 16-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+void plp_dot_prod_i16(const int16_t *pSrcA,
+                      const int16_t *pSrcB,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
+    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_i16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit integer vectors kernel singlecore for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors.
+*/
+
+void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 16-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
+                      const int16_t *__restrict__ pSrcB,
+                      uint32_t blockSize,
+                      uint32_t deciPoint,
+                      int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 16-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
+    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
+    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_q16s_rv32im(const int16_t *__restrict__ pSrcA,
+                              const int16_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 16-bit fixed point vectors singlecore kernel for XPULPV2
+   extension.
+    @param[in]  pSrcA      points to the first input vector [16 bit]
+    @param[in]  pSrcB      points to the second input vector [16 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
+    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
+                               const int16_t *__restrict__ pSrcB,
+                               uint32_t blockSize,
+                               uint32_t deciPoint,
+                               int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 8-bit integer vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8] bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_i8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Vectorized dot product of 8-bit integer vectors singlecore kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Glue code for dot product of 8-bit fixed point vectors.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q8(const int8_t *__restrict__ pSrcA,
+                     const int8_t *__restrict__ pSrcB,
+                     uint32_t blockSize,
+                     uint32_t deciPoint,
+                     int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 8-bit fixed point vectors kernel for RV32IM extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
+    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
+    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
+*/
+
+void plp_dot_prod_q8s_rv32im(const int8_t *__restrict__ pSrcA,
+                             const int8_t *__restrict__ pSrcB,
+                             uint32_t blockSize,
+                             uint32_t deciPoint,
+                             int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief Scalar dot product of 8-bit fixed point vectors singlecore kernel for XPULPV2 extension.
+    @param[in]  pSrcA      points to the first input vector [8 bit]
+    @param[in]  pSrcB      points to the second input vector [8 bit]
+    @param[in]  blockSize  number of samples in each vector
+    @param[in]  deciPoint  decimal point for right shift
+    @param[out] pRes       output result returned here [32 bit]
+    @return     none
+
+    @par Exploiting SIMD instructions
+    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
+    performed on 32 bit vectors, with 32 bit accumulator.
+*/
+
+void plp_dot_prod_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
+                              const int8_t *__restrict__ pSrcB,
+                              uint32_t blockSize,
+                              uint32_t deciPoint,
+                              int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 32-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32(const int32_t * pSrc,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 32-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32s_rv32im(const int32_t * pSrc,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 32-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i32s_xpulpv2(const int32_t * pSrc,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 16-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16(const int16_t * pSrc,
+                 int16_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16s_rv32im(const int16_t * pSrc,
+                         int16_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i16s_xpulpv2(const int16_t * pSrc,
+                          int16_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Glue code for absolute value of 8-bit integer vectors.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8(const int8_t * pSrc,
+                 int8_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8s_rv32im(const int8_t * pSrc,
+                         int8_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+   @brief Element-by-element absolute value of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[out]    pDst       points to the output vector
+   @param[in]     blockSize  number of samples in each vector
+   @return        none
+*/
+
+void plp_abs_i8s_xpulpv2(const int8_t * pSrc,
+                          int8_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32(const int32_t * pSrcA,
+                 const int32_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32s_rv32im(const int32_t * pSrcA,
+                         const int32_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i32s_xpulpv2(const int32_t * pSrcA,
+                          const int32_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16(const int16_t * pSrcA,
+                 const int16_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16s_rv32im(const int16_t * pSrcA,
+                         const int16_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i16s_xpulpv2(const int16_t * pSrcA,
+                          const int16_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element addition of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8(const int8_t * pSrcA,
+                 const int8_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8s_rv32im(const int8_t * pSrcA,
+                         const int8_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element addition of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_add_i8s_xpulpv2(const int8_t * pSrcA,
+                          const int8_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 32-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32(const int32_t * pSrcA,
+                 const int32_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32s_rv32im(const int32_t * pSrcA,
+                         const int32_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i32s_xpulpv2(const int32_t * pSrcA,
+                          const int32_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 16-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16(const int16_t * pSrcA,
+                 const int16_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 16-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16s_rv32im(const int16_t * pSrcA,
+                         const int16_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i16s_xpulpv2(const int16_t * pSrcA,
+                          const int16_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Glue code for element-by-element multiplication of 8-bit integer vectors.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8(const int8_t * pSrcA,
+                 const int8_t * pSrcB,
+                 int32_t * pDst,
+                 uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 8-bit integer vectors kernel for RV32IM extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8s_rv32im(const int8_t * pSrcA,
+                         const int8_t * pSrcB,
+                         int32_t * pDst,
+                         uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief Element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]     pSrcA      points to first input vector
+    @param[in]     pSrcB      points to second input vector
+    @param[out]    pDst       points to output vector
+    @param[in]     blockSize  number of samples in each vector
+    @return        none
+*/
+
+void plp_mult_i8s_xpulpv2(const int8_t * pSrcA,
+                          const int8_t * pSrcB,
+                          int32_t * pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for filling a constant value into a 32-bit integer vector.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Fills a constant value into a 32-bit integer vector for RV32IM extension.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32s_rv32im(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Fills a constant value into a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  value      input value to be filled
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_fill_i32s_xpulpv2(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for copying the elements of a 32-bit integer vector
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32s_rv32im(int32_t *__restrict__ pSrc,
+                          int32_t *__restrict__ pDst,
+                          uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_i32s_xpulpv2(int32_t *__restrict__ pSrc,
+                           int32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for copying the elements of a 32-bit float vector
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32(float32_t *__restrict__ pSrc, float32_t *__restrict__ pDst, uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32s_xpulpv2(float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to input vector
+    @param[out] pDst       points to output vector
+    @param[in]  blockSize  number of samples in each vector
+    @return     none
+*/
+
+void plp_copy_f32s_rv32im(float32_t *__restrict__ pSrc,
+                           float32_t *__restrict__ pDst,
+                           uint32_t blockSize);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for mean value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i32_parallel(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i32 struct
+    @return     none
+*/
+
+void plp_mean_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i16_parallel(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i16 struct
+    @return     none
+*/
+
+void plp_mean_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_i8_parallel(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i8 struct
+    @return     none
+*/
+
+void plp_mean_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel mean value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       mean value returned here
+    @return     none
+*/
+
+void plp_mean_f32_parallel(const float *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_f32 struct
+    @return     none
+*/
+
+void plp_mean_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for max value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    max value returned here
+    @return     none
+*/
+
+void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    max value returned here
+    @return     none
+*/
+
+void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel max value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_i32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel max value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i32 struct
+    @return     none
+*/
+
+void plp_max_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel max value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_i16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel max value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i16 struct
+    @return     none
+*/
+
+void plp_max_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel max value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_i8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel max value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i8 struct
+    @return     none
+*/
+
+void plp_max_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel max value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       max value returned here
+    @return     none
+*/
+
+void plp_max_f32_parallel(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel max value of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_f32 struct
+    @return     none
+*/
+
+void plp_max_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for min value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    min value returned here
+    @return     none
+*/
+
+void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    min value returned here
+    @return     none
+*/
+
+void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel min value of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_i32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel min value of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i32 struct
+    @return     none
+*/
+
+void plp_min_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel min value of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_i16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel min value of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i16 struct
+    @return     none
+*/
+
+void plp_min_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel min value of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_i8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel min value of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i8 struct
+    @return     none
+*/
+
+void plp_min_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel min value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       min value returned here
+    @return     none
+*/
+
+void plp_min_f32_parallel(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel min value of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_f32 struct
+    @return     none
+*/
+
+void plp_min_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32s_xpulpv2(const float *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes    Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32(const int32_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16(const int16_t *__restrict__ pSrc,
+                   uint32_t blockSize,
+                   uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8(const int8_t *__restrict__ pSrc,
+                  uint32_t blockSize,
+                  uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Sum of squares value returned here
+    @return     none
+*/
+
+void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 32-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i32 struct
+    @return     none
+*/
+
+void plp_power_i32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 16-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i16_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 16-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i16 struct
+    @return     none
+*/
+
+void plp_power_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 8-bit integer vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_i8_parallel(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 8-bit integer vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i8 struct
+    @return     none
+*/
+
+void plp_power_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q32_parallel(const int32_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i32 struct
+    @return     none
+*/
+
+void plp_power_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q16_parallel(const int16_t *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i16 struct
+    @return     none
+*/
+
+void plp_power_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_q8_parallel(const int8_t *__restrict__ pSrc,
+                           uint32_t blockSize,
+                           uint32_t fracBits,
+                           uint32_t nPE,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_i8 struct
+    @return     none
+*/
+
+void plp_power_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel sum of squares of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       sum of squares returned here
+    @return     none
+*/
+
+void plp_power_f32_parallel(const float *__restrict__ pSrc,
+                            uint32_t blockSize,
+                            uint32_t nPE,
+                            float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel sum of squares of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_stats_instance_f32 struct
+    @return     none
+*/
+
+void plp_power_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance value returned here
+    @return     none
+*/
+
+void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical variance returned here
+    @return     none
+*/
+
+void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical variance value returned here
+    @return     none
+*/
+
+void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Partial variance statistics of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       partial statistics returned here
+    @return     none
+*/
+
+void plp_var_partial_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  plp_var_partial_f32 *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel variance kernel of a 32-bit float vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_var_instance_f32 struct initialized by plp_var_f32_parallel
+    @return     none
+*/
+
+void plp_var_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Partial variance statistics of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  ref        reference sample, which is subtracted from all samples
+    @param[out] pRes       partial statistics returned here
+    @return     none
+*/
+
+void plp_var_partial_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int32_t ref,
+                                 plp_var_partial_q *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Partial variance statistics of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  ref        reference sample, which is subtracted from all samples
+    @param[out] pRes       partial statistics returned here
+    @return     none
+*/
+
+void plp_var_partial_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int32_t ref,
+                                  plp_var_partial_q *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel variance kernel of a 32-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_var_instance_q32 struct initialized by plp_var_q32_parallel
+    @return     none
+*/
+
+void plp_var_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Partial variance statistics of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       partial statistics returned here
+    @return     none
+*/
+
+void plp_var_partial_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 plp_var_partial_q *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Partial variance statistics of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       partial statistics returned here
+    @return     none
+*/
+
+void plp_var_partial_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  plp_var_partial_q *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel variance kernel of a 16-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_var_instance_q16 struct initialized by plp_var_q16_parallel
+    @return     none
+*/
+
+void plp_var_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Partial variance statistics of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       partial statistics returned here
+    @return     none
+*/
+
+void plp_var_partial_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                                uint32_t blockSize,
+                                plp_var_partial_q *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Partial variance statistics of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       partial statistics returned here
+    @return     none
+*/
+
+void plp_var_partial_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 plp_var_partial_q *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel variance of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       variance returned here
+    @return     none
+*/
+
+void plp_var_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Parallel variance kernel of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  args  pointer to plp_var_instance_q8 struct initialized by plp_var_q8_parallel
+    @return     none
+*/
+
+void plp_var_q8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+    @brief      Merges the partial variance statistics of two blocks of a 32-bit float vector.
+    @param[in,out] pA  partial statistics of the first block, replaced by the merged ones
+    @param[in]     pB  partial statistics of the second block
+    @return     none
+
+    @par
+    Pairwise update of Chan et al.: with delta = meanB - meanA, the merged mean is
+    meanA + delta * nB / n and M2 = M2A + M2B + delta^2 * nA * nB / n.
+*/
+static inline void plp_var_merge_f32(plp_var_partial_f32 *pA, const plp_var_partial_f32 *pB) {
+
+    if (pB->count == 0) {
+        return;
+    }
+
+    uint32_t count = pA->count + pB->count;
+    float32_t delta = pB->mean - pA->mean;
+    float32_t weight = (float32_t)pB->count / (float32_t)count;
+
+    pA->mean += delta * weight;
+    pA->m2 += pB->m2 + delta * delta * (float32_t)pA->count * weight;
+    pA->count = count;
+}
+
+/** -------------------------------------------------------
+    @brief      Merges the partial variance statistics of two blocks of a fixed point vector.
+    @param[in,out] pA  partial statistics of the first block, replaced by the merged ones
+    @param[in]     pB  partial statistics of the second block, with the same reference
+    @return     none
+*/
+static inline void plp_var_merge_q(plp_var_partial_q *pA, const plp_var_partial_q *pB) {
+    pA->count += pB->count;
+    pA->sum += pB->sum;
+    pA->sumSq += pB->sumSq;
+    pA->sumSqHi += pB->sumSqHi + (pA->sumSq < pB->sumSq);
+}
+
+/** -------------------------------------------------------
+    @brief      Variance from the partial statistics of a fixed point vector.
+    @param[in]  p         partial statistics of the whole vector
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     floor(M2 / (count * 2^fracBits)), i.e. the variance in the format of the input,
+                before saturation
+
+    @par
+    M2 = sumSq - sum^2 / count is computed exactly with 96-bit integers: with
+    sum = q * count + r, sum^2 / count = q^2 * count + 2 * q * r + r^2 / count. Since the variance
+    fits 64 bits, M2 / count is divided in two steps of 32 bits.
+*/
+static inline uint64_t plp_var_result_q(const plp_var_partial_q *p, const uint32_t fracBits) {
+
+    if (p->count == 0) {
+        return 0;
+    }
+
+    uint32_t n = p->count;
+    int64_t q = p->sum / (int64_t)n;
+    int64_t r = p->sum - q * (int64_t)n;
+    uint64_t absQ = (uint64_t)((q < 0) ? -q : q);
+
+    /* (hi, lo) = q^2 * count + 2 * q * r + ceil(r^2 / count), where q and r have the same sign */
+    uint64_t q2 = absQ * absQ;
+    uint64_t prodLo = (q2 & 0xFFFFFFFFU) * n;
+    uint64_t prodHi = (q2 >> 32) * n;
+    uint64_t lo = prodLo + (prodHi << 32);
+    uint32_t hi = (uint32_t)(prodHi >> 32) + (lo < prodLo);
+    uint64_t t = (uint64_t)(2 * q * r) + ((uint64_t)(r * r) + n - 1) / n;
+    lo += t;
+    hi += (lo < t);
+
+    /* M2 = sumSq - (hi, lo) */
+    uint32_t m2Hi = p->sumSqHi - hi - (p->sumSq < lo);
+    uint64_t m2Lo = p->sumSq - lo;
+
+    /* M2 / count, where m2Hi < count */
+    uint64_t rem = ((uint64_t)m2Hi << 32) | (m2Lo >> 32);
+    uint64_t varHi = rem / n;
+    rem = ((rem % n) << 32) | (m2Lo & 0xFFFFFFFFU);
+    uint64_t varLo = rem / n;
+
+    return ((varHi << 32) + varLo) >> fracBits;
+}
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
+*/
+
+void plp_std_f32_parallel(const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input and output
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       standard deviation returned here
+    @return     none
+*/
+
+void plp_std_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_f32s_xpulpv2(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q32(const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16(const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 uint32_t fracBits,
+                 int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
+    extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q8(const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                uint32_t fracBits,
+                int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pResult    Statisical standard deviation returned here
+    @return     none
+*/
+
+void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        uint32_t fracBits,
+                        int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[out] pRes       Statisical standard deviation value returned here
+    @return     none
+*/
+
+void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel RMS value of a 32-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       RMS value returned here
+    @return     none
+*/
+
+void plp_rms_q32_parallel(const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel RMS value of a 16-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       RMS value returned here
+    @return     none
+*/
+
+void plp_rms_q16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t fracBits,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel RMS value of a 8-bit fixed point vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  fracBits   number of fractional bits of the input
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       RMS value returned here
+    @return     none
+*/
+
+void plp_rms_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for parallel RMS value of a 32-bit float vector.
+    @param[in]  pSrc       points to the input vector
+    @param[in]  blockSize  number of samples in input vector
+    @param[in]  nPE        number of parallel processing units
+    @param[out] pRes       RMS value returned here
+    @return     none
+*/
+
+void plp_rms_f32_parallel(const float *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for square root of a 32-bit fixed point number.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   32-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for square root of a 16-bit fixed point number.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
+                  const uint32_t fracBits,
+                  int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
+    @return     none
+*/
+
+void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                          const uint32_t fracBits,
+                          int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  in   16-Bit input integer
+    @param[out] out  Square root of the input
     @return     none
 */
 
-void plp_dot_prod_q32(const int32_t *__restrict__ pSrcA,
-                      const int32_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      uint32_t deciPoint,
-                      int32_t *__restrict__ pRes);
+void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pRes);
+
+
+/**
+   @brief         Glue code for square root of a 32-bit floating point number.
+   @param[in]     pSrc       points to the input vectoro
+   @param[out]    pRes    Square root returned here
+   @return        none
+ */
+
+void plp_sqrt_f32(const float *__restrict__ pSrc, 
+                  float *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for reciprocal square root of a 32-bit fixed point number.
+    @param[in]  pSrc      points to the input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @param[out] pRes      reciprocal square root of the input
+    @return     none
+*/
+
+void plp_rsqrt_q32(const int32_t *__restrict__ pSrc,
+                   const uint32_t fracBits,
+                   int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal square root of a 32-bit fixed point number for RV32IM extension.
+    @param[in]  pSrc      points to the input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @param[out] pRes      reciprocal square root of the input
+    @return     none
+*/
+
+void plp_rsqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal square root of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  pSrc      points to the input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @param[out] pRes      reciprocal square root of the input
+    @return     none
+*/
+
+void plp_rsqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                            const uint32_t fracBits,
+                            int32_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Glue code for reciprocal square root of a 16-bit fixed point number.
+    @param[in]  pSrc      points to the input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @param[out] pRes      reciprocal square root of the input
+    @return     none
+*/
+
+void plp_rsqrt_q16(const int16_t *__restrict__ pSrc,
+                   const uint32_t fracBits,
+                   int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal square root of a 16-bit fixed point number for RV32IM extension.
+    @param[in]  pSrc      points to the input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @param[out] pRes      reciprocal square root of the input
+    @return     none
+*/
+
+void plp_rsqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pRes);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal square root of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  pSrc      points to the input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @param[out] pRes      reciprocal square root of the input
+    @return     none
+*/
+
+void plp_rsqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                            const uint32_t fracBits,
+                            int16_t *__restrict__ pRes);
+
+/**
+ * @brief Table of initial estimates for the fixed point (reciprocal) square roots
+ */
+
+#define RSQRT_TABLE_SIZE 48
+
+extern const uint16_t rsqrtTable_q16[RSQRT_TABLE_SIZE];
+
+/** -------------------------------------------------------
+    @brief      Reciprocal square root of a normalized number.
+    @param[in]  m     input in Q2.30, must be in [1, 4)
+    @param[in]  iter  number of Newton iterations, 2 give 22 and 3 give 30 correct bits
+    @return     1/sqrt(m) in Q1.31
+
+    @par
+    The 6 most significant bits of m select an initial estimate with 6 correct bits from
+    rsqrtTable_q16, which is refined with the Newton iteration r = r * (3 - m * r^2) / 2. No step
+    depends on the value of m, hence the latency is constant.
+*/
+static inline uint32_t plp_rsqrt_norm_q32(const uint32_t m, const uint32_t iter) {
+
+    uint32_t r = (uint32_t)rsqrtTable_q16[(m >> 26) - 16] << 15;
+    uint32_t r2, mr2;
+
+    for (uint32_t i = 0; i < iter; i++) {
+        r2 = (uint32_t)(((uint64_t)r * r) >> 31);                 // r^2 in Q1.31
+        mr2 = (uint32_t)(((uint64_t)m * r2) >> 31);               // m * r^2 in Q2.30
+        r = (uint32_t)(((uint64_t)r * ((3U << 30) - mr2)) >> 31); // Q1.31
+    }
+
+    return r;
+}
+
+/** -------------------------------------------------------
+    @brief      Square root of a 32-bit fixed point number with constant latency.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     floor(sqrt(x * 2^fracBits)), i.e. the square root in the format of the input, or
+                0 for x <= 0
+
+    @par
+    Count leading zeros normalizes the input to m = x * 2^s in [1, 4), with s chosen such that
+    fracBits - s is even. Then, the result is m * rsqrt(m) * 2^(15 + (fracBits - s) / 2), using
+    three Newton iterations for rsqrt(m). This estimate is at most 2 below and 3 above the exact
+    result, which is found with three branch-free correction steps.
+*/
+static inline int32_t plp_sqrt_core_q32(const int32_t x, const uint32_t fracBits) {
+
+    if (x <= 0) {
+        return 0;
+    }
+
+    uint32_t n = __builtin_clz(x);
+    uint32_t s = n - ((fracBits - n) & 1);            // fracBits - s is even
+    uint32_t m = (uint32_t)x << s;                    // Q2.30 in [1, 4)
+    uint32_t k = 15 + ((int32_t)(fracBits - s) >> 1); // result = sqrt(m) * 2^k
+    uint32_t root = (uint32_t)(((uint64_t)m * plp_rsqrt_norm_q32(m, 3)) >> 31);
+    uint64_t arg = (uint64_t)x << fracBits;
+    int64_t y = (int64_t)(root >> (30 - k)) - 3;
+    int64_t t;
+
+    t = y + 4;
+    y = ((uint64_t)(t * t) <= arg) ? t : y;
+    t = y + 2;
+    y = ((uint64_t)(t * t) <= arg) ? t : y;
+    t = y + 1;
+    y = ((uint64_t)(t * t) <= arg) ? t : y;
+
+    return (int32_t)y;
+}
+
+/** -------------------------------------------------------
+    @brief      Square root of a 16-bit fixed point number with constant latency.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     floor(sqrt(x * 2^fracBits)), i.e. the square root in the format of the input, or
+                0 for x <= 0
+
+    @par
+    Same as plp_sqrt_core_q32, but two Newton iterations suffice for a 16-bit result. The
+    estimate is at most 1 below the exact result, which takes one correction step.
+*/
+static inline int16_t plp_sqrt_core_q16(const int16_t x, const uint32_t fracBits) {
+
+    if (x <= 0) {
+        return 0;
+    }
+
+    uint32_t n = __builtin_clz(x);
+    uint32_t s = n - ((fracBits - n) & 1);            // fracBits - s is even
+    uint32_t m = (uint32_t)x << s;                    // Q2.30 in [1, 4)
+    uint32_t k = 15 + ((int32_t)(fracBits - s) >> 1); // result = sqrt(m) * 2^k
+    uint32_t root = (uint32_t)(((uint64_t)m * plp_rsqrt_norm_q32(m, 2)) >> 31);
+    uint32_t arg = (uint32_t)x << fracBits;
+    uint32_t y = root >> (30 - k);
+    uint32_t t = y + 1;
+
+    y = (t * t <= arg) ? t : y;
+
+    return (int16_t)y;
+}
+
+/** -------------------------------------------------------
+    @brief      Integer square root of an unsigned 32-bit number with constant latency.
+    @param[in]  x  input value, at most 2^31
+    @return     floor(sqrt(x))
+
+    @par
+    The input is normalized to m = x * 2^s in [1, 4) with an even shift s, and the result is
+    m * rsqrt(m) * 2^(15 - s / 2), using two Newton iterations. This estimate is at most 1 away from
+    the exact result, which is found with two branch-free correction steps.
+*/
+static inline uint32_t plp_sqrt_core_u32(const uint32_t x) {
+
+    if (x == 0) {
+        return 0;
+    }
+
+    uint32_t s = __builtin_clz(x) & ~0x1U; // s is even
+    uint32_t m = x << s;                   // Q2.30 in [1, 4)
+    uint32_t root = (uint32_t)(((uint64_t)m * plp_rsqrt_norm_q32(m, 2)) >> 31);
+    uint32_t y = (root >> (15 + (s >> 1))) + 1;
+
+    y = (y * y > x) ? y - 1 : y;
+    y = (y * y > x) ? y - 1 : y;
+
+    return y;
+}
+
+/** -------------------------------------------------------
+    @brief      Integer square root of an unsigned 64-bit number with constant latency.
+    @param[in]  x  input value, at most 2^63
+    @return     floor(sqrt(x))
+
+    @par
+    Same as plp_sqrt_core_u32, but with the 32 most significant bits of the normalized input and
+    three Newton iterations. The estimate is at most 4 away from the exact result, which is found
+    with four branch-free correction steps.
+*/
+static inline uint32_t plp_sqrt_core_u64(const uint64_t x) {
+
+    if (x == 0) {
+        return 0;
+    }
+
+    uint32_t s = __builtin_clzll(x) & ~0x1U;    // s is even
+    uint32_t m = (uint32_t)((x << s) >> 32);    // Q2.30 in [1, 4)
+    uint32_t root = (uint32_t)(((uint64_t)m * plp_rsqrt_norm_q32(m, 3)) >> 31);
+    uint64_t y = (((uint64_t)root) << 1) >> (s >> 1);
+    uint64_t t;
+
+    y = (y > 8) ? y - 8 : 0;
+    t = y + 8;
+    y = (t * t <= x) ? t : y;
+    t = y + 4;
+    y = (t * t <= x) ? t : y;
+    t = y + 2;
+    y = (t * t <= x) ? t : y;
+    t = y + 1;
+    y = (t * t <= x) ? t : y;
+
+    return (uint32_t)y;
+}
+
+/** -------------------------------------------------------
+    @brief      Reciprocal square root of a 32-bit fixed point number with constant latency.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @param[in]  iter      number of Newton iterations, 3 for 32-bit and 2 for 16-bit results
+    @return     2^fracBits / sqrt(x * 2^-fracBits), truncated, i.e. the reciprocal square root in
+                the format of the input. Saturates to 0x7FFFFFFF, which is also returned for
+                x <= 0.
+
+    @par
+    The input is normalized as in plp_sqrt_core_q32, the result is rsqrt(m) shifted by
+    (3 * fracBits + s - 92) / 2.
+*/
+static inline int32_t plp_rsqrt_core_q32(const int32_t x,
+                                         const uint32_t fracBits,
+                                         const uint32_t iter) {
+
+    if (x <= 0) {
+        return 0x7FFFFFFF;
+    }
+
+    uint32_t n = __builtin_clz(x);
+    uint32_t s = n - ((fracBits - n) & 1); // fracBits - s is even
+    uint32_t r = plp_rsqrt_norm_q32((uint32_t)x << s, iter);
+    int32_t shift = (92 - (int32_t)(3 * fracBits + s)) >> 1;
+
+    if (shift < 0) {
+        return 0x7FFFFFFF;
+    }
+    r = (shift > 31) ? 0 : (r >> shift);
+
+    return (r > 0x7FFFFFFF) ? 0x7FFFFFFF : (int32_t)r;
+}
+
+
+/** -------------------------------------------------------
+    @brief      Glue code for inverse tangent of a 32-bit fixed point number.
+    @param[in]  y  y coordinate, in any format
+    @param[in]  x  x coordinate, in the format of y
+    @return     atan2(y, x) / pi in Q1.31
+*/
+
+int32_t plp_atan2_q32(int32_t y, int32_t x);
+
+/** -------------------------------------------------------
+    @brief      Inverse tangent of a 32-bit fixed point number for RV32IM extension.
+    @param[in]  y  y coordinate, in any format
+    @param[in]  x  x coordinate, in the format of y
+    @return     atan2(y, x) / pi in Q1.31
+*/
+
+int32_t plp_atan2_q32s_rv32im(int32_t y, int32_t x);
+
+/** -------------------------------------------------------
+    @brief      Inverse tangent of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  y  y coordinate, in any format
+    @param[in]  x  x coordinate, in the format of y
+    @return     atan2(y, x) / pi in Q1.31
+*/
+
+int32_t plp_atan2_q32s_xpulpv2(int32_t y, int32_t x);
+
+/** -------------------------------------------------------
+    @brief      Glue code for inverse tangent of a 16-bit fixed point number.
+    @param[in]  y  y coordinate, in any format
+    @param[in]  x  x coordinate, in the format of y
+    @return     atan2(y, x) / pi in Q1.15
+*/
+
+int16_t plp_atan2_q16(int16_t y, int16_t x);
+
+/** -------------------------------------------------------
+    @brief      Inverse tangent of a 16-bit fixed point number for RV32IM extension.
+    @param[in]  y  y coordinate, in any format
+    @param[in]  x  x coordinate, in the format of y
+    @return     atan2(y, x) / pi in Q1.15
+*/
+
+int16_t plp_atan2_q16s_rv32im(int16_t y, int16_t x);
+
+/** -------------------------------------------------------
+    @brief      Inverse tangent of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  y  y coordinate, in any format
+    @param[in]  x  x coordinate, in the format of y
+    @return     atan2(y, x) / pi in Q1.15
+*/
+
+int16_t plp_atan2_q16s_xpulpv2(int16_t y, int16_t x);
+
+/** -------------------------------------------------------
+    @brief      Glue code for inverse tangent of a 32-bit floating point number.
+    @param[in]  y  y coordinate
+    @param[in]  x  x coordinate
+    @return     atan2(y, x) in radians
+*/
+
+float32_t plp_atan2_f32(float32_t y, float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Inverse tangent of a 32-bit floating point number for XPULPV2 extension.
+    @param[in]  y  y coordinate
+    @param[in]  x  x coordinate
+    @return     atan2(y, x) in radians
+*/
+
+float32_t plp_atan2_f32s_xpulpv2(float32_t y, float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Glue code for exponential of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     exp(x) in the format of the input
+*/
+
+int32_t plp_exp_q32(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Exponential of a 32-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     exp(x) in the format of the input
+*/
+
+int32_t plp_exp_q32s_rv32im(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Exponential of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     exp(x) in the format of the input
+*/
+
+int32_t plp_exp_q32s_xpulpv2(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for exponential of a 16-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     exp(x) in the format of the input
+*/
+
+int16_t plp_exp_q16(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Exponential of a 16-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     exp(x) in the format of the input
+*/
+
+int16_t plp_exp_q16s_rv32im(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Exponential of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     exp(x) in the format of the input
+*/
+
+int16_t plp_exp_q16s_xpulpv2(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for exponential of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     exp(x)
+*/
+
+float32_t plp_exp_f32(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Exponential of a 32-bit floating point number for XPULPV2 extension.
+    @param[in]  x  input value
+    @return     exp(x)
+*/
+
+float32_t plp_exp_f32s_xpulpv2(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Glue code for natural logarithm of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     log(x) in the format of the input
+*/
+
+int32_t plp_log_q32(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Natural logarithm of a 32-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     log(x) in the format of the input
+*/
+
+int32_t plp_log_q32s_rv32im(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Natural logarithm of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     log(x) in the format of the input
+*/
+
+int32_t plp_log_q32s_xpulpv2(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for natural logarithm of a 16-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     log(x) in the format of the input
+*/
+
+int16_t plp_log_q16(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Natural logarithm of a 16-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     log(x) in the format of the input
+*/
+
+int16_t plp_log_q16s_rv32im(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Natural logarithm of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     log(x) in the format of the input
+*/
+
+int16_t plp_log_q16s_xpulpv2(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for natural logarithm of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     log(x)
+*/
+
+float32_t plp_log_f32(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Natural logarithm of a 32-bit floating point number for XPULPV2 extension.
+    @param[in]  x  input value
+    @return     log(x)
+*/
+
+float32_t plp_log_f32s_xpulpv2(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Glue code for reciprocal of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     1 / x in the format of the input
+*/
+
+int32_t plp_recip_q32(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal of a 32-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     1 / x in the format of the input
+*/
+
+int32_t plp_recip_q32s_rv32im(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     1 / x in the format of the input
+*/
+
+int32_t plp_recip_q32s_xpulpv2(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for reciprocal of a 16-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     1 / x in the format of the input
+*/
+
+int16_t plp_recip_q16(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal of a 16-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     1 / x in the format of the input
+*/
+
+int16_t plp_recip_q16s_rv32im(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     1 / x in the format of the input
+*/
+
+int16_t plp_recip_q16s_xpulpv2(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for reciprocal of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     1 / x
+*/
+
+float32_t plp_recip_f32(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal of a 32-bit floating point number for XPULPV2 extension.
+    @param[in]  x  input value
+    @return     1 / x
+*/
+
+float32_t plp_recip_f32s_xpulpv2(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Glue code for hyperbolic tangent of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     tanh(x) in the format of the input
+*/
+
+int32_t plp_tanh_q32(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Hyperbolic tangent of a 32-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     tanh(x) in the format of the input
+*/
+
+int32_t plp_tanh_q32s_rv32im(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Hyperbolic tangent of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     tanh(x) in the format of the input
+*/
+
+int32_t plp_tanh_q32s_xpulpv2(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for hyperbolic tangent of a 16-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     tanh(x) in the format of the input
+*/
+
+int16_t plp_tanh_q16(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Hyperbolic tangent of a 16-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     tanh(x) in the format of the input
+*/
+
+int16_t plp_tanh_q16s_rv32im(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Hyperbolic tangent of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     tanh(x) in the format of the input
+*/
+
+int16_t plp_tanh_q16s_xpulpv2(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for hyperbolic tangent of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     tanh(x)
+*/
+
+float32_t plp_tanh_f32(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Hyperbolic tangent of a 32-bit floating point number for XPULPV2 extension.
+    @param[in]  x  input value
+    @return     tanh(x)
+*/
+
+float32_t plp_tanh_f32s_xpulpv2(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Glue code for logistic sigmoid of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     1 / (1 + exp(-x)) in the format of the input
+*/
+
+int32_t plp_sigmoid_q32(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Logistic sigmoid of a 32-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     1 / (1 + exp(-x)) in the format of the input
+*/
+
+int32_t plp_sigmoid_q32s_rv32im(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Logistic sigmoid of a 32-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output
+    @return     1 / (1 + exp(-x)) in the format of the input
+*/
+
+int32_t plp_sigmoid_q32s_xpulpv2(int32_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for logistic sigmoid of a 16-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     1 / (1 + exp(-x)) in the format of the input
+*/
+
+int16_t plp_sigmoid_q16(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Logistic sigmoid of a 16-bit fixed point number for RV32IM extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     1 / (1 + exp(-x)) in the format of the input
+*/
+
+int16_t plp_sigmoid_q16s_rv32im(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Logistic sigmoid of a 16-bit fixed point number for XPULPV2 extension.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+    @return     1 / (1 + exp(-x)) in the format of the input
+*/
+
+int16_t plp_sigmoid_q16s_xpulpv2(int16_t x, uint32_t fracBits);
+
+/** -------------------------------------------------------
+    @brief      Glue code for logistic sigmoid of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     1 / (1 + exp(-x))
+*/
+
+float32_t plp_sigmoid_f32(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Logistic sigmoid of a 32-bit floating point number for XPULPV2 extension.
+    @param[in]  x  input value
+    @return     1 / (1 + exp(-x))
+*/
+
+float32_t plp_sigmoid_f32s_xpulpv2(float32_t x);
+
+/** -------------------------------------------------------
+    @brief      Reciprocal of a normalized number.
+    @param[in]  m  input in Q1.31 as unsigned number, must be in [1, 2)
+    @return     1/m in Q1.31 as unsigned number, in (0.5, 1]
+
+    @par
+    The linear estimate 24/17 - 8/17 * m has 4 correct bits and is refined with three Newton
+    iterations r = r * (2 - m * r) to 30 bits. The result never exceeds 1/m.
+*/
+static inline uint32_t plp_recip_norm_q32(const uint32_t m) {
+
+    uint32_t r = 3031741620U - (uint32_t)(((uint64_t)1010580540U * m) >> 31);
+    uint32_t mr;
+
+    for (uint32_t i = 0; i < 3; i++) {
+        mr = (uint32_t)(((uint64_t)m * r) >> 32) + 1;            // m * r in Q2.30, rounded up
+        r = (uint32_t)(((uint64_t)r * ((1U << 31) - mr)) >> 30); // Q1.31
+    }
+
+    return r;
+}
+
+/** -------------------------------------------------------
+    @brief      Power of two of a fixed point number.
+    @param[in]  t  exponent with q fractional bits
+    @param[in]  q  number of fractional bits of t, in [30, 61]
+    @param[out] n  integer part of t rounded towards minus infinity, clipped to [-64, 64]
+    @return     2^(t - floor(t)) in Q2.30, in [1, 2)
+
+    @par
+    The fractional part is evaluated with a polynomial of degree 7, whose error is below 2^-31.
+*/
+static inline uint32_t plp_exp2_split_q32(const int64_t t, const uint32_t q, int32_t *n) {
+
+    const int32_t coef[8] = { 1073741824, 744261126, 257941088, 59598353,
+                              10322455,   1442015,   153539,    23248 };
+    int64_t intPart = t >> q;
+    int32_t r, p;
+
+    // fractional part in Q1.31
+    r = (int32_t)(((uint64_t)(t - (intPart << q)) << 1) >> (q - 30));
+    *n = (intPart > 64) ? 64 : ((intPart < -64) ? -64 : (int32_t)intPart);
+
+    p = coef[7];
+    for (int32_t i = 6; i > 0; i--) {
+        p = coef[i] + (int32_t)(((int64_t)p * r) >> 31);
+    }
+
+    return (uint32_t)coef[0] + (uint32_t)(((int64_t)p * r) >> 31);
+}
+
+/** -------------------------------------------------------
+    @brief      Exponential function of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 31
+    @return     exp(x) in the format of the input, saturated to 0x7FFFFFFF
+
+    @par
+    exp(x) = 2^(x * log2(e)) is split into a power of two and 2^r with r in [0, 1), which
+    is evaluated by plp_exp2_split_q32. The relative error is below 2^-28, in addition to the
+    rounding to the output format.
+*/
+static inline int32_t plp_exp_core_q32(const int32_t x, const uint32_t fracBits) {
+
+    int32_t n, shift;
+    uint32_t p = plp_exp2_split_q32((int64_t)x * 1549082005, fracBits + 30, &n); // log2(e)
+
+    shift = 30 - n - (int32_t)fracBits; // exp(x) = p * 2^-shift
+
+    if (shift <= 0) {
+        return (shift < 0 || p > 0x7FFFFFFF) ? 0x7FFFFFFF : (int32_t)p;
+    }
+    if (shift > 31) {
+        return 0;
+    }
+
+    return (int32_t)((p + (1U << (shift - 1))) >> shift);
+}
+
+/** -------------------------------------------------------
+    @brief      Natural logarithm of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 31
+    @return     log(x) in the format of the input, saturated to 0x80000000 for x <= 0 and for
+                results which do not fit the format
+
+    @par
+    Count leading zeros normalizes the input to m * 2^e with m in [sqrt(0.5), sqrt(2)), then
+    log(x) = e * log(2) + log(m), where log(m) = t * P(t), t = m - 1, with a polynomial P of
+    degree 9. The absolute error is below 2^-28, in addition to the rounding to the output format.
+*/
+static inline int32_t plp_log_core_q32(const int32_t x, const uint32_t fracBits) {
+
+    const int32_t coef[10] = { 1073741824, -536870786, 357913841,  -268452476, 214770609,
+                               -178339138, 152257436,  -142172466, 138664848,  -82018762 };
+
+    if (x <= 0) {
+        return (int32_t)0x80000000;
+    }
+
+    uint32_t n = __builtin_clz(x);
+    uint32_t m = (uint32_t)x << n; // x = m * 2^(31 - n - fracBits), with m in Q1.31
+    int32_t e = 31 - (int32_t)n - (int32_t)fracBits;
+    int32_t t, p;
+    int64_t res;
+
+    // t = m - 1 in Q1.31, with m in [sqrt(0.5), sqrt(2))
+    if (m >= 3037000500U) {
+        t = (int32_t)(((int64_t)m - (1LL << 32)) >> 1);
+        e++;
+    } else {
+        t = (int32_t)(m - (1U << 31));
+    }
+
+    p = coef[9];
+    for (int32_t i = 8; i >= 0; i--) {
+        p = coef[i] + (int32_t)(((int64_t)p * t) >> 31);
+    }
+
+    // log(x) in Q8.56, with log(2) = 0x0B17217F7D1CF7A
+    res = (int64_t)e * 0xB17217F7D1CF7ALL + (((int64_t)t * p) >> 5);
+    res = (res + (1LL << (55 - fracBits))) >> (56 - fracBits);
+
+    if (res > 0x7FFFFFFF) {
+        return 0x7FFFFFFF;
+    }
+    return (res < -0x7FFFFFFFLL) ? (int32_t)0x80000000 : (int32_t)res;
+}
+
+/** -------------------------------------------------------
+    @brief      Reciprocal of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 31
+    @return     1 / x in the format of the input, truncated towards zero. Saturates to
+                0x7FFFFFFF (0x80000001 for negative inputs), which is also returned for x = 0.
+
+    @par
+    Count leading zeros normalizes |x| to m in [1, 2), the estimate of plp_recip_norm_q32 is
+    shifted to the output format and corrected to the exact result by at most three increments.
+*/
+static inline int32_t plp_recip_core_q32(const int32_t x, const uint32_t fracBits) {
+
+    if (x == 0) {
+        return 0x7FFFFFFF;
+    }
+
+    uint32_t a = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t n = __builtin_clz(a);
+    int32_t shift = 62 - 2 * (int32_t)fracBits - (int32_t)n; // 1 / x = recip(m) * 2^-shift
+    uint64_t one = 1ULL << (2 * fracBits);                   // 1 in the format of x * y
+    uint32_t y;
+
+    if (shift < 0) {
+        y = 0x7FFFFFFF;
+    } else if (shift > 31) {
+        y = 0;
+    } else {
+        y = plp_recip_norm_q32(a << n) >> shift;
+        // the estimate is at most 3 below floor(2^(2 * fracBits) / a)
+        while ((uint64_t)(y + 1) * a <= one) {
+            y++;
+        }
+        y = (y > 0x7FFFFFFF) ? 0x7FFFFFFF : y;
+    }
+
+    return (x < 0) ? -(int32_t)y : (int32_t)y;
+}
+
+/** -------------------------------------------------------
+    @brief      Four-quadrant inverse tangent of 32-bit fixed point numbers.
+    @param[in]  y  y coordinate, in any format
+    @param[in]  x  x coordinate, in the format of y
+    @return     atan2(y, x) / pi in Q1.31, i.e. the angle in [-pi, pi] is mapped to [-1, 1)
+                (pi is returned as 0x7FFFFFFF). Returns 0 for x = y = 0.
+
+    @par
+    The quotient of the smaller and the larger magnitude is computed with plp_recip_norm_q32 and
+    reduced to t in [0, tan(pi/8)] with atan(u) = pi/4 - atan((1 - u) / (1 + u)). Then,
+    atan(t) = t * P(t^2) with a polynomial P of degree 5, and the octant is restored. The absolute
+    error is below 2^-29.
+*/
+static inline int32_t plp_atan2_core_q32(const int32_t y, const int32_t x) {
+
+    const int32_t coef[6] = { 1073741824, -357913726, 214731522,
+                              -152935138, 113737782,  -65252085 };
+    uint32_t ax = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    uint32_t ay = (y < 0) ? -(uint32_t)y : (uint32_t)y;
+    uint32_t mx = (ax > ay) ? ax : ay;
+    uint32_t mn = (ax > ay) ? ay : ax;
+    uint32_t num, den, angle, d, reduced;
+    int32_t t, t2, p;
+
+    if (mx == 0) {
+        return 0;
+    }
+
+    // normalize the larger magnitude to [2^30, 2^31), such that mx + mn fits
+    d = __builtin_clz(mx) - 1;
+    mx = (d == 0xFFFFFFFF) ? (mx >> 1) : (mx << d);
+    mn = (d == 0xFFFFFFFF) ? (mn >> 1) : (mn << d);
+
+    // octant reduction, with tan(pi/8) in Q0.32
+    reduced = (mn > (uint32_t)(((uint64_t)mx * 1779033704U) >> 32));
+    num = reduced ? (mx - mn) : mn;
+    den = reduced ? (mx + mn) : mx;
+
+    // t = num / den in Q1.31
+    d = __builtin_clz(den);
+    t = (int32_t)(((uint64_t)num * plp_recip_norm_q32(den << d)) >> (31 - d));
+    t2 = (int32_t)(((int64_t)t * t) >> 31);
+
+    p = coef[5];
+    for (int32_t i = 4; i >= 0; i--) {
+        p = coef[i] + (int32_t)(((int64_t)p * t2) >> 31);
+    }
+
+    // atan(t) in Q1.31 radians, scaled with 1 / pi in Q0.32
+    angle = (uint32_t)(((int64_t)t * p) >> 30);
+    angle = (uint32_t)(((uint64_t)angle * 1367130551U + (1U << 31)) >> 32);
+
+    if (reduced) {
+        angle = 0x20000000 - angle;
+    }
+    if (ay > ax) {
+        angle = 0x40000000 - angle;
+    }
+    if (x < 0) {
+        angle = 0x80000000 - angle;
+    }
+    if (y < 0) {
+        return -(int32_t)angle;
+    }
+
+    return (angle > 0x7FFFFFFF) ? 0x7FFFFFFF : (int32_t)angle;
+}
+
+/** -------------------------------------------------------
+    @brief      Hyperbolic tangent of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 31
+    @return     tanh(x) in the format of the input
+
+    @par
+    tanh(|x|) = (1 - z) / (1 + z) with z = exp(-2 |x|) from plp_exp2_split_q32 and the division
+    from plp_recip_norm_q32. The absolute error is below 2^-29, in addition to the rounding to the
+    output format.
+*/
+static inline int32_t plp_tanh_core_q32(const int32_t x, const uint32_t fracBits) {
+
+    if (x == 0) {
+        return 0;
+    }
+
+    uint32_t a = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    int32_t n;
+    uint32_t z = plp_exp2_split_q32(-((int64_t)a * 1549082005 * 2), fracBits + 30, &n) << 1;
+    uint32_t r, res;
+
+    z = (n < -31) ? 0 : (z >> -n); // exp(-2 |x|) in Q1.31, below 1
+    r = plp_recip_norm_q32((1U << 31) + z);
+    res = (uint32_t)(((uint64_t)((1U << 31) - z) * r) >> 31);
+    res = (fracBits == 31) ? res : ((res + (1U << (30 - fracBits))) >> (31 - fracBits));
+    res = (res > 0x7FFFFFFF) ? 0x7FFFFFFF : res;
+
+    return (x < 0) ? -(int32_t)res : (int32_t)res;
+}
+
+/** -------------------------------------------------------
+    @brief      Logistic sigmoid of a 32-bit fixed point number.
+    @param[in]  x         input value
+    @param[in]  fracBits  number of fractional bits of the input and output, at most 31
+    @return     1 / (1 + exp(-x)) in the format of the input, saturated to 0x7FFFFFFF
+
+    @par
+    With z = exp(-|x|) from plp_exp2_split_q32, the result is 1 / (1 + z) for x >= 0 and
+    1 - 1 / (1 + z) for x < 0, with the division from plp_recip_norm_q32. The absolute error is
+    below 2^-29, in addition to the rounding to the output format.
+*/
+static inline int32_t plp_sigmoid_core_q32(const int32_t x, const uint32_t fracBits) {
+
+    uint32_t a = (x < 0) ? -(uint32_t)x : (uint32_t)x;
+    int32_t n;
+    uint32_t z = plp_exp2_split_q32(-((int64_t)a * 1549082005), fracBits + 30, &n) << 1;
+    uint32_t res;
+
+    if (x == 0) {
+        res = 1U << 30;
+    } else {
+        z = (n < -31) ? 0 : (z >> -n); // exp(-|x|) in Q1.31, below 1
+        res = plp_recip_norm_q32((1U << 31) + z);
+        res = (x < 0) ? ((1U << 31) - res) : res;
+    }
+    res = (fracBits == 31) ? res : ((res + (1U << (30 - fracBits))) >> (31 - fracBits));
+
+    return (res > 0x7FFFFFFF) ? 0x7FFFFFFF : (int32_t)res;
+}
+
+/** -------------------------------------------------------
+    @brief      Rounds a Q1.31 number to Q1.15 with saturation.
+    @param[in]  x  input value
+    @return     x / 2^16 rounded to nearest, saturated to 0x7FFF
+*/
+static inline int16_t plp_round_q32_to_q16(const int32_t x) {
+    return (x > 0x7FFF7FFF) ? 0x7FFF : (int16_t)((x + 0x8000) >> 16);
+}
+
+/** -------------------------------------------------------
+    @brief      16-bit fixed point versions of the fast math cores above.
+    @par
+    The input is extended to 32 bits, the result of the 32-bit core is rounded to 16 bits. All
+    results are correctly rounded, i.e. the error is at most 0.5 LSB.
+*/
+static inline int16_t plp_exp_core_q16(const int16_t x, const uint32_t fracBits) {
+    return plp_round_q32_to_q16(plp_exp_core_q32((int32_t)x << 16, fracBits + 16));
+}
+
+static inline int16_t plp_log_core_q16(const int16_t x, const uint32_t fracBits) {
+    return plp_round_q32_to_q16(plp_log_core_q32((int32_t)x << 16, fracBits + 16));
+}
+
+static inline int16_t plp_recip_core_q16(const int16_t x, const uint32_t fracBits) {
+    return plp_round_q32_to_q16(plp_recip_core_q32((int32_t)x << 16, fracBits + 16));
+}
+
+static inline int16_t plp_atan2_core_q16(const int16_t y, const int16_t x) {
+    return plp_round_q32_to_q16(plp_atan2_core_q32(y, x));
+}
+
+static inline int16_t plp_tanh_core_q16(const int16_t x, const uint32_t fracBits) {
+    return plp_round_q32_to_q16(plp_tanh_core_q32((int32_t)x << 16, fracBits + 16));
+}
+
+static inline int16_t plp_sigmoid_core_q16(const int16_t x, const uint32_t fracBits) {
+    return plp_round_q32_to_q16(plp_sigmoid_core_q32((int32_t)x << 16, fracBits + 16));
+}
+
+/** -------------------------------------------------------
+    @brief      Exponential function of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     exp(x), INFINITY above 88.72 and 0 below -87
+
+    @par
+    x = n * log(2) + r with |r| <= log(2) / 2 (Cody-Waite reduction), exp(r) is evaluated with a
+    polynomial of degree 6 and 2^n is added to the exponent bits. The error is below 2 ulp.
+*/
+static inline float32_t plp_exp_core_f32(const float32_t x) {
+
+    union {
+        float32_t f;
+        int32_t i;
+    } res;
+    float32_t t, r, p;
+    int32_t n;
+
+    if (x > 88.72f) {
+        return INFINITY;
+    }
+    if (x < -87.0f) {
+        return 0.0f;
+    }
+
+    t = x * 1.442695041f; // log2(e)
+    n = (int32_t)(t + ((t < 0.0f) ? -0.5f : 0.5f));
+    r = x - (float32_t)n * 0.693359375f + (float32_t)n * 2.12194440e-4f;
+
+    p = 1.394858455e-03f;
+    p = p * r + 8.375131878e-03f;
+    p = p * r + 4.166621822e-02f;
+    p = p * r + 1.666641544e-01f;
+    p = p * r + 5.000000108e-01f;
+    p = p * r + 1.000000038e+00f;
+    res.f = p * r + 1.0f;
+    res.i += n << 23;
+
+    return res.f;
+}
+
+/** -------------------------------------------------------
+    @brief      Natural logarithm of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     log(x), -INFINITY for x <= 0
+
+    @par
+    x = m * 2^e with m in [sqrt(0.5), sqrt(2)) is read from the bits of x, then
+    log(x) = e * log(2) + t * P(t), t = m - 1, with a polynomial P of degree 7. The error is below
+    4 ulp.
+*/
+static inline float32_t plp_log_core_f32(const float32_t x) {
+
+    union {
+        float32_t f;
+        int32_t i;
+    } m;
+    float32_t t, p;
+    int32_t e, k;
+
+    if (x <= 0.0f) {
+        return -INFINITY;
+    }
+
+    m.f = x;
+    e = 0;
+    if (m.i < 0x00800000) { // denormal input
+        m.f *= 8388608.0f;
+        e = -23;
+    }
+
+    // subtract the exponent of sqrt(0.5) from x, such that m is in [sqrt(0.5), sqrt(2))
+    k = (m.i - 0x3F3504F3) >> 23;
+    m.i -= k * (1 << 23);
+    e += k;
+    t = m.f - 1.0f;
+
+    p = -1.013405675e-01f;
+    p = p * t + 1.623418980e-01f;
+    p = p * t - 1.724701330e-01f;
+    p = p * t + 1.989856505e-01f;
+    p = p * t - 2.497007169e-01f;
+    p = p * t + 3.333511414e-01f;
+    p = p * t - 5.000036309e-01f;
+    p = p * t + 9.999999425e-01f;
+
+    return (t * p - (float32_t)e * 2.12194440e-4f) + (float32_t)e * 0.693359375f;
+}
+
+/** -------------------------------------------------------
+    @brief      Reciprocal of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     1 / x, +-INFINITY for zero and denormal inputs and +-0 for |x| >= 2^126
+
+    @par
+    The mantissa m in [1, 2) of x is inverted with the linear estimate 24/17 - 8/17 * m and three
+    Newton iterations r = r * (2 - m * r), and the exponent is negated. The error is below 2 ulp.
+*/
+static inline float32_t plp_recip_core_f32(const float32_t x) {
+
+    union {
+        float32_t f;
+        int32_t i;
+    } m, res;
+    int32_t e;
+    float32_t r;
+
+    m.f = x;
+    e = ((m.i >> 23) & 0xFF) - 127;
+    if (e < -126) {
+        return (x < 0.0f) ? -INFINITY : INFINITY;
+    }
+    if (e > 125) {
+        return (x < 0.0f) ? -0.0f : 0.0f;
+    }
+
+    m.i = (m.i & 0x007FFFFF) | 0x3F800000;
+    r = 1.411764706f - 0.470588235f * m.f;
+    r = r * (2.0f - m.f * r);
+    r = r * (2.0f - m.f * r);
+    r = r * (2.0f - m.f * r);
+
+    res.f = (x < 0.0f) ? -r : r;
+    res.i -= e * (1 << 23);
+
+    return res.f;
+}
+
+/** -------------------------------------------------------
+    @brief      Four-quadrant inverse tangent of 32-bit floating point numbers.
+    @param[in]  y  y coordinate
+    @param[in]  x  x coordinate
+    @return     atan2(y, x) in radians, in [-pi, pi]. Returns 0 for x = y = 0.
+
+    @par
+    The quotient of the smaller and the larger magnitude is reduced to t in [0, tan(pi/8)] with
+    atan(u) = pi/4 - atan((1 - u) / (1 + u)). Then, atan(t) = t * P(t^2) with a polynomial P of
+    degree 4, and the octant is restored. The absolute error is below 2^-21.
+*/
+static inline float32_t plp_atan2_core_f32(const float32_t y, const float32_t x) {
+
+    float32_t ax = (x < 0.0f) ? -x : x;
+    float32_t ay = (y < 0.0f) ? -y : y;
+    float32_t mx = (ax > ay) ? ax : ay;
+    float32_t mn = (ax > ay) ? ay : ax;
+    float32_t t, t2, p, angle;
+    int32_t reduced = (mn > 0.414213562f * mx);
+
+    if (mx == 0.0f) {
+        return 0.0f;
+    }
+
+    t = reduced ? ((mx - mn) / (mx + mn)) : (mn / mx);
+    t2 = t * t;
+
+    p = 8.042859648e-02f;
+    p = p * t2 - 1.387275662e-01f;
+    p = p * t2 + 1.997694325e-01f;
+    p = p * t2 - 3.333290276e-01f;
+    p = p * t2 + 9.999999918e-01f;
+    angle = t * p;
+
+    if (reduced) {
+        angle = 0.785398163f - angle;
+    }
+    if (ay > ax) {
+        angle = 1.570796327f - angle;
+    }
+    if (x < 0.0f) {
+        angle = 3.141592654f - angle;
+    }
+
+    return (y < 0.0f) ? -angle : angle;
+}
+
+/** -------------------------------------------------------
+    @brief      Hyperbolic tangent of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     tanh(x)
+
+    @par
+    For |x| < 0.625, tanh(x) = x * P(x^2) with a polynomial P of degree 5. Otherwise,
+    tanh(|x|) = (1 - z) / (1 + z) with z = exp(-2 |x|) from plp_exp_core_f32 and the division from
+    plp_recip_core_f32. Beyond |x| = 9, the result is +-1. The error is below 4 ulp.
+*/
+static inline float32_t plp_tanh_core_f32(const float32_t x) {
+
+    float32_t a = (x < 0.0f) ? -x : x;
+    float32_t x2, p, z, res;
+
+    if (a < 0.625f) {
+        x2 = x * x;
+        p = -5.664671170e-03f;
+        p = p * x2 + 2.059557783e-02f;
+        p = p * x2 - 5.372264327e-02f;
+        p = p * x2 + 1.333114961e-01f;
+        p = p * x2 - 3.333326161e-01f;
+        return x + x * (p * x2);
+    }
+
+    if (a > 9.0f) {
+        res = 1.0f;
+    } else {
+        z = plp_exp_core_f32(-2.0f * a);
+        res = (1.0f - z) * plp_recip_core_f32(1.0f + z);
+    }
+
+    return (x < 0.0f) ? -res : res;
+}
+
+/** -------------------------------------------------------
+    @brief      Logistic sigmoid of a 32-bit floating point number.
+    @param[in]  x  input value
+    @return     1 / (1 + exp(-x))
+
+    @par
+    With z = exp(-|x|) from plp_exp_core_f32, the result is 1 / (1 + z) for x >= 0 and
+    z / (1 + z) for x < 0, with the division from plp_recip_core_f32. The error is below 4 ulp.
+*/
+static inline float32_t plp_sigmoid_core_f32(const float32_t x) {
+
+    float32_t z = plp_exp_core_f32((x < 0.0f) ? x : -x);
+    float32_t r = plp_recip_core_f32(1.0f + z);
+
+    return (x < 0.0f) ? z * r : r;
+}
+
+
+/**
+ * @brief Macros required for SINE and COSINE Fast math approximations
+ */
+
+#define FAST_MATH_TABLE_SIZE 512
+#define FAST_MATH_Q32_SHIFT (32 - 10)
+#define FAST_MATH_Q16_SHIFT (16 - 10)
+#define CONTROLLER_Q32_SHIFT (32 - 9)
+#define TABLE_SPACING_Q32 0x400000
+#define TABLE_SPACING_Q16 0x80
+
+/**
+ * @brief      Glue code for q32 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32(int32_t x);
+
+/**
+ * @brief      q32 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int32_t plp_cos_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q16 cosine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16(int16_t x);
+
+/**
+ * @brief      q16 cosine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 cosine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     cos(x)
+ */
+
+int16_t plp_cos_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for f32 cosine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
+
+float32_t plp_cos_f32(float32_t x);
+
+/**
+ * @brief      F32 cosine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     cos(x)
+ */
+
+float32_t plp_cos_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for q32 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32(int32_t x);
+
+/**
+ * @brief      q32 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32s_rv32im(int32_t x);
+
+/**
+ * @brief      q32 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int32_t plp_sin_q32s_xpulpv2(int32_t x);
+
+/**
+ * @brief      Glue code for q16 sine function
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16(int16_t x);
+
+/**
+ * @brief      q16 sine function for RV32IM
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16s_rv32im(int16_t x);
+
+/**
+ * @brief      q16 sine function for XPULPV2
+ *
+ * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
+ * 2*PI)
+ *
+ * @return     sin(x)
+ */
+
+int16_t plp_sin_q16s_xpulpv2(int16_t x);
+
+/**
+ * @brief      Glue code for f32 sine function
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
+
+float32_t plp_sin_f32(float32_t x);
+
+/**
+ * @brief      F32 sine function for XPULPV2
+ *
+ * @param[in]  x     input value in radians
+ *
+ * @return     sin(x)
+ */
+
+float32_t plp_sin_f32s_xpulpv2(float32_t x);
+
+/**
+ * @brief      Glue code for sine of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_sin_vec_q32(const int32_t *__restrict__ pSrc,
+                     int32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel sine of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_sin_vec_q32_parallel(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      Sine of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_sin_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Sine of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_sin_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel sine of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q32 struct
+ * @return     none
+ */
+
+void plp_sin_vec_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for sine of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_sin_vec_q16(const int16_t *__restrict__ pSrc,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel sine of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_sin_vec_q16_parallel(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      Sine of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_sin_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Sine of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_sin_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel sine of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct
+ * @return     none
+ */
+
+void plp_sin_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for sine of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector, in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_sin_vec_f32(const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel sine of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector, in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_sin_vec_f32_parallel(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      Sine of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector, in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_sin_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel sine of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_f32 struct
+ * @return     none
+ */
+
+void plp_sin_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for cosine of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_cos_vec_q32(const int32_t *__restrict__ pSrc,
+                     int32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel cosine of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_cos_vec_q32_parallel(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      Cosine of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_cos_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Cosine of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_cos_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel cosine of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q32 struct
+ * @return     none
+ */
+
+void plp_cos_vec_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for cosine of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_cos_vec_q16(const int16_t *__restrict__ pSrc,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel cosine of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_cos_vec_q16_parallel(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      Cosine of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_cos_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize);
+
+/**
+ * @brief      Cosine of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_cos_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel cosine of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct
+ * @return     none
+ */
+
+void plp_cos_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for cosine of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector, in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_cos_vec_f32(const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel cosine of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector, in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_cos_vec_f32_parallel(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      Cosine of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector, in radians
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_cos_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel cosine of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_f32 struct
+ * @return     none
+ */
+
+void plp_cos_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for inverse tangent of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_atan2_vec_q32(const int32_t *__restrict__ pSrcY,
+                       const int32_t *__restrict__ pSrcX,
+                       int32_t *__restrict__ pDst,
+                       uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel inverse tangent of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_atan2_vec_q32_parallel(const int32_t *__restrict__ pSrcY,
+                                const int32_t *__restrict__ pSrcX,
+                                int32_t *__restrict__ pDst,
+                                uint32_t blockSize,
+                                uint32_t nPE);
+
+/**
+ * @brief      Inverse tangent of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_atan2_vec_q32s_rv32im(const int32_t *__restrict__ pSrcY,
+                               const int32_t *__restrict__ pSrcX,
+                               int32_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Inverse tangent of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_atan2_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrcY,
+                                const int32_t *__restrict__ pSrcX,
+                                int32_t *__restrict__ pDst,
+                                uint32_t blockSize);
+
+/**
+ * @brief      Parallel inverse tangent of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_atan2_vec_instance_q32 struct
+ * @return     none
+ */
+
+void plp_atan2_vec_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for inverse tangent of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_atan2_vec_q16(const int16_t *__restrict__ pSrcY,
+                       const int16_t *__restrict__ pSrcX,
+                       int16_t *__restrict__ pDst,
+                       uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel inverse tangent of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_atan2_vec_q16_parallel(const int16_t *__restrict__ pSrcY,
+                                const int16_t *__restrict__ pSrcX,
+                                int16_t *__restrict__ pDst,
+                                uint32_t blockSize,
+                                uint32_t nPE);
+
+/**
+ * @brief      Inverse tangent of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_atan2_vec_q16s_rv32im(const int16_t *__restrict__ pSrcY,
+                               const int16_t *__restrict__ pSrcX,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Inverse tangent of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_atan2_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrcY,
+                                const int16_t *__restrict__ pSrcX,
+                                int16_t *__restrict__ pDst,
+                                uint32_t blockSize);
+
+/**
+ * @brief      Parallel inverse tangent of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_atan2_vec_instance_q16 struct
+ * @return     none
+ */
+
+void plp_atan2_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for inverse tangent of a 32-bit floating point vector
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_atan2_vec_f32(const float32_t *__restrict__ pSrcY,
+                       const float32_t *__restrict__ pSrcX,
+                       float32_t *__restrict__ pDst,
+                       uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel inverse tangent of a 32-bit floating point vector
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_atan2_vec_f32_parallel(const float32_t *__restrict__ pSrcY,
+                                const float32_t *__restrict__ pSrcX,
+                                float32_t *__restrict__ pDst,
+                                uint32_t blockSize,
+                                uint32_t nPE);
+
+/**
+ * @brief      Inverse tangent of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrcY      points to the y coordinates
+ * @param[in]  pSrcX      points to the x coordinates
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_atan2_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrcY,
+                                const float32_t *__restrict__ pSrcX,
+                                float32_t *__restrict__ pDst,
+                                uint32_t blockSize);
+
+/**
+ * @brief      Parallel inverse tangent of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_atan2_vec_instance_f32 struct
+ * @return     none
+ */
+
+void plp_atan2_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for exponential of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_exp_vec_q32(const int32_t *__restrict__ pSrc,
+                     int32_t *__restrict__ pDst,
+                     uint32_t blockSize,
+                     const uint32_t fracBits);
+
+/**
+ * @brief      Glue code for parallel exponential of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_exp_vec_q32_parallel(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits,
+                              uint32_t nPE);
+
+/**
+ * @brief      Exponential of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_exp_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             const uint32_t fracBits);
+
+/**
+ * @brief      Exponential of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_exp_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits);
+
+/**
+ * @brief      Parallel exponential of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q32 struct
+ * @return     none
+ */
+
+void plp_exp_vec_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for exponential of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_exp_vec_q16(const int16_t *__restrict__ pSrc,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize,
+                     const uint32_t fracBits);
+
+/**
+ * @brief      Glue code for parallel exponential of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_exp_vec_q16_parallel(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits,
+                              uint32_t nPE);
+
+/**
+ * @brief      Exponential of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_exp_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             const uint32_t fracBits);
+
+/**
+ * @brief      Exponential of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_exp_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits);
+
+/**
+ * @brief      Parallel exponential of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct
+ * @return     none
+ */
+
+void plp_exp_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for exponential of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_exp_vec_f32(const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel exponential of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_exp_vec_f32_parallel(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      Exponential of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_exp_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel exponential of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_f32 struct
+ * @return     none
+ */
+
+void plp_exp_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for natural logarithm of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_log_vec_q32(const int32_t *__restrict__ pSrc,
+                     int32_t *__restrict__ pDst,
+                     uint32_t blockSize,
+                     const uint32_t fracBits);
+
+/**
+ * @brief      Glue code for parallel natural logarithm of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_log_vec_q32_parallel(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits,
+                              uint32_t nPE);
+
+/**
+ * @brief      Natural logarithm of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_log_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                             int32_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             const uint32_t fracBits);
+
+/**
+ * @brief      Natural logarithm of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_log_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits);
+
+/**
+ * @brief      Parallel natural logarithm of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q32 struct
+ * @return     none
+ */
+
+void plp_log_vec_q32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for natural logarithm of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_log_vec_q16(const int16_t *__restrict__ pSrc,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize,
+                     const uint32_t fracBits);
+
+/**
+ * @brief      Glue code for parallel natural logarithm of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_log_vec_q16_parallel(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits,
+                              uint32_t nPE);
+
+/**
+ * @brief      Natural logarithm of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_log_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                             int16_t *__restrict__ pDst,
+                             uint32_t blockSize,
+                             const uint32_t fracBits);
+
+/**
+ * @brief      Natural logarithm of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_log_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits);
+
+/**
+ * @brief      Parallel natural logarithm of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct
+ * @return     none
+ */
+
+void plp_log_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for natural logarithm of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_log_vec_f32(const float32_t *__restrict__ pSrc,
+                     float32_t *__restrict__ pDst,
+                     uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel natural logarithm of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_log_vec_f32_parallel(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              uint32_t nPE);
+
+/**
+ * @brief      Natural logarithm of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_log_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize);
+
+/**
+ * @brief      Parallel natural logarithm of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_f32 struct
+ * @return     none
+ */
+
+void plp_log_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for reciprocal of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_recip_vec_q32(const int32_t *__restrict__ pSrc,
+                       int32_t *__restrict__ pDst,
+                       uint32_t blockSize,
+                       const uint32_t fracBits);
+
+/**
+ * @brief      Glue code for parallel reciprocal of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_recip_vec_q32_parallel(const int32_t *__restrict__ pSrc,
+                                int32_t *__restrict__ pDst,
+                                uint32_t blockSize,
+                                const uint32_t fracBits,
+                                uint32_t nPE);
+
+/**
+ * @brief      Reciprocal of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_recip_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               const uint32_t fracBits);
+
+/**
+ * @brief      Reciprocal of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_recip_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                int32_t *__restrict__ pDst,
+                                uint32_t blockSize,
+                                const uint32_t fracBits);
+
+/**
+ * @brief      Parallel reciprocal of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q32 struct
+ * @return     none
+ */
+
+void plp_recip_vec_q32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
-    @return     none
-*/
+/**
+ * @brief      Glue code for reciprocal of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-void plp_dot_prod_q32s_rv32im(const int32_t *__restrict__ pSrcA,
-                              const int32_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+void plp_recip_vec_q16(const int16_t *__restrict__ pSrc,
+                       int16_t *__restrict__ pDst,
+                       uint32_t blockSize,
+                       const uint32_t fracBits);
 
-/** -------------------------------------------------------
-    @brief Scalar dot product of 32-bit fixed point vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here
-    @return     none
-*/
+/**
+ * @brief      Glue code for parallel reciprocal of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
 
-void plp_dot_prod_q32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                               const int32_t *__restrict__ pSrcB,
+void plp_recip_vec_q16_parallel(const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pDst,
+                                uint32_t blockSize,
+                                const uint32_t fracBits,
+                                uint32_t nPE);
+
+/**
+ * @brief      Reciprocal of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_recip_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
                                uint32_t blockSize,
-                               uint32_t deciPoint,
-                               int32_t *__restrict__ pRes);
+                               const uint32_t fracBits);
 
-/** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-    @return     none
-*/
+/**
+ * @brief      Reciprocal of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-void plp_dot_prod_f32(const float32_t *__restrict__ pSrcA,
-                      const float32_t *__restrict__ pSrcB,
+void plp_recip_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                int16_t *__restrict__ pDst,
+                                uint32_t blockSize,
+                                const uint32_t fracBits);
+
+/**
+ * @brief      Parallel reciprocal of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct
+ * @return     none
+ */
+
+void plp_recip_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for reciprocal of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_recip_vec_f32(const float32_t *__restrict__ pSrc,
+                       float32_t *__restrict__ pDst,
+                       uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel reciprocal of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_recip_vec_f32_parallel(const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst,
+                                uint32_t blockSize,
+                                uint32_t nPE);
+
+/**
+ * @brief      Reciprocal of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_recip_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                float32_t *__restrict__ pDst,
+                                uint32_t blockSize);
+
+/**
+ * @brief      Parallel reciprocal of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_f32 struct
+ * @return     none
+ */
+
+void plp_recip_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for hyperbolic tangent of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_tanh_vec_q32(const int32_t *__restrict__ pSrc,
+                      int32_t *__restrict__ pDst,
                       uint32_t blockSize,
-                      float32_t *__restrict__ pRes);
+                      const uint32_t fracBits);
 
-/** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-    @return     none
-*/
+/**
+ * @brief      Glue code for parallel hyperbolic tangent of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
 
-void plp_dot_prod_f32s_xpulpv2(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
+void plp_tanh_vec_q32_parallel(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
                                uint32_t blockSize,
-                               float32_t *__restrict__ pRes);
+                               const uint32_t fracBits,
+                               uint32_t nPE);
 
-/** -------------------------------------------------------
-    @brief Glue code for dot product of 32-bit float vectors.
-    @param[in]  pSrcA      points to the first input vector
-    @param[in]  pSrcB      points to the second input vector
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here
-    @return     none
-*/
+/**
+ * @brief      Hyperbolic tangent of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-void plp_dot_prod_f32s_rv32im(const float32_t *__restrict__ pSrcA,
-                               const float32_t *__restrict__ pSrcB,
+void plp_tanh_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits);
+
+/**
+ * @brief      Hyperbolic tangent of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_tanh_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
                                uint32_t blockSize,
-                               float32_t *__restrict__ pRes);
+                               const uint32_t fracBits);
 
+/**
+ * @brief      Parallel hyperbolic tangent of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q32 struct
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-    @brief Glue code for dot product of 16-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
+void plp_tanh_vec_q32p_xpulpv2(void *args);
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-*/
-void plp_dot_prod_i16(const int16_t *pSrcA,
-                      const int16_t *pSrcB,
+/**
+ * @brief      Glue code for hyperbolic tangent of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_tanh_vec_q16(const int16_t *__restrict__ pSrc,
+                      int16_t *__restrict__ pDst,
                       uint32_t blockSize,
-                      int32_t *__restrict__ pRes);
+                      const uint32_t fracBits);
 
-/** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+/**
+ * @brief      Glue code for parallel hyperbolic tangent of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
-    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
-*/
+void plp_tanh_vec_q16_parallel(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               const uint32_t fracBits,
+                               uint32_t nPE);
 
-void plp_dot_prod_i16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
+/**
+ * @brief      Hyperbolic tangent of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_tanh_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
                               uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+                              const uint32_t fracBits);
 
-/** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit integer vectors kernel singlecore for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+/**
+ * @brief      Hyperbolic tangent of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors.
-*/
+void plp_tanh_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               const uint32_t fracBits);
 
-void plp_dot_prod_i16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
+/**
+ * @brief      Parallel hyperbolic tangent of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct
+ * @return     none
+ */
+
+void plp_tanh_vec_q16p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for hyperbolic tangent of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
+
+void plp_tanh_vec_f32(const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      uint32_t blockSize);
+
+/**
+ * @brief      Glue code for parallel hyperbolic tangent of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_tanh_vec_f32_parallel(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
                                uint32_t blockSize,
-                               int32_t *__restrict__ pRes);
+                               uint32_t nPE);
 
-/** -------------------------------------------------------
-    @brief Glue code for dot product of 16-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+/**
+ * @brief      Hyperbolic tangent of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
 
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_tanh_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize);
+
+/**
+ * @brief      Parallel hyperbolic tangent of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_f32 struct
+ * @return     none
+ */
+
+void plp_tanh_vec_f32p_xpulpv2(void *args);
+
+/**
+ * @brief      Glue code for logistic sigmoid of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q32(const int32_t *__restrict__ pSrc,
+                         int32_t *__restrict__ pDst,
+                         uint32_t blockSize,
+                         const uint32_t fracBits);
+
+/**
+ * @brief      Glue code for parallel logistic sigmoid of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q32_parallel(const int32_t *__restrict__ pSrc,
+                                  int32_t *__restrict__ pDst,
+                                  uint32_t blockSize,
+                                  const uint32_t fracBits,
+                                  uint32_t nPE);
+
+/**
+ * @brief      Logistic sigmoid of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                 int32_t *__restrict__ pDst,
+                                 uint32_t blockSize,
+                                 const uint32_t fracBits);
+
+/**
+ * @brief      Logistic sigmoid of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_sigmoid_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                  int32_t *__restrict__ pDst,
+                                  uint32_t blockSize,
+                                  const uint32_t fracBits);
 
-void plp_dot_prod_q16(const int16_t *__restrict__ pSrcA,
-                      const int16_t *__restrict__ pSrcB,
-                      uint32_t blockSize,
-                      uint32_t deciPoint,
-                      int32_t *__restrict__ pRes);
+/**
+ * @brief      Parallel logistic sigmoid of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q32 struct
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-    @brief Scalar dot product of 16-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+void plp_sigmoid_vec_q32p_xpulpv2(void *args);
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 16 bit values are packed two by two into 32 bit vectors and then the
-    two dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator. RV32IM
-    doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
-*/
+/**
+ * @brief      Glue code for logistic sigmoid of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-void plp_dot_prod_q16s_rv32im(const int16_t *__restrict__ pSrcA,
-                              const int16_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+void plp_sigmoid_vec_q16(const int16_t *__restrict__ pSrc,
+                         int16_t *__restrict__ pDst,
+                         uint32_t blockSize,
+                         const uint32_t fracBits);
 
-/** -------------------------------------------------------
-    @brief Vectorized dot product of 16-bit fixed point vectors singlecore kernel for XPULPV2
-   extension.
-    @param[in]  pSrcA      points to the first input vector [16 bit]
-    @param[in]  pSrcB      points to the second input vector [16 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+/**
+ * @brief      Glue code for parallel logistic sigmoid of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
 
-    @par Exploiting SIMD instructions
-    The 16 bit values are packed two by two into 32 bit vectors and then the two dot products are
-    performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_sigmoid_vec_q16_parallel(const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pDst,
+                                  uint32_t blockSize,
+                                  const uint32_t fracBits,
+                                  uint32_t nPE);
 
-void plp_dot_prod_q16s_xpulpv2(const int16_t *__restrict__ pSrcA,
-                               const int16_t *__restrict__ pSrcB,
-                               uint32_t blockSize,
-                               uint32_t deciPoint,
-                               int32_t *__restrict__ pRes);
+/**
+ * @brief      Logistic sigmoid of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-    @brief Glue code for dot product of 8-bit integer vectors.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+void plp_sigmoid_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                                 int16_t *__restrict__ pDst,
+                                 uint32_t blockSize,
+                                 const uint32_t fracBits);
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Logistic sigmoid of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-void plp_dot_prod_i8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t blockSize,
-                     int32_t *__restrict__ pRes);
+void plp_sigmoid_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                                  int16_t *__restrict__ pDst,
+                                  uint32_t blockSize,
+                                  const uint32_t fracBits);
 
-/** -------------------------------------------------------
-    @brief Vectorized dot product of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [8] bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+/**
+ * @brief      Parallel logistic sigmoid of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct
+ * @return     none
+ */
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
-*/
+void plp_sigmoid_vec_q16p_xpulpv2(void *args);
 
-void plp_dot_prod_i8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t blockSize,
-                             int32_t *__restrict__ pRes);
+/**
+ * @brief      Glue code for logistic sigmoid of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-    @brief Vectorized dot product of 8-bit integer vectors singlecore kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+void plp_sigmoid_vec_f32(const float32_t *__restrict__ pSrc,
+                         float32_t *__restrict__ pDst,
+                         uint32_t blockSize);
 
-    @par Exploiting SIMD instructions
-    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
-*/
+/**
+ * @brief      Glue code for parallel logistic sigmoid of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
 
-void plp_dot_prod_i8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
-                              uint32_t blockSize,
-                              int32_t *__restrict__ pRes);
+void plp_sigmoid_vec_f32_parallel(const float32_t *__restrict__ pSrc,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t blockSize,
+                                  uint32_t nPE);
 
-/** -------------------------------------------------------
-    @brief Glue code for dot product of 8-bit fixed point vectors.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+/**
+ * @brief      Logistic sigmoid of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_sigmoid_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  float32_t *__restrict__ pDst,
+                                  uint32_t blockSize);
 
-void plp_dot_prod_q8(const int8_t *__restrict__ pSrcA,
-                     const int8_t *__restrict__ pSrcB,
-                     uint32_t blockSize,
-                     uint32_t deciPoint,
-                     int32_t *__restrict__ pRes);
+/**
+ * @brief      Parallel logistic sigmoid of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_f32 struct
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-    @brief Scalar dot product of 8-bit fixed point vectors kernel for RV32IM extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+void plp_sigmoid_vec_f32p_xpulpv2(void *args);
 
-    @par Exploiting SIMD instructions
-    When the ISA supports, the 8 bit values are packed four by four into 32 bit vectors and then the
-    four dot products are performed simultaneously on 32 bit vectors, with 32 bit accumulator.
-    RV32IM doesn't support SIMD. For SIMD, check out other ISA extensions (e.g. XPULPV2).
-*/
+/**
+ * @brief      Glue code for square root of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-void plp_dot_prod_q8s_rv32im(const int8_t *__restrict__ pSrcA,
-                             const int8_t *__restrict__ pSrcB,
-                             uint32_t blockSize,
-                             uint32_t deciPoint,
-                             int32_t *__restrict__ pRes);
+void plp_sqrt_vec_q32(const int32_t *__restrict__ pSrc,
+                      int32_t *__restrict__ pDst,
+                      uint32_t blockSize,
+                      const uint32_t fracBits);
 
-/** -------------------------------------------------------
-    @brief Scalar dot product of 8-bit fixed point vectors singlecore kernel for XPULPV2 extension.
-    @param[in]  pSrcA      points to the first input vector [8 bit]
-    @param[in]  pSrcB      points to the second input vector [8 bit]
-    @param[in]  blockSize  number of samples in each vector
-    @param[in]  deciPoint  decimal point for right shift
-    @param[out] pRes       output result returned here [32 bit]
-    @return     none
+/**
+ * @brief      Glue code for parallel square root of a 32-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
 
-    @par Exploiting SIMD instructions
-    The 8 bit values are packed four by four into 32 bit vectors and then the four dot products are
-    performed on 32 bit vectors, with 32 bit accumulator.
-*/
+void plp_sqrt_vec_q32_parallel(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               const uint32_t fracBits,
+                               uint32_t nPE);
 
-void plp_dot_prod_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
-                              const int8_t *__restrict__ pSrcB,
+/**
+ * @brief      Square root of a 32-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_sqrt_vec_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
                               uint32_t blockSize,
-                              uint32_t deciPoint,
-                              int32_t *__restrict__ pRes);
+                              const uint32_t fracBits);
 
-/** -------------------------------------------------------
-   @brief Glue code for absolute value of 32-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+/**
+ * @brief      Square root of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-void plp_abs_i32(const int32_t * pSrc,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_sqrt_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                               int32_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               const uint32_t fracBits);
 
-/** -------------------------------------------------------
-   @brief Element-by-element absolute value of 32-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+/**
+ * @brief      Parallel square root of a 32-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q32 struct
+ * @return     none
+ */
 
-void plp_abs_i32s_rv32im(const int32_t * pSrc,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_sqrt_vec_q32p_xpulpv2(void *args);
 
-/** -------------------------------------------------------
-   @brief Element-by-element absolute value of 32-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+/**
+ * @brief      Glue code for square root of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-void plp_abs_i32s_xpulpv2(const int32_t * pSrc,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_sqrt_vec_q16(const int16_t *__restrict__ pSrc,
+                      int16_t *__restrict__ pDst,
+                      uint32_t blockSize,
+                      const uint32_t fracBits);
 
-/** -------------------------------------------------------
-   @brief Glue code for absolute value of 16-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+/**
+ * @brief      Glue code for parallel square root of a 16-bit fixed point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
 
-void plp_abs_i16(const int16_t * pSrc,
-                 int16_t * pDst,
-                 uint32_t blockSize);
+void plp_sqrt_vec_q16_parallel(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               const uint32_t fracBits,
+                               uint32_t nPE);
 
-/** -------------------------------------------------------
-   @brief Element-by-element absolute value of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+/**
+ * @brief      Square root of a 16-bit fixed point vector for RV32IM
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
+
+void plp_sqrt_vec_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize,
+                              const uint32_t fracBits);
 
-void plp_abs_i16s_rv32im(const int16_t * pSrc,
-                         int16_t * pDst,
-                         uint32_t blockSize);
+/**
+ * @brief      Square root of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  fracBits   number of fractional bits of the input and output
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-   @brief Element-by-element absolute value of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+void plp_sqrt_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                               int16_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               const uint32_t fracBits);
 
-void plp_abs_i16s_xpulpv2(const int16_t * pSrc,
-                          int16_t * pDst,
-                          uint32_t blockSize);
+/**
+ * @brief      Parallel square root of a 16-bit fixed point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-   @brief Glue code for absolute value of 8-bit integer vectors.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+void plp_sqrt_vec_q16p_xpulpv2(void *args);
 
-void plp_abs_i8(const int8_t * pSrc,
-                 int8_t * pDst,
-                 uint32_t blockSize);
+/**
+ * @brief      Glue code for square root of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-   @brief Element-by-element absolute value of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+void plp_sqrt_vec_f32(const float32_t *__restrict__ pSrc,
+                      float32_t *__restrict__ pDst,
+                      uint32_t blockSize);
 
-void plp_abs_i8s_rv32im(const int8_t * pSrc,
-                         int8_t * pDst,
-                         uint32_t blockSize);
+/**
+ * @brief      Glue code for parallel square root of a 32-bit floating point vector
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @param[in]  nPE        number of parallel processing units
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-   @brief Element-by-element absolute value of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pDst       points to the output vector
-   @param[in]     blockSize  number of samples in each vector
-   @return        none
-*/
+void plp_sqrt_vec_f32_parallel(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize,
+                               uint32_t nPE);
 
-void plp_abs_i8s_xpulpv2(const int8_t * pSrc,
-                          int8_t * pDst,
-                          uint32_t blockSize);
+/**
+ * @brief      Square root of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  pSrc       points to the input vector
+ * @param[out] pDst       points to the output vector
+ * @param[in]  blockSize  number of samples in each vector
+ * @return     none
+ */
 
-/** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 32-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+void plp_sqrt_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                               float32_t *__restrict__ pDst,
+                               uint32_t blockSize);
 
-void plp_add_i32(const int32_t * pSrcA,
-                 const int32_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+/**
+ * @brief      Parallel square root of a 32-bit floating point vector for XPULPV2
+ *
+ * @param[in]  args  pointer to plp_fast_math_vec_instance_f32 struct
+ * @return     none
+ */
+
+void plp_sqrt_vec_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief Glue code for correlation of 32-bit integer vectors.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
 */
 
-void plp_add_i32s_rv32im(const int32_t * pSrcA,
-                         const int32_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_correlate_i32(const int32_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int32_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none
 */
 
-void plp_add_i32s_xpulpv2(const int32_t * pSrcA,
-                          const int32_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int32_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 16-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+    @param[in]  pSrcA   points to the first input vector
+    @param[in]  srcALen Length of the first input vector
+    @param[in]  pSrcB   points to the second input vector
+    @param[in]  srcBLen Length of the second input vector
+    @param[out] pRes    output result returned here
+    @return     none */
 
-void plp_add_i16(const int16_t * pSrcA,
-                 const int16_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *__restrict__ pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Glue code for correlation of 16-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    result returned here
+  @return     none
+ */
 
-void plp_add_i16s_rv32im(const int16_t * pSrcA,
-                         const int16_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_correlate_i16(const int16_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int16_t *pSrcB,
+                       const uint32_t srcBLen,
+                       int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 16-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_add_i16s_xpulpv2(const int16_t * pSrcA,
-                          const int16_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element addition of 8-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_add_i8(const int8_t * pSrcA,
-                 const int8_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Glue code for correlation of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
 
-void plp_add_i8s_rv32im(const int8_t * pSrcA,
-                         const int8_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_correlate_i8(const int8_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int8_t *pSrcB,
+                      const uint32_t srcBLen,
+                      int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element addition of 8-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+  @brief Glue code for correlation (valid) of 8-bit integer vectors.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_correlate_valid_i8(const int8_t *pSrcA,
+                            const uint32_t srcALen,
+                            const int8_t *pSrcB,
+                            const uint32_t srcBLen,
+                            int32_t *pRes);
+
+/** -------------------------------------------------------
+   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_add_i8s_xpulpv2(const int8_t * pSrcA,
-                          const int8_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 32-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
+   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
+   @param[in]  pSrcA   points to the first input vector
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here
+   @return     none
 */
 
-void plp_mult_i32(const int32_t * pSrcA,
-                 const int32_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+                              int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Glue code for parallel correlation of 8-bit integer vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  nPE      Number of cores to compute on
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_mult_i32s_rv32im(const int32_t * pSrcA,
-                         const int32_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_correlate_i8_parallel(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               const uint8_t nPE,
+                               int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Parallel correlation of 8-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_correlate_instance_i8 struct initialized by
+                         plp_correlate_i8_parallel
+  @return     none
+ */
 
-void plp_mult_i32s_xpulpv2(const int32_t * pSrcA,
-                          const int32_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_correlate_i8p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 16-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Glue code for parallel correlation of 16-bit integer vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  nPE      Number of cores to compute on
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_mult_i16(const int16_t * pSrcA,
-                 const int16_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_correlate_i16_parallel(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                const uint8_t nPE,
+                                int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 16-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Parallel correlation of 16-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_correlate_instance_i16 struct initialized by
+                         plp_correlate_i16_parallel
+  @return     none
+ */
 
-void plp_mult_i16s_rv32im(const int16_t * pSrcA,
-                         const int16_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_correlate_i16p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 16-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Glue code for parallel correlation of 32-bit integer vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  nPE      Number of cores to compute on
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_mult_i16s_xpulpv2(const int16_t * pSrcA,
-                          const int16_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_correlate_i32_parallel(const int32_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *pSrcB,
+                                const uint32_t srcBLen,
+                                const uint8_t nPE,
+                                int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Glue code for element-by-element multiplication of 8-bit integer vectors.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Parallel correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_correlate_instance_i32 struct initialized by
+                         plp_correlate_i32_parallel
+  @return     none
+ */
 
-void plp_mult_i8(const int8_t * pSrcA,
-                 const int8_t * pSrcB,
-                 int32_t * pDst,
-                 uint32_t blockSize);
+void plp_correlate_i32p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 8-bit integer vectors kernel for RV32IM extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Glue code for correlation of 8-bit fixed point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_mult_i8s_rv32im(const int8_t * pSrcA,
-                         const int8_t * pSrcB,
-                         int32_t * pDst,
-                         uint32_t blockSize);
+void plp_correlate_q8(const int8_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int8_t *pSrcB,
+                      const uint32_t srcBLen,
+                      uint32_t fracBits,
+                      int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief Element-by-element multiplication of 8-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]     pSrcA      points to first input vector
-    @param[in]     pSrcB      points to second input vector
-    @param[out]    pDst       points to output vector
-    @param[in]     blockSize  number of samples in each vector
-    @return        none
-*/
+  @brief Correlation of 8-bit fixed point vectors kernel for RV32IM extension.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_mult_i8s_xpulpv2(const int8_t * pSrcA,
-                          const int8_t * pSrcB,
-                          int32_t * pDst,
-                          uint32_t blockSize);
+void plp_correlate_q8s_rv32im(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+                              uint32_t fracBits,
+                              int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for filling a constant value into a 32-bit integer vector.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Correlation of 8-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_fill_i32(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_correlate_q8s_xpulpv2(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               uint32_t fracBits,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Fills a constant value into a 32-bit integer vector for RV32IM extension.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Glue code for parallel correlation of 8-bit fixed point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[in]  nPE      Number of cores to compute on
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_fill_i32s_rv32im(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_correlate_q8_parallel(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               uint32_t fracBits,
+                               const uint8_t nPE,
+                               int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Fills a constant value into a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  value      input value to be filled
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Parallel correlation of 8-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_correlate_instance_q8 struct initialized by
+                         plp_correlate_q8_parallel
+  @return     none
+ */
 
-void plp_fill_i32s_xpulpv2(int32_t value, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_correlate_q8p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for copying the elements of a 32-bit integer vector
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Glue code for correlation of 16-bit fixed point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_copy_i32(int32_t *__restrict__ pSrc, int32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_correlate_q16(const int16_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int16_t *pSrcB,
+                       const uint32_t srcBLen,
+                       uint32_t fracBits,
+                       int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Correlation of 16-bit fixed point vectors kernel for RV32IM extension.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_copy_i32s_rv32im(int32_t *__restrict__ pSrc,
-                          int32_t *__restrict__ pDst,
-                          uint32_t blockSize);
+void plp_correlate_q16s_rv32im(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+                               uint32_t fracBits,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Correlation of 16-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_copy_i32s_xpulpv2(int32_t *__restrict__ pSrc,
-                           int32_t *__restrict__ pDst,
-                           uint32_t blockSize);
+void plp_correlate_q16s_xpulpv2(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                uint32_t fracBits,
+                                int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for copying the elements of a 32-bit float vector
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Glue code for parallel correlation of 16-bit fixed point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[in]  nPE      Number of cores to compute on
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_copy_f32(float32_t *__restrict__ pSrc, float32_t *__restrict__ pDst, uint32_t blockSize);
+void plp_correlate_q16_parallel(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                uint32_t fracBits,
+                                const uint8_t nPE,
+                                int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Parallel correlation of 16-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_correlate_instance_q16 struct initialized by
+                         plp_correlate_q16_parallel
+  @return     none
+ */
 
-void plp_copy_f32s_xpulpv2(float32_t *__restrict__ pSrc,
-                           float32_t *__restrict__ pDst,
-                           uint32_t blockSize);
+void plp_correlate_q16p_xpulpv2(void *task_args);
 
 /** -------------------------------------------------------
-    @brief      Copies the elements of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to input vector
-    @param[out] pDst       points to output vector
-    @param[in]  blockSize  number of samples in each vector
-    @return     none
-*/
+  @brief Glue code for correlation of 32-bit fixed point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_copy_f32s_rv32im(float32_t *__restrict__ pSrc,
-                           float32_t *__restrict__ pDst,
-                           uint32_t blockSize);
+void plp_correlate_q32(const int32_t *pSrcA,
+                       const uint32_t srcALen,
+                       const int32_t *pSrcB,
+                       const uint32_t srcBLen,
+                       uint32_t fracBits,
+                       int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+  @brief Correlation of 32-bit fixed point vectors kernel for RV32IM extension.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_mean_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_correlate_q32s_rv32im(const int32_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int32_t *pSrcB,
+                               const uint32_t srcBLen,
+                               uint32_t fracBits,
+                               int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+  @brief Correlation of 32-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_mean_f32s_xpulpv2(const float *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           float *__restrict__ pRes);
+void plp_correlate_q32s_xpulpv2(const int32_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *pSrcB,
+                                const uint32_t srcBLen,
+                                uint32_t fracBits,
+                                int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+  @brief Glue code for parallel correlation of 32-bit fixed point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits, at least 1
+  @param[in]  nPE      Number of cores to compute on
+  @param[out] pRes     output result returned here
+  @return     none
+ */
 
-void plp_mean_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_correlate_q32_parallel(const int32_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int32_t *pSrcB,
+                                const uint32_t srcBLen,
+                                uint32_t fracBits,
+                                const uint8_t nPE,
+                                int32_t *__restrict__ pRes);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+  @brief Parallel correlation of 32-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  task_args  pointer to plp_correlate_instance_q32 struct initialized by
+                         plp_correlate_q32_parallel
+  @return     none
+ */
 
-void plp_mean_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_correlate_q32p_xpulpv2(void *task_args);
+
+/* largest FFT lengths of plp_fftconv_* and plp_fftcorr_*, limited by the twiddle tables */
+#define PLP_FFTCONV_F32_MAX_LEN 2048
+#define PLP_FFTCONV_Q16_MAX_LEN 4096
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
-*/
+  @brief Block length of the FFT-based convolution and correlation.
+  @param[in]  srcALen  length of the first input vector
+  @param[in]  srcBLen  length of the second input vector
+  @param[in]  maxLen   largest supported FFT length
+  @return     the FFT length, or 0 if the direct form is cheaper
+ */
 
-void plp_mean_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+uint32_t plp_fftconv_block_len(uint32_t srcALen, uint32_t srcBLen, uint32_t maxLen);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+  @brief Glue code for the FFT-based convolution of 32-bit floating point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+  @return     none
+ */
 
-void plp_mean_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_fftconv_f32(const float32_t *pSrcA,
+                     const uint32_t srcALen,
+                     const float32_t *pSrcB,
+                     const uint32_t srcBLen,
+                     float32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+  @brief Glue code for the FFT-based correlation of 32-bit floating point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+  @return     none
+ */
 
-void plp_mean_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+void plp_fftcorr_f32(const float32_t *pSrcA,
+                     const uint32_t srcALen,
+                     const float32_t *pSrcB,
+                     const uint32_t srcBLen,
+                     float32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
-*/
+  @brief Glue code for the FFT-based convolution of 16-bit fixed point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits of the result
+  @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+  @return     none
+ */
 
-void plp_mean_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int16_t *__restrict__ pRes);
+void plp_fftconv_q16(const int16_t *pSrcA,
+                     const uint32_t srcALen,
+                     const int16_t *pSrcB,
+                     const uint32_t srcBLen,
+                     uint32_t fracBits,
+                     int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for mean value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+  @brief Glue code for the FFT-based correlation of 16-bit fixed point vectors.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  fracBits number of fractional bits of the result
+  @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+  @return     none
+ */
 
-void plp_mean_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_fftcorr_q16(const int16_t *pSrcA,
+                     const uint32_t srcALen,
+                     const int16_t *pSrcB,
+                     const uint32_t srcBLen,
+                     uint32_t fracBits,
+                     int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    mean value returned here
-    @return     none
-*/
+  @brief FFT-based convolution or correlation of 32-bit floating point vectors for XPULPV2.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  corrFlag 0 for the convolution, 1 for the correlation
+  @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+  @return     none
+ */
 
-void plp_mean_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+void plp_fftconv_f32s_xpulpv2(const float32_t *pSrcA,
+                              uint32_t srcALen,
+                              const float32_t *pSrcB,
+                              uint32_t srcBLen,
+                              uint8_t corrFlag,
+                              float32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Mean value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    mean value returned here
-    @return     none
-*/
+  @brief FFT-based convolution or correlation of 16-bit fixed point vectors for RV32IM.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  corrFlag 0 for the convolution, 1 for the correlation
+  @param[in]  fracBits number of fractional bits of the result
+  @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+  @return     none
+ */
 
-void plp_mean_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int8_t *__restrict__ pRes);
+void plp_fftconv_q16s_rv32im(const int16_t *pSrcA,
+                             uint32_t srcALen,
+                             const int16_t *pSrcB,
+                             uint32_t srcBLen,
+                             uint8_t corrFlag,
+                             uint32_t fracBits,
+                             int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+  @brief FFT-based convolution or correlation of 16-bit fixed point vectors for XPULPV2.
+  @param[in]  pSrcA    points to the first input vector
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  corrFlag 0 for the convolution, 1 for the correlation
+  @param[in]  fracBits number of fractional bits of the result
+  @param[out] pRes     output result returned here, srcALen + srcBLen - 1 values
+  @return     none
+ */
 
-void plp_max_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_fftconv_q16s_xpulpv2(const int16_t *pSrcA,
+                              uint32_t srcALen,
+                              const int16_t *pSrcB,
+                              uint32_t srcBLen,
+                              uint8_t corrFlag,
+                              uint32_t fracBits,
+                              int32_t *pRes);
 
 /** -------------------------------------------------------
-    @brief      Kernel for max value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+  @brief Initialization of the 8-bit integer FIR filter instance.
+  @param[out] S          points to an instance of the FIR filter structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  blockSize  maximum number of samples processed per call
+  @return     none
+ */
 
-void plp_max_f32s_xpulpv2(const float *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          float *__restrict__ pRes);
+void plp_fir_init_i8(plp_fir_instance_i8 *S,
+                     uint32_t numTaps,
+                     const int8_t *pCoeffs,
+                     int8_t *pState,
+                     uint32_t blockSize);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+  @brief Glue code for the FIR filter of 8-bit integer vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_max_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_fir_i8(const plp_fir_instance_i8 *S,
+                const int8_t *__restrict__ pSrc,
+                uint32_t blockSize,
+                int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+  @brief Glue code for the parallel FIR filter of 8-bit integer vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_max_i32s_rv32im(const int32_t *__restrict__ pSrc,
+void plp_fir_i8_parallel(const plp_fir_instance_i8 *S,
+                         const int8_t *__restrict__ pSrc,
                          uint32_t blockSize,
-                         int32_t *__restrict__ pRes);
+                         uint32_t nPE,
+                         int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
-    @return     none
-*/
+  @brief FIR filter of 8-bit integer vectors kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_max_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_fir_i8s_rv32im(const plp_fir_instance_i8 *S,
+                        const int8_t *__restrict__ pSrc,
+                        uint32_t blockSize,
+                        int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+  @brief FIR filter of 8-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_max_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_fir_i8s_xpulpv2(const plp_fir_instance_i8 *S,
+                         const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+  @brief Parallel FIR filter of 8-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_instance_i8_parallel
+  @return     none
+ */
 
-void plp_max_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int16_t *__restrict__ pRes);
+void plp_fir_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
-    @return     none
-*/
+  @brief Initialization of the 16-bit integer FIR filter instance.
+  @param[out] S          points to an instance of the FIR filter structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  blockSize  maximum number of samples processed per call
+  @return     none
+ */
 
-void plp_max_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+void plp_fir_init_i16(plp_fir_instance_i16 *S,
+                      uint32_t numTaps,
+                      const int16_t *pCoeffs,
+                      int16_t *pState,
+                      uint32_t blockSize);
 
 /** -------------------------------------------------------
-    @brief      Glue code for max value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+  @brief Glue code for the FIR filter of 16-bit integer vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_max_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_fir_i16(const plp_fir_instance_i16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    max value returned here
-    @return     none
-*/
+  @brief Glue code for the parallel FIR filter of 16-bit integer vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_max_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        int8_t *__restrict__ pRes);
+void plp_fir_i16_parallel(const plp_fir_instance_i16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Max value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    max value returned here
-    @return     none
-*/
+  @brief FIR filter of 16-bit integer vectors kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_max_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+void plp_fir_i16s_rv32im(const plp_fir_instance_i16 *S,
+                         const int16_t *__restrict__ pSrc,
                          uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+                         int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
-*/
+  @brief FIR filter of 16-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_min_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_fir_i16s_xpulpv2(const plp_fir_instance_i16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for min value of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
-*/
+  @brief Parallel FIR filter of 16-bit integer vectors kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_instance_i16_parallel
+  @return     none
+ */
 
-void plp_min_f32s_xpulpv2(const float *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          float *__restrict__ pRes);
+void plp_fir_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
-*/
+  @brief Initialization of the 16-bit fixed point FIR filter instance.
+  @param[out] S          points to an instance of the FIR filter structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  blockSize  maximum number of samples processed per call
+  @param[in]  fracBits   number of fractional bits of the coefficients
+  @return     none
+ */
 
-void plp_min_i32(const int32_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_fir_init_q16(plp_fir_instance_q16 *S,
+                      uint32_t numTaps,
+                      const int16_t *pCoeffs,
+                      int16_t *pState,
+                      uint32_t blockSize,
+                      uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
-*/
+  @brief Glue code for the FIR filter of 16-bit fixed point vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_min_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int32_t *__restrict__ pRes);
+void plp_fir_q16(const plp_fir_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
-*/
+  @brief Glue code for the parallel FIR filter of 16-bit fixed point vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_min_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
+void plp_fir_q16_parallel(const plp_fir_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
                           uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+                          uint32_t nPE,
+                          int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
-*/
+  @brief FIR filter of 16-bit fixed point vectors kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_min_i16(const int16_t *__restrict__ pSrc, uint32_t blockSize, int16_t *__restrict__ pRes);
+void plp_fir_q16s_rv32im(const plp_fir_instance_q16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
-*/
+  @brief FIR filter of 16-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_min_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         int16_t *__restrict__ pRes);
+void plp_fir_q16s_xpulpv2(const plp_fir_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
-*/
+  @brief Parallel FIR filter of 16-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_instance_q16_parallel
+  @return     none
+ */
 
-void plp_min_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int16_t *__restrict__ pRes);
+void plp_fir_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for min value of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
-*/
+  @brief Initialization of the 32-bit fixed point FIR filter instance.
+  @param[out] S          points to an instance of the FIR filter structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  blockSize  maximum number of samples processed per call
+  @param[in]  fracBits   number of fractional bits of the coefficients
+  @return     none
+ */
 
-void plp_min_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int8_t *__restrict__ pRes);
+void plp_fir_init_q32(plp_fir_instance_q32 *S,
+                      uint32_t numTaps,
+                      const int32_t *pCoeffs,
+                      int32_t *pState,
+                      uint32_t blockSize,
+                      uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    min value returned here
-    @return     none
-*/
+  @brief Glue code for the FIR filter of 32-bit fixed point vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_min_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        int8_t *__restrict__ pRes);
+void plp_fir_q32(const plp_fir_instance_q32 *S,
+                 const int32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Min value of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    min value returned here
-    @return     none
-*/
+  @brief Glue code for the parallel FIR filter of 32-bit fixed point vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_min_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+void plp_fir_q32_parallel(const plp_fir_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief FIR filter of 32-bit fixed point vectors kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
+
+void plp_fir_q32s_rv32im(const plp_fir_instance_q32 *S,
+                         const int32_t *__restrict__ pSrc,
                          uint32_t blockSize,
-                         int8_t *__restrict__ pRes);
+                         int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief FIR filter of 32-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_fir_q32s_xpulpv2(const plp_fir_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Sum of squares of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Parallel FIR filter of 32-bit fixed point vectors kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_instance_q32_parallel
+  @return     none
+ */
 
-void plp_power_f32_xpulpv2(const float *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           float *__restrict__ pRes);
+void plp_fir_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Initialization of the 32-bit floating point FIR filter instance.
+  @param[out] S          points to an instance of the FIR filter structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  blockSize  maximum number of samples processed per call
+  @return     none
+ */
 
-void plp_power_i32(const int32_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   int32_t *__restrict__ pRes);
+void plp_fir_init_f32(plp_fir_instance_f32 *S,
+                      uint32_t numTaps,
+                      const float32_t *pCoeffs,
+                      float32_t *pState,
+                      uint32_t blockSize);
+
+/** -------------------------------------------------------
+  @brief Glue code for the FIR filter of 32-bit floating point vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
+
+void plp_fir_f32(const plp_fir_instance_f32 *S,
+                 const float32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Glue code for the parallel FIR filter of 32-bit floating point vectors.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_i32s_rv32im(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+void plp_fir_f32_parallel(const plp_fir_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares returned here
-    @return     none
-*/
+  @brief FIR filter of 32-bit floating point vectors kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR filter structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_i32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            int32_t *__restrict__ pRes);
+void plp_fir_f32s_xpulpv2(const plp_fir_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 16-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Parallel FIR filter of 32-bit floating point vectors kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_instance_f32_parallel
+  @return     none
+ */
 
-void plp_power_i16(const int16_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   int32_t *__restrict__ pRes);
+void plp_fir_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Initialization of the 16-bit fixed point biquad cascade filter instance (DF1).
+  @param[out] S          points to an instance of the biquad cascade structure
+  @param[in]  numStages  number of second order stages
+  @param[in]  pCoeffs    points to the coefficients, 6 per stage
+  @param[in]  pState     points to the state buffer of length 4 * numStages
+  @param[in]  fracBits   number of fractional bits of the coefficients
+  @return     none
+ */
 
-void plp_power_i16s_rv32im(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_init_q16(plp_biquad_cascade_df1_instance_q16 *S,
+                                     uint32_t numStages,
+                                     const int16_t *pCoeffs,
+                                     int16_t *pState,
+                                     uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares returned here
-    @return     none
-*/
+  @brief Glue code for the 16-bit fixed point biquad cascade filter (DF1).
+  @param[in]  S          points to an instance of the biquad cascade structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q16(const plp_biquad_cascade_df1_instance_q16 *S,
+                                const int16_t *pSrc,
+                                uint32_t blockSize,
+                                int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 8-bit integer vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Glue code for the parallel 16-bit fixed point biquad cascade filter (DF1).
+  @param[in]  S          points to the array of nChannels filter instances
+  @param[in]  nChannels  number of independent channels
+  @param[in]  pSrc       points to the input samples, blockSize per channel
+  @param[in]  blockSize  number of samples per channel
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output samples, blockSize per channel
+  @return     none
+ */
 
-void plp_power_i8(const int8_t *__restrict__ pSrc, uint32_t blockSize, int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q16_parallel(const plp_biquad_cascade_df1_instance_q16 *S,
+                                         uint32_t nChannels,
+                                         const int16_t *pSrc,
+                                         uint32_t blockSize,
+                                         uint32_t nPE,
+                                         int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit integer vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief 16-bit fixed point biquad cascade filter (DF1) kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the biquad cascade structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_i8s_rv32im(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q16s_rv32im(const plp_biquad_cascade_df1_instance_q16 *S,
+                                        const int16_t *pSrc,
+                                        uint32_t blockSize,
+                                        int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit integer vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes    Sum of squares value returned here
-    @return     none
-*/
+  @brief 16-bit fixed point biquad cascade filter (DF1) kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the biquad cascade structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q16s_xpulpv2(const plp_biquad_cascade_df1_instance_q16 *S,
+                                         const int16_t *pSrc,
+                                         uint32_t blockSize,
+                                         int16_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Parallel 16-bit fixed point biquad cascade filter (DF1) kernel for XPULPV2
+  extension.
+  @param[in]  args  points to the plp_biquad_cascade_df1_instance_q16_parallel
+  @return     none
+ */
 
-void plp_power_q32(const int32_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   uint32_t fracBits,
-                   int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares value returned here
-    @return     none
-*/
+  @brief Initialization of the 32-bit fixed point biquad cascade filter instance (DF1).
+  @param[out] S          points to an instance of the biquad cascade structure
+  @param[in]  numStages  number of second order stages
+  @param[in]  pCoeffs    points to the coefficients, 5 per stage
+  @param[in]  pState     points to the state buffer of length 4 * numStages
+  @param[in]  fracBits   number of fractional bits of the coefficients
+  @return     none
+ */
 
-void plp_power_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_init_q32(plp_biquad_cascade_df1_instance_q32 *S,
+                                     uint32_t numStages,
+                                     const int32_t *pCoeffs,
+                                     int32_t *pState,
+                                     uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 32-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares returned here
-    @return     none
-*/
+  @brief Glue code for the 32-bit fixed point biquad cascade filter (DF1).
+  @param[in]  S          points to an instance of the biquad cascade structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            uint32_t fracBits,
-                            int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q32(const plp_biquad_cascade_df1_instance_q32 *S,
+                                const int32_t *pSrc,
+                                uint32_t blockSize,
+                                int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Glue code for the parallel 32-bit fixed point biquad cascade filter (DF1).
+  @param[in]  S          points to the array of nChannels filter instances
+  @param[in]  nChannels  number of independent channels
+  @param[in]  pSrc       points to the input samples, blockSize per channel
+  @param[in]  blockSize  number of samples per channel
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output samples, blockSize per channel
+  @return     none
+ */
 
-void plp_power_q16(const int16_t *__restrict__ pSrc,
-                   uint32_t blockSize,
-                   uint32_t fracBits,
-                   int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q32_parallel(const plp_biquad_cascade_df1_instance_q32 *S,
+                                         uint32_t nChannels,
+                                         const int32_t *pSrc,
+                                         uint32_t blockSize,
+                                         uint32_t nPE,
+                                         int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief 32-bit fixed point biquad cascade filter (DF1) kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the biquad cascade structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q32s_rv32im(const plp_biquad_cascade_df1_instance_q32 *S,
+                                        const int32_t *pSrc,
+                                        uint32_t blockSize,
+                                        int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 16-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares returned here
-    @return     none
-*/
+  @brief 32-bit fixed point biquad cascade filter (DF1) kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the biquad cascade structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                            uint32_t blockSize,
-                            uint32_t fracBits,
-                            int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q32s_xpulpv2(const plp_biquad_cascade_df1_instance_q32 *S,
+                                         const int32_t *pSrc,
+                                         uint32_t blockSize,
+                                         int32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Sum of squares of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Parallel 32-bit fixed point biquad cascade filter (DF1) kernel for XPULPV2
+  extension.
+  @param[in]  args  points to the plp_biquad_cascade_df1_instance_q32_parallel
+  @return     none
+ */
 
-void plp_power_q8(const int8_t *__restrict__ pSrc,
-                  uint32_t blockSize,
-                  uint32_t fracBits,
-                  int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df1_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Sum of squares returned here
-    @return     none
-*/
+  @brief Initialization of the 32-bit floating point biquad cascade filter instance (DF2T).
+  @param[out] S          points to an instance of the biquad cascade structure
+  @param[in]  numStages  number of second order stages
+  @param[in]  pCoeffs    points to the coefficients, 5 per stage
+  @param[in]  pState     points to the state buffer of length 2 * numStages
+  @return     none
+ */
 
-void plp_power_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df2T_init_f32(plp_biquad_cascade_df2T_instance_f32 *S,
+                                      uint32_t numStages,
+                                      const float32_t *pCoeffs,
+                                      float32_t *pState);
 
 /** -------------------------------------------------------
-    @brief      Sum of squares of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Sum of squares value returned here
-    @return     none
-*/
+  @brief Glue code for the 32-bit floating point biquad cascade filter (DF2T).
+  @param[in]  S          points to an instance of the biquad cascade structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                           uint32_t blockSize,
-                           uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df2T_f32(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                 const float32_t *pSrc,
+                                 uint32_t blockSize,
+                                 float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
-*/
+  @brief Glue code for the parallel 32-bit floating point biquad cascade filter (DF2T).
+  @param[in]  S          points to the array of nChannels filter instances
+  @param[in]  nChannels  number of independent channels
+  @param[in]  pSrc       points to the input samples, blockSize per channel
+  @param[in]  blockSize  number of samples per channel
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the output samples, blockSize per channel
+  @return     none
+ */
 
-void plp_var_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_biquad_cascade_df2T_f32_parallel(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                          uint32_t nChannels,
+                                          const float32_t *pSrc,
+                                          uint32_t blockSize,
+                                          uint32_t nPE,
+                                          float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical variance of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
-*/
+  @brief 32-bit floating point biquad cascade filter (DF2T) kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the biquad cascade structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pDst       points to the block of output samples
+  @return     none
+ */
 
-void plp_var_f32_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_biquad_cascade_df2T_f32s_xpulpv2(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                          const float32_t *pSrc,
+                                          uint32_t blockSize,
+                                          float32_t *pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
-*/
+  @brief Parallel 32-bit floating point biquad cascade filter (DF2T) kernel for XPULPV2
+  extension.
+  @param[in]  args  points to the plp_biquad_cascade_df2T_instance_f32_parallel
+  @return     none
+ */
 
-void plp_var_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_biquad_cascade_df2T_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance value returned here
-    @return     none
-*/
+  @brief Initialization of the 16-bit fixed point FIR decimation filter instance.
+  @param[out] S          points to an instance of the FIR decimation structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  M          decimation factor
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  blockSize  maximum number of input samples processed per call
+  @param[in]  fracBits   number of fractional bits of the coefficients
+  @return     0 on success, 1 if M is zero or blockSize is not a multiple of M
+ */
 
-void plp_var_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+int plp_fir_decimate_init_q16(plp_fir_decimate_instance_q16 *S,
+                              uint32_t numTaps,
+                              uint32_t M,
+                              const int16_t *pCoeffs,
+                              int16_t *pState,
+                              uint32_t blockSize,
+                              uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 32-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance returned here
-    @return     none
-*/
+  @brief Glue code for the 16-bit fixed point FIR decimation filter.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_var_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+void plp_fir_decimate_q16(const plp_fir_decimate_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
                           uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+                          int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
-*/
+  @brief Glue code for the parallel 16-bit fixed point FIR decimation filter.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_var_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_fir_decimate_q16_parallel(const plp_fir_decimate_instance_q16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
-*/
+  @brief 16-bit fixed point FIR decimation filter kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_var_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_fir_decimate_q16s_rv32im(const plp_fir_decimate_instance_q16 *S,
+                                  const int16_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 16-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance returned here
-    @return     none
-*/
+  @brief 16-bit fixed point FIR decimation filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_fir_decimate_q16s_xpulpv2(const plp_fir_decimate_instance_q16 *S,
+                                   const int16_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical variance of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
-*/
+  @brief Parallel 16-bit fixed point FIR decimation filter kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_decimate_instance_q16_parallel
+  @return     none
+ */
 
-void plp_var_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_fir_decimate_q16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical variance returned here
-    @return     none
-*/
+  @brief Initialization of the 32-bit fixed point FIR decimation filter instance.
+  @param[out] S          points to an instance of the FIR decimation structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  M          decimation factor
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  blockSize  maximum number of input samples processed per call
+  @param[in]  fracBits   number of fractional bits of the coefficients
+  @return     0 on success, 1 if M is zero or blockSize is not a multiple of M
+ */
 
-void plp_var_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+int plp_fir_decimate_init_q32(plp_fir_decimate_instance_q32 *S,
+                              uint32_t numTaps,
+                              uint32_t M,
+                              const int32_t *pCoeffs,
+                              int32_t *pState,
+                              uint32_t blockSize,
+                              uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Statisical variance of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical variance value returned here
-    @return     none
-*/
+  @brief Glue code for the 32-bit fixed point FIR decimation filter.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
+void plp_fir_decimate_q32(const plp_fir_decimate_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Glue code for the parallel 32-bit fixed point FIR decimation filter.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_std_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_fir_decimate_q32_parallel(const plp_fir_decimate_instance_q32 *S,
+                                   const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief 32-bit fixed point FIR decimation filter kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_std_f32_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_fir_decimate_q32s_rv32im(const plp_fir_decimate_instance_q32 *S,
+                                  const int32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief 32-bit fixed point FIR decimation filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_std_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_fir_decimate_q32s_xpulpv2(const plp_fir_decimate_instance_q32 *S,
+                                   const int32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation value returned here
-    @return     none
-*/
+  @brief Parallel 32-bit fixed point FIR decimation filter kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_decimate_instance_q32_parallel
+  @return     none
+ */
 
-void plp_std_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_fir_decimate_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Initialization of the 32-bit floating point FIR decimation filter instance.
+  @param[out] S          points to an instance of the FIR decimation structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  M          decimation factor
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  blockSize  maximum number of input samples processed per call
+  @return     0 on success, 1 if M is zero or blockSize is not a multiple of M
+ */
 
-void plp_std_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+int plp_fir_decimate_init_f32(plp_fir_decimate_instance_f32 *S,
+                              uint32_t numTaps,
+                              uint32_t M,
+                              const float32_t *pCoeffs,
+                              float32_t *pState,
+                              uint32_t blockSize);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Glue code for the 32-bit floating point FIR decimation filter.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_std_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_fir_decimate_f32(const plp_fir_decimate_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Glue code for the parallel 32-bit floating point FIR decimation filter.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_std_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_fir_decimate_f32_parallel(const plp_fir_decimate_instance_f32 *S,
+                                   const float32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   uint32_t nPE,
+                                   float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
-    @return     none
-*/
+  @brief 32-bit floating point FIR decimation filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR decimation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize / M output samples
+  @return     none
+ */
 
-void plp_std_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_fir_decimate_f32s_xpulpv2(const plp_fir_decimate_instance_f32 *S,
+                                   const float32_t *__restrict__ pSrc,
+                                   uint32_t blockSize,
+                                   float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Parallel 32-bit floating point FIR decimation filter kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_decimate_instance_f32_parallel
+  @return     none
+ */
 
-void plp_std_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_fir_decimate_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Initialization of the 16-bit fixed point FIR interpolation filter instance.
+  @param[out] S          points to an instance of the FIR interpolation structure
+  @param[in]  L          interpolation factor
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps / L + blockSize - 1
+  @param[in]  blockSize  maximum number of input samples processed per call
+  @param[in]  fracBits   number of fractional bits of the coefficients
+  @return     0 on success, 1 if L is zero or numTaps is not a multiple of L
+ */
 
-void plp_std_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+int plp_fir_interpolate_init_q16(plp_fir_interpolate_instance_q16 *S,
+                                 uint32_t L,
+                                 uint32_t numTaps,
+                                 const int16_t *pCoeffs,
+                                 int16_t *pState,
+                                 uint32_t blockSize,
+                                 uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation value returned here
-    @return     none
-*/
+  @brief Glue code for the 16-bit fixed point FIR interpolation filter.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
+
+void plp_fir_interpolate_q16(const plp_fir_interpolate_instance_q16 *S,
+                             const int16_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int16_t *__restrict__ pDst);
 
-void plp_std_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit floating point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Glue code for the parallel 16-bit fixed point FIR interpolation filter.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_rms_f32(const float *__restrict__ pSrc, uint32_t blockSize, float *__restrict__ pRes);
+void plp_fir_interpolate_q16_parallel(const plp_fir_interpolate_instance_q16 *S,
+                                      const int16_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Kernel for Statisical standard deviation of a 32-bit float vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief 16-bit fixed point FIR interpolation filter kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_rms_f32_xpulpv2(const float *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         float *__restrict__ pRes);
+void plp_fir_interpolate_q16s_rv32im(const plp_fir_interpolate_instance_q16 *S,
+                                     const int16_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 32-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief 16-bit fixed point FIR interpolation filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_rms_q32(const int32_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int32_t *__restrict__ pRes);
+void plp_fir_interpolate_q16s_xpulpv2(const plp_fir_interpolate_instance_q16 *S,
+                                      const int16_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int16_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation value returned here
-    @return     none
-*/
+  @brief Parallel 16-bit fixed point FIR interpolation filter kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_interpolate_instance_q16_parallel
+  @return     none
+ */
 
-void plp_rms_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int32_t *__restrict__ pRes);
+void plp_fir_interpolate_q16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Initialization of the 32-bit fixed point FIR interpolation filter instance.
+  @param[out] S          points to an instance of the FIR interpolation structure
+  @param[in]  L          interpolation factor
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps / L + blockSize - 1
+  @param[in]  blockSize  maximum number of input samples processed per call
+  @param[in]  fracBits   number of fractional bits of the coefficients
+  @return     0 on success, 1 if L is zero or numTaps is not a multiple of L
+ */
+
+int plp_fir_interpolate_init_q32(plp_fir_interpolate_instance_q32 *S,
+                                 uint32_t L,
+                                 uint32_t numTaps,
+                                 const int32_t *pCoeffs,
+                                 int32_t *pState,
+                                 uint32_t blockSize,
+                                 uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 32-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Glue code for the 32-bit fixed point FIR interpolation filter.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_fir_interpolate_q32(const plp_fir_interpolate_instance_q32 *S,
+                             const int32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 16-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Glue code for the parallel 32-bit fixed point FIR interpolation filter.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_rms_q16(const int16_t *__restrict__ pSrc,
-                 uint32_t blockSize,
-                 uint32_t fracBits,
-                 int16_t *__restrict__ pRes);
+void plp_fir_interpolate_q32_parallel(const plp_fir_interpolate_instance_q32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief 32-bit fixed point FIR interpolation filter kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_rms_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int16_t *__restrict__ pRes);
+void plp_fir_interpolate_q32s_rv32im(const plp_fir_interpolate_instance_q32 *S,
+                                     const int32_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 16-bit fixed point vector for XPULPV2
-    extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation returned here
-    @return     none
-*/
+  @brief 32-bit fixed point FIR interpolation filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                          uint32_t blockSize,
-                          uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_fir_interpolate_q32s_xpulpv2(const plp_fir_interpolate_instance_q32 *S,
+                                      const int32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for Statisical standard deviation of a 8-bit fixed point vector.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Parallel 32-bit fixed point FIR interpolation filter kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_interpolate_instance_q32_parallel
+  @return     none
+ */
 
-void plp_rms_q8(const int8_t *__restrict__ pSrc,
-                uint32_t blockSize,
-                uint32_t fracBits,
-                int8_t *__restrict__ pRes);
+void plp_fir_interpolate_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for RV32IM extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pResult    Statisical standard deviation returned here
-    @return     none
-*/
+  @brief Initialization of the 32-bit floating point FIR interpolation filter instance.
+  @param[out] S          points to an instance of the FIR interpolation structure
+  @param[in]  L          interpolation factor
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps / L + blockSize - 1
+  @param[in]  blockSize  maximum number of input samples processed per call
+  @return     0 on success, 1 if L is zero or numTaps is not a multiple of L
+ */
 
-void plp_rms_q8s_rv32im(const int8_t *__restrict__ pSrc,
-                        uint32_t blockSize,
-                        uint32_t fracBits,
-                        int8_t *__restrict__ pRes);
+int plp_fir_interpolate_init_f32(plp_fir_interpolate_instance_f32 *S,
+                                 uint32_t L,
+                                 uint32_t numTaps,
+                                 const float32_t *pCoeffs,
+                                 float32_t *pState,
+                                 uint32_t blockSize);
 
 /** -------------------------------------------------------
-    @brief      Statisical standard deviation of a 8-bit fixed point vector for XPULPV2 extension.
-    @param[in]  pSrc       points to the input vector
-    @param[in]  blockSize  number of samples in input vector
-    @param[out] pRes       Statisical standard deviation value returned here
-    @return     none
-*/
+  @brief Glue code for the 32-bit floating point FIR interpolation filter.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
-                         uint32_t blockSize,
-                         uint32_t fracBits,
-                         int8_t *__restrict__ pRes);
+void plp_fir_interpolate_f32(const plp_fir_interpolate_instance_f32 *S,
+                             const float32_t *__restrict__ pSrc,
+                             uint32_t blockSize,
+                             float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Glue code for square root of a 32-bit fixed point number.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
-*/
+  @brief Glue code for the parallel 32-bit floating point FIR interpolation filter.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[in]  nPE        number of parallel processing units
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_sqrt_q32(const int32_t *__restrict__ pSrc,
-                  const uint32_t fracBits,
-                  int32_t *__restrict__ pRes);
+void plp_fir_interpolate_f32_parallel(const plp_fir_interpolate_instance_f32 *S,
+                                      const float32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      uint32_t nPE,
+                                      float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
-*/
+  @brief 32-bit floating point FIR interpolation filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the FIR interpolation structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  blockSize  number of input samples to process
+  @param[out] pDst       points to the block of blockSize * L output samples
+  @return     none
+ */
 
-void plp_sqrt_q32s_rv32im(const int32_t *__restrict__ pSrc,
-                          const uint32_t fracBits,
-                          int32_t *__restrict__ pRes);
+void plp_fir_interpolate_f32s_xpulpv2(const plp_fir_interpolate_instance_f32 *S,
+                                      const float32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 32-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   32-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
-*/
+  @brief Parallel 32-bit floating point FIR interpolation filter kernel for XPULPV2 extension.
+  @param[in]  args  points to the plp_fir_interpolate_instance_f32_parallel
+  @return     none
+ */
 
-void plp_sqrt_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
-                           const uint32_t fracBits,
-                           int32_t *__restrict__ pRes);
+void plp_fir_interpolate_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief      Glue code for square root of a 16-bit fixed point number.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
-*/
+  @brief Initialization of the 16-bit fixed point LMS filter instance.
+  @param[out] S          points to an instance of the LMS structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the initial coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  mu         step size
+  @param[in]  blockSize  maximum number of samples processed per call
+  @param[in]  fracBits   number of fractional bits of all values
+  @return     none
+ */
 
-void plp_sqrt_q16(const int16_t *__restrict__ pSrc,
-                  const uint32_t fracBits,
-                  int16_t *__restrict__ pRes);
+void plp_lms_init_q16(plp_lms_instance_q16 *S,
+                      uint32_t numTaps,
+                      int16_t *pCoeffs,
+                      int16_t *pState,
+                      int16_t mu,
+                      uint32_t blockSize,
+                      uint32_t fracBits);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
-*/
+  @brief Glue code for the 16-bit fixed point LMS filter.
+  @param[in]  S          points to an instance of the LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
+ */
 
-void plp_sqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
-                          const uint32_t fracBits,
-                          int16_t *__restrict__ pRes);
+void plp_lms_q16(plp_lms_instance_q16 *S,
+                 const int16_t *__restrict__ pSrc,
+                 const int16_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 int16_t *__restrict__ pOut,
+                 int16_t *__restrict__ pErr);
 
 /** -------------------------------------------------------
-    @brief      Square root of a 16-bit fixed point number for XPULPV2 extension.
-    @param[in]  in   16-Bit input integer
-    @param[out] out  Square root of the input
-    @return     none
-*/
+  @brief 16-bit fixed point LMS filter kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
+ */
 
-void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
-                           const uint32_t fracBits,
-                           int16_t *__restrict__ pRes);
+void plp_lms_q16s_rv32im(plp_lms_instance_q16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         const int16_t *__restrict__ pRef,
+                         uint32_t blockSize,
+                         int16_t *__restrict__ pOut,
+                         int16_t *__restrict__ pErr);
 
+/** -------------------------------------------------------
+  @brief 16-bit fixed point LMS filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
+ */
 
-/**
-   @brief         Glue code for square root of a 32-bit floating point number.
-   @param[in]     pSrc       points to the input vectoro
-   @param[out]    pRes    Square root returned here
-   @return        none
+void plp_lms_q16s_xpulpv2(plp_lms_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          const int16_t *__restrict__ pRef,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pOut,
+                          int16_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief Initialization of the 32-bit fixed point LMS filter instance.
+  @param[out] S          points to an instance of the LMS structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the initial coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  mu         step size
+  @param[in]  blockSize  maximum number of samples processed per call
+  @param[in]  fracBits   number of fractional bits of all values
+  @return     none
  */
 
-void plp_sqrt_f32(const float *__restrict__ pSrc, 
-                  float *__restrict__ pRes);
+void plp_lms_init_q32(plp_lms_instance_q32 *S,
+                      uint32_t numTaps,
+                      int32_t *pCoeffs,
+                      int32_t *pState,
+                      int32_t mu,
+                      uint32_t blockSize,
+                      uint32_t fracBits);
 
+/** -------------------------------------------------------
+  @brief Glue code for the 32-bit fixed point LMS filter.
+  @param[in]  S          points to an instance of the LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
+ */
 
-/**
- * @brief Macros required for SINE and COSINE Fast math approximations
+void plp_lms_q32(plp_lms_instance_q32 *S,
+                 const int32_t *__restrict__ pSrc,
+                 const int32_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 int32_t *__restrict__ pOut,
+                 int32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief 32-bit fixed point LMS filter kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-#define FAST_MATH_TABLE_SIZE 512
-#define FAST_MATH_Q32_SHIFT (32 - 10)
-#define FAST_MATH_Q16_SHIFT (16 - 10)
-#define CONTROLLER_Q32_SHIFT (32 - 9)
-#define TABLE_SPACING_Q32 0x400000
-#define TABLE_SPACING_Q16 0x80
+void plp_lms_q32s_rv32im(plp_lms_instance_q32 *S,
+                         const int32_t *__restrict__ pSrc,
+                         const int32_t *__restrict__ pRef,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pOut,
+                         int32_t *__restrict__ pErr);
 
-/**
- * @brief      Glue code for q32 cosine function
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief 32-bit fixed point LMS filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-int32_t plp_cos_q32(int32_t x);
+void plp_lms_q32s_xpulpv2(plp_lms_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          const int32_t *__restrict__ pRef,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pOut,
+                          int32_t *__restrict__ pErr);
 
-/**
- * @brief      q32 cosine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief Initialization of the 32-bit floating point LMS filter instance.
+  @param[out] S          points to an instance of the LMS structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the initial coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  mu         step size
+  @param[in]  blockSize  maximum number of samples processed per call
+  @return     none
  */
 
-int32_t plp_cos_q32s_rv32im(int32_t x);
+void plp_lms_init_f32(plp_lms_instance_f32 *S,
+                      uint32_t numTaps,
+                      float32_t *pCoeffs,
+                      float32_t *pState,
+                      float32_t mu,
+                      uint32_t blockSize);
 
-/**
- * @brief      q32 cosine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief Glue code for the 32-bit floating point LMS filter.
+  @param[in]  S          points to an instance of the LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-int32_t plp_cos_q32s_xpulpv2(int32_t x);
+void plp_lms_f32(plp_lms_instance_f32 *S,
+                 const float32_t *__restrict__ pSrc,
+                 const float32_t *__restrict__ pRef,
+                 uint32_t blockSize,
+                 float32_t *__restrict__ pOut,
+                 float32_t *__restrict__ pErr);
 
-/**
- * @brief      Glue code for q16 cosine function
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief 32-bit floating point LMS filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-int16_t plp_cos_q16(int16_t x);
+void plp_lms_f32s_xpulpv2(plp_lms_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          const float32_t *__restrict__ pRef,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pOut,
+                          float32_t *__restrict__ pErr);
 
-/**
- * @brief      q16 cosine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief Initialization of the 16-bit fixed point normalized LMS filter instance.
+  @param[out] S          points to an instance of the normalized LMS structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the initial coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  mu         step size
+  @param[in]  blockSize  maximum number of samples processed per call
+  @param[in]  fracBits   number of fractional bits of all values
+  @return     none
  */
 
-int16_t plp_cos_q16s_rv32im(int16_t x);
+void plp_lms_norm_init_q16(plp_lms_norm_instance_q16 *S,
+                           uint32_t numTaps,
+                           int16_t *pCoeffs,
+                           int16_t *pState,
+                           int16_t mu,
+                           uint32_t blockSize,
+                           uint32_t fracBits);
 
-/**
- * @brief      q16 cosine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief Glue code for the 16-bit fixed point normalized LMS filter.
+  @param[in]  S          points to an instance of the normalized LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-int16_t plp_cos_q16s_xpulpv2(int16_t x);
+void plp_lms_norm_q16(plp_lms_norm_instance_q16 *S,
+                      const int16_t *__restrict__ pSrc,
+                      const int16_t *__restrict__ pRef,
+                      uint32_t blockSize,
+                      int16_t *__restrict__ pOut,
+                      int16_t *__restrict__ pErr);
 
-/**
- * @brief      Glue code for f32 cosine function
- *
- * @param[in]  x     input value in radians
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief 16-bit fixed point normalized LMS filter kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the normalized LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-float32_t plp_cos_f32(float32_t x);
+void plp_lms_norm_q16s_rv32im(plp_lms_norm_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              const int16_t *__restrict__ pRef,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pOut,
+                              int16_t *__restrict__ pErr);
 
-/**
- * @brief      F32 cosine function for XPULPV2
- *
- * @param[in]  x     input value in radians
- *
- * @return     cos(x)
+/** -------------------------------------------------------
+  @brief 16-bit fixed point normalized LMS filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the normalized LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-float32_t plp_cos_f32s_xpulpv2(float32_t x);
+void plp_lms_norm_q16s_xpulpv2(plp_lms_norm_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               const int16_t *__restrict__ pRef,
+                               uint32_t blockSize,
+                               int16_t *__restrict__ pOut,
+                               int16_t *__restrict__ pErr);
 
-/**
- * @brief      Glue code for q32 sine function
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief Initialization of the 32-bit fixed point normalized LMS filter instance.
+  @param[out] S          points to an instance of the normalized LMS structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the initial coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  mu         step size
+  @param[in]  blockSize  maximum number of samples processed per call
+  @param[in]  fracBits   number of fractional bits of all values
+  @return     none
  */
 
-int32_t plp_sin_q32(int32_t x);
+void plp_lms_norm_init_q32(plp_lms_norm_instance_q32 *S,
+                           uint32_t numTaps,
+                           int32_t *pCoeffs,
+                           int32_t *pState,
+                           int32_t mu,
+                           uint32_t blockSize,
+                           uint32_t fracBits);
 
-/**
- * @brief      q32 sine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief Glue code for the 32-bit fixed point normalized LMS filter.
+  @param[in]  S          points to an instance of the normalized LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-int32_t plp_sin_q32s_rv32im(int32_t x);
+void plp_lms_norm_q32(plp_lms_norm_instance_q32 *S,
+                      const int32_t *__restrict__ pSrc,
+                      const int32_t *__restrict__ pRef,
+                      uint32_t blockSize,
+                      int32_t *__restrict__ pOut,
+                      int32_t *__restrict__ pErr);
 
-/**
- * @brief      q32 sine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.31 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief 32-bit fixed point normalized LMS filter kernel for RV32IM extension.
+  @param[in]  S          points to an instance of the normalized LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-int32_t plp_sin_q32s_xpulpv2(int32_t x);
+void plp_lms_norm_q32s_rv32im(plp_lms_norm_instance_q32 *S,
+                              const int32_t *__restrict__ pSrc,
+                              const int32_t *__restrict__ pRef,
+                              uint32_t blockSize,
+                              int32_t *__restrict__ pOut,
+                              int32_t *__restrict__ pErr);
 
-/**
- * @brief      Glue code for q16 sine function
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief 32-bit fixed point normalized LMS filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the normalized LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-int16_t plp_sin_q16(int16_t x);
+void plp_lms_norm_q32s_xpulpv2(plp_lms_norm_instance_q32 *S,
+                               const int32_t *__restrict__ pSrc,
+                               const int32_t *__restrict__ pRef,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pOut,
+                               int32_t *__restrict__ pErr);
 
-/**
- * @brief      q16 sine function for RV32IM
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief Initialization of the 32-bit floating point normalized LMS filter instance.
+  @param[out] S          points to an instance of the normalized LMS structure
+  @param[in]  numTaps    number of filter coefficients
+  @param[in]  pCoeffs    points to the initial coefficients in time-reversed order
+  @param[in]  pState     points to the state buffer of length numTaps + blockSize - 1
+  @param[in]  mu         step size
+  @param[in]  blockSize  maximum number of samples processed per call
+  @return     none
  */
 
-int16_t plp_sin_q16s_rv32im(int16_t x);
+void plp_lms_norm_init_f32(plp_lms_norm_instance_f32 *S,
+                           uint32_t numTaps,
+                           float32_t *pCoeffs,
+                           float32_t *pState,
+                           float32_t mu,
+                           uint32_t blockSize);
 
-/**
- * @brief      q16 sine function for XPULPV2
- *
- * @param[in]  x     Scaled input value: Q1.15 value in range [0, +0.9999] and is mapped to [0,
- * 2*PI)
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief Glue code for the 32-bit floating point normalized LMS filter.
+  @param[in]  S          points to an instance of the normalized LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-int16_t plp_sin_q16s_xpulpv2(int16_t x);
+void plp_lms_norm_f32(plp_lms_norm_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      const float32_t *__restrict__ pRef,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pOut,
+                      float32_t *__restrict__ pErr);
 
-/**
- * @brief      Glue code for f32 sine function
- *
- * @param[in]  x     input value in radians
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief 32-bit floating point normalized LMS filter kernel for XPULPV2 extension.
+  @param[in]  S          points to an instance of the normalized LMS structure
+  @param[in]  pSrc       points to the block of input samples
+  @param[in]  pRef       points to the block of reference (desired) samples
+  @param[in]  blockSize  number of samples to process
+  @param[out] pOut       points to the block of filter outputs
+  @param[out] pErr       points to the block of errors, pRef - pOut
+  @return     none
  */
 
-float32_t plp_sin_f32(float32_t x);
+void plp_lms_norm_f32s_xpulpv2(plp_lms_norm_instance_f32 *S,
+                               const float32_t *__restrict__ pSrc,
+                               const float32_t *__restrict__ pRef,
+                               uint32_t blockSize,
+                               float32_t *__restrict__ pOut,
+                               float32_t *__restrict__ pErr);
+
+/** -------------------------------------------------------
+  @brief Glue code for the valid 2D convolution of 8-bit integer images.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
+ */
+
+void plp_conv2d_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t srcRows,
+                   uint32_t srcCols,
+                   const int8_t *__restrict__ pKernel,
+                   uint32_t kerRows,
+                   uint32_t kerCols,
+                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Glue code for the parallel valid 2D convolution of 8-bit integer images in L2.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[in]  nPE      number of cores to use
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
+ */
+
+void plp_conv2d_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t kerRows,
+                            uint32_t kerCols,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDst);
 
-/**
- * @brief      F32 sine function for XPULPV2
- *
- * @param[in]  x     input value in radians
- *
- * @return     sin(x)
+/** -------------------------------------------------------
+  @brief Valid 2D convolution of 8-bit integer images kernel for RV32IM extension.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
  */
 
-float32_t plp_sin_f32s_xpulpv2(float32_t x);
+void plp_conv2d_i8s_rv32im(const int8_t *__restrict__ pSrc,
+                           uint32_t srcRows,
+                           uint32_t srcCols,
+                           const int8_t *__restrict__ pKernel,
+                           uint32_t kerRows,
+                           uint32_t kerCols,
+                           int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief Glue code for correlation of 32-bit integer vectors.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none
-*/
+  @brief Valid 2D convolution of 8-bit integer images kernel for XPULPV2 extension.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
+ */
 
-void plp_correlate_i32(const int32_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int32_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+void plp_conv2d_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t kerRows,
+                            uint32_t kerCols,
+                            int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for RV32IM extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none
-*/
+  @brief Parallel tiled valid 2D convolution of 8-bit integer images kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_conv2d_instance_i8 struct initialized by
+                    plp_conv2d_i8_parallel
+  @return     none
+ */
 
-void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int32_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_conv2d_i8p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-    @brief Correlation of 32-bit integer vectors kernel for XPULPV2 extension.
-    @param[in]  pSrcA   points to the first input vector
-    @param[in]  srcALen Length of the first input vector
-    @param[in]  pSrcB   points to the second input vector
-    @param[in]  srcBLen Length of the second input vector
-    @param[out] pRes    output result returned here
-    @return     none */
+  @brief Glue code for the valid 2D convolution of 16-bit integer images.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
+ */
 
-void plp_correlate_i32s_xpulpv2(const int32_t *__restrict__ pSrcA,
-                                const uint32_t srcALen,
-                                const int32_t *__restrict__ pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *__restrict__ pRes);
+void plp_conv2d_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t srcRows,
+                    uint32_t srcCols,
+                    const int16_t *__restrict__ pKernel,
+                    uint32_t kerRows,
+                    uint32_t kerCols,
+                    int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 16-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    result returned here
+  @brief Glue code for the parallel valid 2D convolution of 16-bit integer images in L2.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[in]  nPE      number of cores to use
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
   @return     none
  */
 
-void plp_correlate_i16(const int16_t *pSrcA,
-                       const uint32_t srcALen,
-                       const int16_t *pSrcB,
-                       const uint32_t srcBLen,
-                       int32_t *pRes);
+void plp_conv2d_i16_parallel(const int16_t *__restrict__ pSrc,
+                             uint32_t srcRows,
+                             uint32_t srcCols,
+                             const int16_t *__restrict__ pKernel,
+                             uint32_t kerRows,
+                             uint32_t kerCols,
+                             uint32_t nPE,
+                             int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+  @brief Valid 2D convolution of 16-bit integer images kernel for RV32IM extension.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
+ */
 
-void plp_correlate_i16s_xpulpv2(const int16_t *pSrcA,
-                                const uint32_t srcALen,
-                                const int16_t *pSrcB,
-                                const uint32_t srcBLen,
-                                int32_t *pRes);
+void plp_conv2d_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            const int16_t *__restrict__ pKernel,
+                            uint32_t kerRows,
+                            uint32_t kerCols,
+                            int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Correlation of 16-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+  @brief Valid 2D convolution of 16-bit integer images kernel for XPULPV2 extension.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
+ */
 
-void plp_correlate_i16s_rv32im(const int16_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int16_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_conv2d_i16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                             uint32_t srcRows,
+                             uint32_t srcCols,
+                             const int16_t *__restrict__ pKernel,
+                             uint32_t kerRows,
+                             uint32_t kerCols,
+                             int32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief Parallel tiled valid 2D convolution of 16-bit integer images kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_conv2d_instance_i16 struct initialized by
+                    plp_conv2d_i16_parallel
   @return     none
  */
 
-void plp_correlate_i8(const int8_t *pSrcA,
-                      const uint32_t srcALen,
-                      const int8_t *pSrcB,
-                      const uint32_t srcBLen,
-                      int32_t *pRes);
+void plp_conv2d_i16p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
-  @brief Glue code for correlation (valid) of 8-bit integer vectors.
-  @param[in]  pSrcA   points to the first input vector
-  @param[in]  srcALen Length of the first input vector
-  @param[in]  pSrcB   points to the second input vector
-  @param[in]  srcBLen Length of the second input vector
-  @param[out] pRes    output result returned here
+  @brief Glue code for the valid 2D convolution of 32-bit floating point images.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
   @return     none
  */
 
-void plp_correlate_valid_i8(const int8_t *pSrcA,
-                            const uint32_t srcALen,
-                            const int8_t *pSrcB,
-                            const uint32_t srcBLen,
-                            int32_t *pRes);
+void plp_conv2d_f32(const float32_t *__restrict__ pSrc,
+                    uint32_t srcRows,
+                    uint32_t srcCols,
+                    const float32_t *__restrict__ pKernel,
+                    uint32_t kerRows,
+                    uint32_t kerCols,
+                    float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for XPULPV2 extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+  @brief Glue code for the parallel valid 2D convolution of 32-bit floating point images in L2.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[in]  nPE      number of cores to use
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
+ */
 
-void plp_correlate_i8s_xpulpv2(const int8_t *pSrcA,
-                               const uint32_t srcALen,
-                               const int8_t *pSrcB,
-                               const uint32_t srcBLen,
-                               int32_t *pRes);
+void plp_conv2d_f32_parallel(const float32_t *__restrict__ pSrc,
+                             uint32_t srcRows,
+                             uint32_t srcCols,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t kerRows,
+                             uint32_t kerCols,
+                             uint32_t nPE,
+                             float32_t *__restrict__ pDst);
 
 /** -------------------------------------------------------
-   @brief Correlation of 8-bit integer vectors kernel for RV32IM extension.
-   @param[in]  pSrcA   points to the first input vector
-   @param[in]  srcALen Length of the first input vector
-   @param[in]  pSrcB   points to the second input vector
-   @param[in]  srcBLen Length of the second input vector
-   @param[out] pRes    output result returned here
-   @return     none
-*/
+  @brief Valid 2D convolution of 32-bit floating point images kernel for XPULPV2 extension.
+  @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+  @param[in]  srcRows  number of rows of the input image
+  @param[in]  srcCols  number of columns of the input image
+  @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+  @param[in]  kerRows  number of rows of the filter kernel
+  @param[in]  kerCols  number of columns of the filter kernel
+  @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                       (srcCols - kerCols + 1) elements
+  @return     none
+ */
 
-void plp_correlate_i8s_rv32im(const int8_t *pSrcA,
-                              const uint32_t srcALen,
-                              const int8_t *pSrcB,
-                              const uint32_t srcBLen,
-                              int32_t *pRes);
+void plp_conv2d_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t srcRows,
+                             uint32_t srcCols,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t kerRows,
+                             uint32_t kerCols,
+                             float32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel tiled valid 2D convolution of 32-bit floating point images kernel for XPULPV2
+         extension.
+  @param[in]  args  pointer to plp_conv2d_instance_f32 struct initialized by
+                    plp_conv2d_f32_parallel
+  @return     none
+ */
+
+void plp_conv2d_f32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
   @brief Glue code for convolution of 32-bit integer vectors.
@@ -3894,6 +11310,138 @@ void plp_conv_valid_rep_i16s_xpulpv2(const int16_t *pSrcA,
                                      const uint32_t srcBLen,
                                      int32_t *pRes);
 
+/** -------------------------------------------------------
+  @brief Setup of the replicated L1 buffers for the convolution and correlation of 16-bit integer
+         vectors.
+  @param[out] S        points to the instance structure, to be passed to the kernels
+  @param[in]  pSrcA    points to the first input vector, in L2
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector, in L2
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  full     0: valid convolution, 1: full convolution (or correlation)
+  @param[in]  corr     0: convolution, 1: correlation
+  @return     0 on success, 1 if the buffers do not fit into L1
+ */
+
+int plp_conv_rep_init_i16(plp_conv_rep_instance_i16 *S,
+                          const int16_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int16_t *pSrcB,
+                          const uint32_t srcBLen,
+                          uint32_t full,
+                          uint32_t corr);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 16-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+  @return     none
+ */
+
+void plp_conv_rep_i16(const int16_t *pSrcA,
+                      const uint32_t srcALen,
+                      const int16_t *pSrcB,
+                      const uint32_t srcBLen,
+                      int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 16-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to use
+  @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+  @return     none
+ */
+
+void plp_conv_rep_i16_parallel(const int16_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int16_t *pSrcB,
+                               const uint32_t srcBLen,
+                               uint32_t nPE,
+                               int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 16-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+  @return     none
+ */
+
+void plp_correlate_rep_i16(const int16_t *pSrcA,
+                           const uint32_t srcALen,
+                           const int16_t *pSrcB,
+                           const uint32_t srcBLen,
+                           int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel correlation of 16-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to use
+  @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+  @return     none
+ */
+
+void plp_correlate_rep_i16_parallel(const int16_t *pSrcA,
+                                    const uint32_t srcALen,
+                                    const int16_t *pSrcB,
+                                    const uint32_t srcBLen,
+                                    uint32_t nPE,
+                                    int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel valid convolution of 16-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to use
+  @param[out] pRes    output result returned here, of size |srcALen - srcBLen| + 1
+  @return     none
+ */
+
+void plp_conv_valid_rep_i16_parallel(const int16_t *pSrcA,
+                                     const uint32_t srcALen,
+                                     const int16_t *pSrcB,
+                                     const uint32_t srcBLen,
+                                     uint32_t nPE,
+                                     int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Parallel 16-bit integer convolution with replicated data kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_conv_rep_instance_i16 struct initialized by
+                    plp_conv_rep_init_i16
+  @return     none
+ */
+
+void plp_conv_rep_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Convolution (valid) of 16-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_i16s_rv32im(const int16_t *pSrcA,
+                                const uint32_t srcALen,
+                                const int16_t *pSrcB,
+                                const uint32_t srcBLen,
+                                int32_t *pRes);
+
 /** -------------------------------------------------------
    @brief Convolution of 16-bit integer vectors kernel for RV32IM extension.
    @param[in]  pSrcA   points to the first input vector
@@ -4009,6 +11557,138 @@ void plp_conv_valid_rep_i8s_xpulpv2(const int8_t *pSrcA,
                                     const uint32_t srcBLen,
                                     int32_t *pRes);
 
+/** -------------------------------------------------------
+  @brief Setup of the replicated L1 buffers for the convolution and correlation of 8-bit integer
+         vectors.
+  @param[out] S        points to the instance structure, to be passed to the kernels
+  @param[in]  pSrcA    points to the first input vector, in L2
+  @param[in]  srcALen  Length of the first input vector
+  @param[in]  pSrcB    points to the second input vector, in L2
+  @param[in]  srcBLen  Length of the second input vector
+  @param[in]  full     0: valid convolution, 1: full convolution (or correlation)
+  @param[in]  corr     0: convolution, 1: correlation
+  @return     0 on success, 1 if the buffers do not fit into L1
+ */
+
+int plp_conv_rep_init_i8(plp_conv_rep_instance_i8 *S,
+                         const int8_t *pSrcA,
+                         const uint32_t srcALen,
+                         const int8_t *pSrcB,
+                         const uint32_t srcBLen,
+                         uint32_t full,
+                         uint32_t corr);
+
+/** -------------------------------------------------------
+  @brief Glue code for convolution of 8-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+  @return     none
+ */
+
+void plp_conv_rep_i8(const int8_t *pSrcA,
+                     const uint32_t srcALen,
+                     const int8_t *pSrcB,
+                     const uint32_t srcBLen,
+                     int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel convolution of 8-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to use
+  @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+  @return     none
+ */
+
+void plp_conv_rep_i8_parallel(const int8_t *pSrcA,
+                              const uint32_t srcALen,
+                              const int8_t *pSrcB,
+                              const uint32_t srcBLen,
+                              uint32_t nPE,
+                              int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for correlation of 8-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+  @return     none
+ */
+
+void plp_correlate_rep_i8(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel correlation of 8-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to use
+  @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+  @return     none
+ */
+
+void plp_correlate_rep_i8_parallel(const int8_t *pSrcA,
+                                   const uint32_t srcALen,
+                                   const int8_t *pSrcB,
+                                   const uint32_t srcBLen,
+                                   uint32_t nPE,
+                                   int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel valid convolution of 8-bit integer vectors with data replication.
+  @param[in]  pSrcA   points to the first input vector (in L2)
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector (in L2)
+  @param[in]  srcBLen Length of the second input vector
+  @param[in]  nPE     Number of cores to use
+  @param[out] pRes    output result returned here, of size |srcALen - srcBLen| + 1
+  @return     none
+ */
+
+void plp_conv_valid_rep_i8_parallel(const int8_t *pSrcA,
+                                    const uint32_t srcALen,
+                                    const int8_t *pSrcB,
+                                    const uint32_t srcBLen,
+                                    uint32_t nPE,
+                                    int32_t *pRes);
+
+/** -------------------------------------------------------
+  @brief Parallel 8-bit integer convolution with replicated data kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_conv_rep_instance_i8 struct initialized by
+                    plp_conv_rep_init_i8
+  @return     none
+ */
+
+void plp_conv_rep_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Convolution (valid) of 8-bit integer vectors kernel for RV32IM extension.
+  @param[in]  pSrcA   points to the first input vector
+  @param[in]  srcALen Length of the first input vector
+  @param[in]  pSrcB   points to the second input vector
+  @param[in]  srcBLen Length of the second input vector
+  @param[out] pRes    output result returned here
+  @return     none
+ */
+
+void plp_conv_valid_i8s_rv32im(const int8_t *pSrcA,
+                               const uint32_t srcALen,
+                               const int8_t *pSrcB,
+                               const uint32_t srcBLen,
+                               int32_t *pRes);
+
 /** -------------------------------------------------------
    @brief Convolution of 8-bit integer vectors kernel for RV32IM extension.
    @param[in]  pSrcA   points to the first input vector
@@ -4831,6 +12511,99 @@ void plp_mat_mult_q8s_xpulpv2(const int8_t *__restrict__ pSrcA,
 
 void plp_mat_mult_q8p_xpulpv2(void *args);
 
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of 8-bit integer matrices, which
+               are stored in L2.
+   @param[in]  pSrcA points to first the input matrix, in L2
+   @param[in]  pSrcB points to second the input matrix, in L2
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here, in L2
+   @return     none
+*/
+
+void plp_mat_mult_tiled_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel tiled matrix multiplication of 8-bit integer matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_i8 struct initialized by
+                      plp_mat_mult_tiled_i8_parallel
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i8p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of 16-bit integer matrices, which
+               are stored in L2.
+   @param[in]  pSrcA points to first the input matrix, in L2
+   @param[in]  pSrcB points to second the input matrix, in L2
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here, in L2
+   @return     none
+*/
+
+void plp_mat_mult_tiled_i16_parallel(const int16_t *__restrict__ pSrcA,
+                                     const int16_t *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     int32_t *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel tiled matrix multiplication of 16-bit integer matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_i16 struct initialized by
+                      plp_mat_mult_tiled_i16_parallel
+    @return     none
+*/
+
+void plp_mat_mult_tiled_i16p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+   @brief      Glue code for parallel matrix matrix multiplication of 32-bit floating-point matrices, which
+               are stored in L2.
+   @param[in]  pSrcA points to first the input matrix, in L2
+   @param[in]  pSrcB points to second the input matrix, in L2
+   @param[in]  M     Height of first matrix
+   @param[in]  N     Width of first and heigt of second matrix
+   @param[in]  O     Width of second matrix
+   @param[in]  nPE   Number of cores to use
+   @param[out] pDstC Output is written here, in L2
+   @return     none
+*/
+
+void plp_mat_mult_tiled_f32_parallel(const float *__restrict__ pSrcA,
+                                     const float *__restrict__ pSrcB,
+                                     uint32_t M,
+                                     uint32_t N,
+                                     uint32_t O,
+                                     uint32_t nPE,
+                                     float *__restrict__ pDstC);
+
+/** -------------------------------------------------------
+    @brief      Parallel tiled matrix multiplication of 32-bit floating-point matrices kernel for XPULPV2
+                extension.
+    @param[in]  args  pointer to plp_mat_mult_tiled_instance_f32 struct initialized by
+                      plp_mat_mult_tiled_f32_parallel
+    @return     none
+*/
+
+void plp_mat_mult_tiled_f32p_xpulpv2(void *args);
+
 /** -------------------------------------------------------
   @brief      Glue code of matrix matrix multiplication for complex 32-bit integers
   @param[in]  pSrcA Points to the first input matrix of shape MxN
@@ -7501,6 +15274,20 @@ plp_bitreversal_32s_rv32im(uint32_t *pSrc, const uint16_t bitRevLen, const uint1
 void
 plp_bitreversal_32s_xpulpv2(uint32_t *pSrc, const uint16_t bitRevLen, const uint16_t *pBitRevTab);
 
+/**
+  @brief      Parallel in-place 32 bit reversal function for XPULPV2
+  @param[in,out] pSrc        points to in-place buffer of unknown 32-bit data type
+  @param[in]  bitRevLen   bit reversal table length
+  @param[in]  pBitRevTab  points to bit reversal table
+  @param[in]  nPE         number of cores
+  @return     none
+*/
+
+void plp_bitreversal_32p_xpulpv2(uint32_t *pSrc,
+                                 const uint16_t bitRevLen,
+                                 const uint16_t *pBitRevTab,
+                                 uint32_t nPE);
+
 /**
  * @brief      Glue code for quantized 32-bit complex fast fourier transform
  * 
@@ -7563,6 +15350,36 @@ void plp_cfft_q32s_xpulpv2(const plp_cfft_instance_q32 *S,
                       uint8_t bitReverseFlag,
                       uint32_t fracBits);
 
+/**
+ * @brief      Glue code for parallel quantized 32-bit complex fast fourier transform
+ *
+ * The fixed point format of the output is the same as for plp_cfft_q32, and the result is
+ * bit-exact to the single-core implementation for any number of cores.
+ *
+ * @param[in]  S               points to an instance of the 32bit quantized CFFT structure
+ * @param      p1              points to the complex data buffer of size <code>2*fftLen</code>.
+ * Processing occurs in-place.
+ * @param[in]  ifftFlag        flag that selects forward (ifftFlag=0) or inverse (ifftFlag=1)
+ * @param[in]  bitReverseFlag  flag that enables (bitReverseFlag=1) of disables
+ * (bitReverseFlag=0) bit reversal of output.
+ * @param[in]  fracBits        decimal point for right shift (input format Q(32-fracBits).fracBits)
+ * @param[in]  nPE             number of cores to use
+ */
+
+void plp_cfft_q32_parallel(const plp_cfft_instance_q32 *S,
+                           int32_t *p1,
+                           uint8_t ifftFlag,
+                           uint8_t bitReverseFlag,
+                           uint32_t fracBits,
+                           uint32_t nPE);
+
+/**
+ * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2
+ * @param[in]  args    points to the plp_cfft_instance_q32_parallel
+ */
+
+void plp_cfft_q32p_xpulpv2(void *args);
+
 /**
    @brief Floating-point FFT on real input data.
    @param[in]   S       points to an instance of the floating-point FFT structure
@@ -7599,63 +15416,505 @@ void plp_rfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
                           float32_t *__restrict__ pDst);
 
 /**
-   @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
-   @param[in]   arg       points to an instance of the floating-point FFT structure
-   @return      none
+   @brief  Floating-point FFT on real input data for XPULPV2 extension (parallel version).
+   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
+
+/**
+   @brief      Glue code for the 16-bit fixed-point FFT on real input data.
+
+   The N real values are transformed with a complex FFT of length N/2, followed by a split pass.
+   The output contains the N/2 + 1 complex bins 0 .. N/2 in natural order, scaled by 1/N, i.e. the
+   output format is the same as for the complex FFT of length N:
+   Q1.15 -> Q(1+log2(N)).(15-log2(N)).
+
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values). pDst
+                        may be equal to pSrc, if this buffer has a size of N + 2 values.
+   @return      none
+*/
+void plp_rfft_q16(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst);
+
+/**
+   @brief      Glue code for the parallel 16-bit fixed-point FFT on real input data.
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values)
+   @return      none
+*/
+void plp_rfft_q16_parallel(const plp_rfft_instance_q16 *S,
+                           const int16_t *pSrc,
+                           const uint32_t nPE,
+                           int16_t *pDst);
+
+/**
+   @brief      16-bit fixed-point FFT on real input data for RV32IM.
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values)
+   @return      none
+*/
+void plp_rfft_q16s_rv32im(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst);
+
+/**
+   @brief      16-bit fixed-point FFT on real input data for XPULPV2.
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values)
+   @return      none
+*/
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst);
+
+/**
+   @brief      Parallel 16-bit fixed-point FFT on real input data for XPULPV2.
+   @param[in]   args    points to the plp_rfft_instance_q16_parallel
+   @return      none
+*/
+void plp_rfft_q16p_xpulpv2(void *args);
+
+/**
+   @brief      Glue code for the 32-bit fixed-point FFT on real input data.
+
+   The N real values are transformed with a complex FFT of length N/2, followed by a split pass.
+   The output contains the N/2 + 1 complex bins 0 .. N/2 in natural order, scaled by 1/N, i.e. the
+   output format is the same as for the complex FFT of length N:
+   Q1.31 -> Q(1+log2(N)).(31-log2(N)).
+
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values). pDst
+                        may be equal to pSrc, if this buffer has a size of N + 2 values.
+   @return      none
+*/
+void plp_rfft_q32(const plp_rfft_instance_q32 *S, const int32_t *pSrc, int32_t *pDst);
+
+/**
+   @brief      Glue code for the parallel 32-bit fixed-point FFT on real input data.
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values)
+   @return      none
+*/
+void plp_rfft_q32_parallel(const plp_rfft_instance_q32 *S,
+                           const int32_t *pSrc,
+                           const uint32_t nPE,
+                           int32_t *pDst);
+
+/**
+   @brief      32-bit fixed-point FFT on real input data for RV32IM.
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values)
+   @return      none
+*/
+void plp_rfft_q32s_rv32im(const plp_rfft_instance_q32 *S, const int32_t *pSrc, int32_t *pDst);
+
+/**
+   @brief      32-bit fixed-point FFT on real input data for XPULPV2.
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values)
+   @return      none
+*/
+void plp_rfft_q32s_xpulpv2(const plp_rfft_instance_q32 *S, const int32_t *pSrc, int32_t *pDst);
+
+/**
+   @brief      Parallel 32-bit fixed-point FFT on real input data for XPULPV2.
+   @param[in]   args    points to the plp_rfft_instance_q32_parallel
+   @return      none
+*/
+void plp_rfft_q32p_xpulpv2(void *args);
+
+/**
+   @brief Floating-point inverse FFT producing real output data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values. pDst may be equal to pSrc.
+   @return      none
+*/
+void plp_rifft_f32(const plp_fft_instance_f32 *S, const float32_t *pSrc, float32_t *pDst);
+
+/**
+   @brief Floating-point inverse FFT producing real output data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of N real values
+   @return      none
+*/
+void plp_rifft_f32_parallel(const plp_fft_instance_f32 *S,
+                            const float32_t *pSrc,
+                            const uint32_t nPE,
+                            float32_t *pDst);
+
+/**
+   @brief  Floating-point inverse FFT producing real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst);
+
+/**
+   @brief  Floating-point inverse FFT producing real output data for XPULPV2 extension (parallel
+           version).
+   @param[in]   args      points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2_parallel(void *args);
+
+/**
+   @brief      Glue code for the 16-bit fixed-point inverse FFT producing real output data.
+
+   The N/2 + 1 complex bins 0 .. N/2 of a conjugate-symmetric spectrum are merged into N/2 complex
+   values, transformed with a complex FFT of length N/2 and returned as N real values. The
+   imaginary parts of the bins 0 and N/2 are ignored. The result is the inverse FFT including the
+   factor 1/N, with the same format as the input. Hence, applied to the output of plp_rfft_q16,
+   it returns the original signal scaled by 1/N, i.e. Q1.15 -> Q(1+log2(N)).(15-log2(N)).
+
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values. pDst may be equal to pSrc.
+   @return      none
+*/
+void plp_rifft_q16(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst);
+
+/**
+   @brief      Glue code for the parallel 16-bit fixed-point inverse FFT producing real output
+               data.
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of N real values
+   @return      none
+*/
+void plp_rifft_q16_parallel(const plp_rfft_instance_q16 *S,
+                            const int16_t *pSrc,
+                            const uint32_t nPE,
+                            int16_t *pDst);
+
+/**
+   @brief      16-bit fixed-point inverse FFT producing real output data for RV32IM.
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values
+   @return      none
+*/
+void plp_rifft_q16s_rv32im(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst);
+
+/**
+   @brief      16-bit fixed-point inverse FFT producing real output data for XPULPV2.
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values
+   @return      none
+*/
+void plp_rifft_q16s_xpulpv2(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst);
+
+/**
+   @brief      Parallel 16-bit fixed-point inverse FFT producing real output data for XPULPV2.
+   @param[in]   args    points to the plp_rfft_instance_q16_parallel
+   @return      none
+*/
+void plp_rifft_q16p_xpulpv2(void *args);
+
+/**
+   @brief      Glue code for the 32-bit fixed-point inverse FFT producing real output data.
+
+   The N/2 + 1 complex bins 0 .. N/2 of a conjugate-symmetric spectrum are merged into N/2 complex
+   values, transformed with a complex FFT of length N/2 and returned as N real values. The
+   imaginary parts of the bins 0 and N/2 are ignored. The result is the inverse FFT including the
+   factor 1/N, with the same format as the input. Hence, applied to the output of plp_rfft_q32,
+   it returns the original signal scaled by 1/N, i.e. Q1.31 -> Q(1+log2(N)).(31-log2(N)).
+
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values. pDst may be equal to pSrc.
+   @return      none
+*/
+void plp_rifft_q32(const plp_rfft_instance_q32 *S, const int32_t *pSrc, int32_t *pDst);
+
+/**
+   @brief      Glue code for the parallel 32-bit fixed-point inverse FFT producing real output
+               data.
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer of N real values
+   @return      none
+*/
+void plp_rifft_q32_parallel(const plp_rfft_instance_q32 *S,
+                            const int32_t *pSrc,
+                            const uint32_t nPE,
+                            int32_t *pDst);
+
+/**
+   @brief      32-bit fixed-point inverse FFT producing real output data for RV32IM.
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values
+   @return      none
+*/
+void plp_rifft_q32s_rv32im(const plp_rfft_instance_q32 *S, const int32_t *pSrc, int32_t *pDst);
+
+/**
+   @brief      32-bit fixed-point inverse FFT producing real output data for XPULPV2.
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values
+   @return      none
+*/
+void plp_rifft_q32s_xpulpv2(const plp_rfft_instance_q32 *S, const int32_t *pSrc, int32_t *pDst);
+
+/**
+   @brief      Parallel 32-bit fixed-point inverse FFT producing real output data for XPULPV2.
+   @param[in]   args    points to the plp_rfft_instance_q32_parallel
+   @return      none
+*/
+void plp_rifft_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief      Glue code for matrix addition of a 32-bit integer matrices.
+  @param[in]  pSrcA   Points to the first input matrix
+  @param[in]  pSrcB   Points to the second input matrix
+  @param[in]  M       Height of the matrices
+  @param[in]  N       Width of the matrices
+  @param[out] pDst    Points to the output matrix
+  @return     none
+*/
+
+/**
+   @brief Floating-point FFT on complex input data.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_f32(const plp_fft_instance_f32 *S,
+                  const float32_t *pSrc,
+                  float32_t *pDst);
+
+/**
+   @brief Floating-point FFT on complex input data (parallel version).
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_f32_parallel(const plp_fft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           const uint32_t nPE,
+                           float32_t *pDst);
+
+/**
+   @brief  Floating-point FFT on complex input data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrcA   points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                          const float32_t *pSrc,
+                          float32_t *pDst);
+
+/**
+   @brief  Floating-point FFT on complex input data for XPULPV2 extension (parallel version).
+   @param[in]   arg       points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_cfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
+
+/**
+   @brief      Create the plan of a floating-point mixed-radix FFT.
+   @param[out] S          points to the plan to initialize
+   @param[in]  N          length of the FFT, must be of the form 2^a 3^b 5^c
+   @param[in]  pTwiddle   points to a buffer of N complex values, which is filled with the
+                          twiddle factors \f$W_N^k = e^{-j \frac{2 \pi}{N} k}\f$, k = 0 .. N-1
+   @param[in]  pScratch   points to a buffer of N complex values, used by the transform
+   @return     0 on success, 1 if N has a prime factor larger than 5 or is zero
+*/
+int plp_cfft_mixed_plan_init_f32(plp_cfft_mixed_plan_f32 *S,
+                                 uint32_t N,
+                                 Complex_type_f32 *pTwiddle,
+                                 Complex_type_f32 *pScratch);
+
+/**
+   @brief Floating-point mixed-radix FFT on complex input data.
+   @param[in]   S       points to the plan of the mixed-radix FFT (see plp_cfft_mixed_plan_init_f32)
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_mixed_f32(const plp_cfft_mixed_plan_f32 *S, const float32_t *pSrc, float32_t *pDst);
+
+/**
+   @brief Floating-point mixed-radix FFT on complex input data (parallel version).
+   @param[in]   S       points to the plan of the mixed-radix FFT (see plp_cfft_mixed_plan_init_f32)
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[in]   nPE     number of parallel processing units
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_mixed_f32_parallel(const plp_cfft_mixed_plan_f32 *S,
+                                 const float32_t *pSrc,
+                                 const uint32_t nPE,
+                                 float32_t *pDst);
+
+/**
+   @brief  Floating-point mixed-radix FFT on complex input data for XPULPV2 extension.
+   @param[in]   S       points to the plan of the mixed-radix FFT
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_mixed_f32_xpulpv2(const plp_cfft_mixed_plan_f32 *S,
+                                const float32_t *pSrc,
+                                float32_t *pDst);
+
+/**
+   @brief  Floating-point mixed-radix FFT on complex input data for XPULPV2 extension
+           (parallel version).
+   @param[in]   args    points to an instance of the parallel mixed-radix FFT structure
+   @return      none
+*/
+void plp_cfft_mixed_f32_xpulpv2_parallel(void *args);
+
+/**
+   @brief  Radix of the floating-point FFT kernel used for a given length: radix-8 if log2(N) is
+           a multiple of 3, radix-4 if it is even and radix-2 otherwise. The radix-r kernels need
+           at least r^2 points, smaller lengths fall back to the next smaller radix.
+   @param[in]   N       length of the FFT
+   @return      8, 4 or 2, or 0 if N is not a power of two larger than 2
+*/
+uint32_t plp_cfft_f32_radix(uint32_t N);
+
+/**
+   @brief      Size of the memory needed by plp_fft_plan_create_f32.
+   @param[in]  N     length of the FFT, power of two from 4 to 65536
+   @return     number of bytes, or 0 if N is not supported
+*/
+uint32_t plp_fft_plan_size_f32(uint32_t N);
+
+/**
+   @brief      Creates the plan of a complex FFT (plp_cfft_f32), computing the twiddle factors and
+               the bit reversal table at runtime.
+   @param[in]  N     length of the FFT, power of two from 4 to 65536
+   @param[in]  mem   points to plp_fft_plan_size_f32(N) bytes of memory (8-byte aligned), preferably
+                     in L1, which hold the plan and its tables. If mem is NULL, the memory is
+                     allocated in L1 and released by plp_fft_plan_destroy_f32.
+   @return     pointer to the plan, use &plan->S as instance of plp_cfft_f32. NULL if N is not
+               supported or if the allocation failed.
+*/
+plp_fft_plan_f32 *plp_fft_plan_create_f32(uint32_t N, void *mem);
+
+/**
+   @brief      Destroys a plan created by plp_fft_plan_create_f32. The memory is released if it
+               was allocated by the plan, memory provided by the caller can be reused afterwards.
+   @param[in]  plan  points to the plan
+   @return     none
+*/
+void plp_fft_plan_destroy_f32(plp_fft_plan_f32 *plan);
+
+/**
+   @brief      Size of the memory needed by plp_fft_plan_create_q16.
+   @param[in]  N     length of the FFT, power of two from 16 to 4096
+   @return     number of bytes, or 0 if N is not supported
+*/
+uint32_t plp_fft_plan_size_q16(uint32_t N);
+
+/**
+   @brief      Creates the plan of a complex FFT (plp_cfft_q16), computing the twiddle factors and
+               the bit reversal table at runtime.
+   @param[in]  N     length of the FFT, power of two from 16 to 4096
+   @param[in]  mem   points to plp_fft_plan_size_q16(N) bytes of memory (8-byte aligned), preferably
+                     in L1, which hold the plan and its tables. If mem is NULL, the memory is
+                     allocated in L1 and released by plp_fft_plan_destroy_q16.
+   @return     pointer to the plan, use &plan->S as instance of plp_cfft_q16. NULL if N is not
+               supported or if the allocation failed.
+*/
+plp_fft_plan_q16 *plp_fft_plan_create_q16(uint32_t N, void *mem);
+
+/**
+   @brief      Destroys a plan created by plp_fft_plan_create_q16. The memory is released if it
+               was allocated by the plan, memory provided by the caller can be reused afterwards.
+   @param[in]  plan  points to the plan
+   @return     none
+*/
+void plp_fft_plan_destroy_q16(plp_fft_plan_q16 *plan);
+
+/**
+   @brief      Size of the memory needed by plp_fft_plan_create_q32.
+   @param[in]  N     length of the FFT, power of two from 16 to 4096
+   @return     number of bytes, or 0 if N is not supported
+*/
+uint32_t plp_fft_plan_size_q32(uint32_t N);
+
+/**
+   @brief      Creates the plan of a complex FFT (plp_cfft_q32), computing the twiddle factors and
+               the bit reversal table at runtime.
+   @param[in]  N     length of the FFT, power of two from 16 to 4096
+   @param[in]  mem   points to plp_fft_plan_size_q32(N) bytes of memory (8-byte aligned), preferably
+                     in L1, which hold the plan and its tables. If mem is NULL, the memory is
+                     allocated in L1 and released by plp_fft_plan_destroy_q32.
+   @return     pointer to the plan, use &plan->S as instance of plp_cfft_q32. NULL if N is not
+               supported or if the allocation failed.
 */
-void plp_rfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
+plp_fft_plan_q32 *plp_fft_plan_create_q32(uint32_t N, void *mem);
 
-/** -------------------------------------------------------
-  @brief      Glue code for matrix addition of a 32-bit integer matrices.
-  @param[in]  pSrcA   Points to the first input matrix
-  @param[in]  pSrcB   Points to the second input matrix
-  @param[in]  M       Height of the matrices
-  @param[in]  N       Width of the matrices
-  @param[out] pDst    Points to the output matrix
-  @return     none
+/**
+   @brief      Destroys a plan created by plp_fft_plan_create_q32. The memory is released if it
+               was allocated by the plan, memory provided by the caller can be reused afterwards.
+   @param[in]  plan  points to the plan
+   @return     none
 */
+void plp_fft_plan_destroy_q32(plp_fft_plan_q32 *plan);
 
 /**
-   @brief Floating-point FFT on complex input data.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the input buffer (complex data)
-   @param[out]  pDst    points to the output buffer (complex data)
-   @return      none
+   @brief      Computes cos(2 pi k / N) and sin(2 pi k / N) in double precision. The angle is
+               reduced to the first octant, such that the tables are exactly symmetric.
+   @param[in]  N      length of the FFT, must be a multiple of 8
+   @param[in]  k      index of the twiddle factor, 0 <= k < N
+   @param[out] pCos   cos(2 pi k / N)
+   @param[out] pSin   sin(2 pi k / N)
+   @return     none
 */
-void plp_cfft_f32(const plp_fft_instance_f32 *S,
-                  const float32_t *pSrc,
-                  float32_t *pDst);
+void plp_fft_cos_sin(uint32_t N, uint32_t k, double *pCos, double *pSin);
 
 /**
-   @brief Floating-point FFT on complex input data (parallel version).
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrc    points to the input buffer (complex data)
-   @param[in]   nPE     number of parallel processing units
-   @param[out]  pDst    points to the output buffer (complex data)
-   @return      none
+   @brief      Rounds x * 2^fracBits to the nearest integer (ties away from zero) and saturates
+               it to the range of a (fracBits + 1)-bit signed integer.
+   @param[in]  x          value in [-1, 1]
+   @param[in]  fracBits   number of fractional bits, 15 or 31
+   @return     the fixed-point value
 */
-void plp_cfft_f32_parallel(const plp_fft_instance_f32 *S,
-                           const float32_t *pSrc,
-                           const uint32_t nPE,
-                           float32_t *pDst);
+int32_t plp_fft_to_fixed(double x, uint32_t fracBits);
 
 /**
-   @brief  Floating-point FFT on complex input data for XPULPV2 extension.
-   @param[in]   S       points to an instance of the floating-point FFT structure
-   @param[in]   pSrcA   points to the input buffer (complex data)
-   @param[out]  pDst    points to the output buffer (complex data)
-   @return      none
+   @brief      Generates the bit reversal table used by plp_bitreversal_16s_* and
+               plp_bitreversal_32s_*. For every index i with i < bitrev(i), the table contains the
+               pair (8 * i, 8 * bitrev(i)), in increasing order of i.
+   @param[in]  N        length of the FFT, power of two, at most 8192
+   @param[out] pTable   points to the table, of plp_fft_bitrev_table_length(N) values
+   @return     none
 */
-void plp_cfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
-                          const float32_t *pSrc,
-                          float32_t *pDst);
+void plp_fft_bitrev_table(uint32_t N, uint16_t *pTable);
 
 /**
-   @brief  Floating-point FFT on complex input data for XPULPV2 extension (parallel version).
-   @param[in]   arg       points to an instance of the floating-point FFT structure
-   @return      none
+   @brief      Length of the bit reversal table of an N-point FFT: the indices which are not
+               palindromes in binary representation.
+   @param[in]  N     length of the FFT, power of two
+   @return     number of entries of the table
 */
-void plp_cfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg);
+uint32_t plp_fft_bitrev_table_length(uint32_t N);
 
 void plp_mat_add_i32(const int32_t *__restrict__ pSrcA,
                      const int32_t *__restrict__ pSrcB,
@@ -8857,10 +17116,552 @@ int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
   @brief Parallel matrix inverse of 32-bit floating-point matrices kernel for XPULPV2 extension.
   @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
                     plp_mat_inv_f32_parallel
-  @return     0: Success, 1: Matrix is singular
+  @return     none
+*/
+
+void plp_mat_inv_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for LU decomposition of 32-bit floating-point matrices.
+  @param[in,out] pSrc  Points to the input matrix, overwritten with L and U
+  @param[in]     N     Width and height of the matrix
+  @param[out]    pPerm Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_lu_f32(float *__restrict__ pSrc, uint32_t N, uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief LU decomposition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrc  Points to the input matrix, overwritten with L and U
+  @param[in]     N     Width and height of the matrix
+  @param[out]    pPerm Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_lu_f32s_xpulpv2(float *__restrict__ pSrc, uint32_t N, uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel LU decomposition of 32-bit floating-point matrices.
+  @param[in,out] pSrc  Points to the input matrix, overwritten with L and U
+  @param[in]     N     Width and height of the matrix
+  @param[in]     nPE   Number of cores to use for computation
+  @param[out]    pPerm Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_lu_f32_parallel(float *__restrict__ pSrc,
+                            uint32_t N,
+                            uint32_t nPE,
+                            uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief Parallel LU decomposition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_lu_instance_f32 struct initialized by
+                    plp_mat_lu_f32_parallel
+  @return     none
+*/
+
+void plp_mat_lu_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for LU decomposition of 32-bit fix-point matrices.
+  @param[in,out] pSrc     Points to the input matrix, overwritten with L and U
+  @param[in]     N        Width and height of the matrix
+  @param[in]     fracBits Number of fractional bits
+  @param[out]    pPerm    Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_lu_q32(int32_t *__restrict__ pSrc,
+                   uint32_t N,
+                   uint32_t fracBits,
+                   uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief LU decomposition of 32-bit fix-point matrices kernel for RV32IM extension.
+  @param[in,out] pSrc     Points to the input matrix, overwritten with L and U
+  @param[in]     N        Width and height of the matrix
+  @param[in]     fracBits Number of fractional bits
+  @param[out]    pPerm    Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_lu_q32s_rv32im(int32_t *__restrict__ pSrc,
+                           uint32_t N,
+                           uint32_t fracBits,
+                           uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief LU decomposition of 32-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrc     Points to the input matrix, overwritten with L and U
+  @param[in]     N        Width and height of the matrix
+  @param[in]     fracBits Number of fractional bits
+  @param[out]    pPerm    Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular
+*/
+
+int plp_mat_lu_q32s_xpulpv2(int32_t *__restrict__ pSrc,
+                            uint32_t N,
+                            uint32_t fracBits,
+                            uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel LU decomposition of 32-bit fix-point matrices.
+  @param[in,out] pSrc     Points to the input matrix, overwritten with L and U
+  @param[in]     N        Width and height of the matrix
+  @param[in]     fracBits Number of fractional bits
+  @param[in]     nPE      Number of cores to use for computation
+  @param[out]    pPerm    Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular, 2: operation not supported
+*/
+
+int plp_mat_lu_q32_parallel(int32_t *__restrict__ pSrc,
+                            uint32_t N,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            uint32_t *__restrict__ pPerm);
+
+/** -------------------------------------------------------
+  @brief Parallel LU decomposition of 32-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_lu_instance_q32 struct initialized by
+                    plp_mat_lu_q32_parallel
+  @return     none
+*/
+
+void plp_mat_lu_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for Cholesky decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the symmetric positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_f32(const float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Cholesky decomposition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc Points to the symmetric positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite
+*/
+
+int plp_mat_cholesky_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel Cholesky decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the symmetric positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_f32_parallel(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t nPE,
+                                  float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel Cholesky decomposition of 32-bit floating-point matrices kernel for XPULPV2
+  extension.
+  @param[in]  args  pointer to plp_mat_cholesky_instance_f32 struct initialized by
+                    plp_mat_cholesky_f32_parallel
+  @return     none
+*/
+
+void plp_mat_cholesky_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for Cholesky decomposition of 32-bit fix-point matrices.
+  @param[in]  pSrc     Points to the symmetric positive definite input matrix
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite
+*/
+
+int plp_mat_cholesky_q32(const int32_t *__restrict__ pSrc,
+                         uint32_t N,
+                         uint32_t fracBits,
+                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Cholesky decomposition of 32-bit fix-point matrices kernel for RV32IM extension.
+  @param[in]  pSrc     Points to the symmetric positive definite input matrix
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite
+*/
+
+int plp_mat_cholesky_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                 uint32_t N,
+                                 uint32_t fracBits,
+                                 int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Cholesky decomposition of 32-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc     Points to the symmetric positive definite input matrix
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite
+*/
+
+int plp_mat_cholesky_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t fracBits,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel Cholesky decomposition of 32-bit fix-point matrices.
+  @param[in]  pSrc     Points to the symmetric positive definite input matrix
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+*/
+
+int plp_mat_cholesky_q32_parallel(const int32_t *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t fracBits,
+                                  uint32_t nPE,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel Cholesky decomposition of 32-bit fix-point matrices kernel for XPULPV2
+  extension.
+  @param[in]  args  pointer to plp_mat_cholesky_instance_q32 struct initialized by
+                    plp_mat_cholesky_q32_parallel
+  @return     none
+*/
+
+void plp_mat_cholesky_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for linear system solver with LU decomposition of 32-bit floating-point matrices.
+  @param[in]  pLU      Points to the LU decomposition of A, computed by plp_mat_lu_f32
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_lu_f32(const float *__restrict__ pLU,
+                          const uint32_t *__restrict__ pPerm,
+                          uint32_t N,
+                          const float *__restrict__ pB,
+                          uint32_t K,
+                          float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Linear system solver with LU decomposition of 32-bit floating-point matrices kernel for
+  XPULPV2 extension.
+  @param[in]  pLU      Points to the LU decomposition of A
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_lu_f32s_xpulpv2(const float *__restrict__ pLU,
+                                   const uint32_t *__restrict__ pPerm,
+                                   uint32_t N,
+                                   const float *__restrict__ pB,
+                                   uint32_t K,
+                                   float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel linear system solver with LU decomposition of 32-bit floating-point
+  matrices.
+  @param[in]  pLU      Points to the LU decomposition of A, computed by plp_mat_lu_f32
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_lu_f32_parallel(const float *__restrict__ pLU,
+                                   const uint32_t *__restrict__ pPerm,
+                                   uint32_t N,
+                                   const float *__restrict__ pB,
+                                   uint32_t K,
+                                   uint32_t nPE,
+                                   float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel linear system solver with LU decomposition of 32-bit floating-point matrices
+  kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_solve_lu_instance_f32 struct initialized by
+                    plp_mat_solve_lu_f32_parallel
+  @return     none
+*/
+
+void plp_mat_solve_lu_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for linear system solver with LU decomposition of 32-bit fix-point matrices.
+  @param[in]  pLU      Points to the LU decomposition of A, computed by plp_mat_lu_q32
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_lu_q32(const int32_t *__restrict__ pLU,
+                          const uint32_t *__restrict__ pPerm,
+                          uint32_t N,
+                          const int32_t *__restrict__ pB,
+                          uint32_t K,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Linear system solver with LU decomposition of 32-bit fix-point matrices kernel for RV32IM
+  extension.
+  @param[in]  pLU      Points to the LU decomposition of A
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_lu_q32s_rv32im(const int32_t *__restrict__ pLU,
+                                  const uint32_t *__restrict__ pPerm,
+                                  uint32_t N,
+                                  const int32_t *__restrict__ pB,
+                                  uint32_t K,
+                                  uint32_t fracBits,
+                                  int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Linear system solver with LU decomposition of 32-bit fix-point matrices kernel for XPULPV2
+  extension.
+  @param[in]  pLU      Points to the LU decomposition of A
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_lu_q32s_xpulpv2(const int32_t *__restrict__ pLU,
+                                   const uint32_t *__restrict__ pPerm,
+                                   uint32_t N,
+                                   const int32_t *__restrict__ pB,
+                                   uint32_t K,
+                                   uint32_t fracBits,
+                                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel linear system solver with LU decomposition of 32-bit fix-point
+  matrices.
+  @param[in]  pLU      Points to the LU decomposition of A, computed by plp_mat_lu_q32
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_lu_q32_parallel(const int32_t *__restrict__ pLU,
+                                   const uint32_t *__restrict__ pPerm,
+                                   uint32_t N,
+                                   const int32_t *__restrict__ pB,
+                                   uint32_t K,
+                                   uint32_t fracBits,
+                                   uint32_t nPE,
+                                   int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel linear system solver with LU decomposition of 32-bit fix-point matrices
+  kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_solve_lu_instance_q32 struct initialized by
+                    plp_mat_solve_lu_q32_parallel
+  @return     none
+*/
+
+void plp_mat_solve_lu_q32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for linear system solver with Cholesky decomposition of 32-bit floating-point
+  matrices.
+  @param[in]  pL       Points to the Cholesky decomposition of A, computed by
+                       plp_mat_cholesky_f32
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_cholesky_f32(const float *__restrict__ pL,
+                                uint32_t N,
+                                const float *__restrict__ pB,
+                                uint32_t K,
+                                float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Linear system solver with Cholesky decomposition of 32-bit floating-point matrices kernel
+  for XPULPV2 extension.
+  @param[in]  pL       Points to the Cholesky decomposition of A
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_cholesky_f32s_xpulpv2(const float *__restrict__ pL,
+                                         uint32_t N,
+                                         const float *__restrict__ pB,
+                                         uint32_t K,
+                                         float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel linear system solver with Cholesky decomposition of 32-bit
+  floating-point matrices.
+  @param[in]  pL       Points to the Cholesky decomposition of A, computed by
+                       plp_mat_cholesky_f32
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_cholesky_f32_parallel(const float *__restrict__ pL,
+                                         uint32_t N,
+                                         const float *__restrict__ pB,
+                                         uint32_t K,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel linear system solver with Cholesky decomposition of 32-bit floating-point matrices
+  kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_solve_cholesky_instance_f32 struct initialized by
+                    plp_mat_solve_cholesky_f32_parallel
+  @return     none
+*/
+
+void plp_mat_solve_cholesky_f32p_xpulpv2(void *args);
+
+/** -------------------------------------------------------
+  @brief Glue code for linear system solver with Cholesky decomposition of 32-bit fix-point
+  matrices.
+  @param[in]  pL       Points to the Cholesky decomposition of A, computed by
+                       plp_mat_cholesky_q32
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_cholesky_q32(const int32_t *__restrict__ pL,
+                                uint32_t N,
+                                const int32_t *__restrict__ pB,
+                                uint32_t K,
+                                uint32_t fracBits,
+                                int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Linear system solver with Cholesky decomposition of 32-bit fix-point matrices kernel for
+  RV32IM extension.
+  @param[in]  pL       Points to the Cholesky decomposition of A
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_cholesky_q32s_rv32im(const int32_t *__restrict__ pL,
+                                        uint32_t N,
+                                        const int32_t *__restrict__ pB,
+                                        uint32_t K,
+                                        uint32_t fracBits,
+                                        int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Linear system solver with Cholesky decomposition of 32-bit fix-point matrices kernel for
+  XPULPV2 extension.
+  @param[in]  pL       Points to the Cholesky decomposition of A
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_cholesky_q32s_xpulpv2(const int32_t *__restrict__ pL,
+                                         uint32_t N,
+                                         const int32_t *__restrict__ pB,
+                                         uint32_t K,
+                                         uint32_t fracBits,
+                                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Glue code for parallel linear system solver with Cholesky decomposition of 32-bit
+  fix-point matrices.
+  @param[in]  pL       Points to the Cholesky decomposition of A, computed by
+                       plp_mat_cholesky_q32
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+*/
+
+void plp_mat_solve_cholesky_q32_parallel(const int32_t *__restrict__ pL,
+                                         uint32_t N,
+                                         const int32_t *__restrict__ pB,
+                                         uint32_t K,
+                                         uint32_t fracBits,
+                                         uint32_t nPE,
+                                         int32_t *__restrict__ pDst);
+
+/** -------------------------------------------------------
+  @brief Parallel linear system solver with Cholesky decomposition of 32-bit fix-point matrices
+  kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_solve_cholesky_instance_q32 struct initialized by
+                    plp_mat_solve_cholesky_q32_parallel
+  @return     none
 */
 
-int plp_mat_inv_f32p_xpulpv2(void *args);
+void plp_mat_solve_cholesky_q32p_xpulpv2(void *args);
 
 /** -------------------------------------------------------
   @brief      Glue code for creating a 32-bit integer identity matrix
@@ -0,0 +1,155 @@
+/** ==========================================================================
+ * @file     plp_xpulpv2_emu.h
+ * @brief    Portable C emulation of the XpulpV2 builtins used by the *_xpulpv2 kernels
+ * @version  V0
+ * @date     18. October 2026
+ * =========================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * On PULP, the vector types and the __XXX macros are provided by the SDK and map to single
+ * XpulpV2 instructions. This header provides bit-exact replacements for compilers without the
+ * PULP builtins (included by rtos_hal.h for RTOS_HOST), such that the cluster kernels themselves
+ * can be compiled and profiled on a host. All arithmetic wraps around at 32 bits, like on RI5CY.
+ * The SIMD types use the GCC vector extension, which is lowered to SSE/AVX2 (or NEON) when
+ * available.
+ */
+
+#ifndef __PLP_XPULPV2_EMU_H__
+#define __PLP_XPULPV2_EMU_H__
+
+#include <stdint.h>
+
+typedef signed short v2s __attribute__((vector_size(4)));
+typedef unsigned short v2u __attribute__((vector_size(4)));
+typedef signed char v4s __attribute__((vector_size(4)));
+typedef unsigned char v4u __attribute__((vector_size(4)));
+
+/* Scalar */
+
+static inline int32_t plp_emu_mac(int32_t acc, int32_t x, int32_t y) {
+    return (int32_t)((uint32_t)acc + (uint32_t)x * (uint32_t)y);
+}
+
+static inline int32_t plp_emu_macsn(int32_t acc, int32_t x, int32_t y, uint32_t n) {
+    return (int32_t)((uint32_t)acc + (uint32_t)((int16_t)x * (int16_t)y)) >> n;
+}
+
+static inline int32_t plp_emu_clip(int32_t x, int32_t precision) {
+    int32_t lo = -(1 << precision);
+    int32_t hi = (1 << precision) - 1;
+    return x < lo ? lo : (x > hi ? hi : x);
+}
+
+static inline int32_t plp_emu_addroundnorm(int32_t x, int32_t y, uint32_t scale) {
+    /* the rounding constant 2^(scale - 1) is 0 for scale == 0 */
+    uint32_t round = (1u << scale) >> 1;
+    return (int32_t)((uint32_t)x + (uint32_t)y + round) >> scale;
+}
+
+static inline int32_t plp_emu_addnormu(int32_t x, int32_t y, uint32_t scale) {
+    return (int32_t)(((uint32_t)x + (uint32_t)y) >> scale);
+}
+
+#define __MAC(acc, x, y) plp_emu_mac((acc), (x), (y))
+#define __MACS(acc, x, y) plp_emu_macsn((acc), (x), (y), 0)
+#define __MACSN(acc, x, y, n) plp_emu_macsn((acc), (x), (y), (n))
+#define __CLIP(x, precision) plp_emu_clip((x), (precision))
+#define __ROUNDNORM_REG(x, scale) plp_emu_addroundnorm((x), 0, (scale))
+#define __ADDROUNDNORM_REG(x, y, scale) plp_emu_addroundnorm((x), (y), (scale))
+#define __ADDNORMU_REG(x, y, scale) plp_emu_addnormu((x), (y), (scale))
+#define __MAX(x, y) ((x) > (y) ? (x) : (y))
+#define __MIN(x, y) ((x) < (y) ? (x) : (y))
+#define __ABS(x) ((x) < 0 ? -(x) : (x))
+
+/* SIMD, lane-wise operations wrap around at the element width */
+
+static inline int32_t plp_emu_sumdotp2(v2s x, v2s y, int32_t z) {
+    uint32_t p0 = (uint32_t)((int32_t)x[0] * (int32_t)y[0]);
+    uint32_t p1 = (uint32_t)((int32_t)x[1] * (int32_t)y[1]);
+    return (int32_t)((uint32_t)z + p0 + p1);
+}
+
+static inline int32_t plp_emu_sumdotp4(v4s x, v4s y, int32_t z) {
+    int32_t p0 = (int32_t)x[0] * (int32_t)y[0];
+    int32_t p1 = (int32_t)x[1] * (int32_t)y[1];
+    int32_t p2 = (int32_t)x[2] * (int32_t)y[2];
+    int32_t p3 = (int32_t)x[3] * (int32_t)y[3];
+    return (int32_t)((uint32_t)z + (uint32_t)(p0 + p1 + p2 + p3));
+}
+
+static inline v2s plp_emu_pack2(int32_t x, int32_t y) {
+    v2s r = { (int16_t)x, (int16_t)y };
+    return r;
+}
+
+static inline v4s plp_emu_pack4(int32_t x, int32_t y, int32_t z, int32_t t) {
+    v4s r = { (int8_t)x, (int8_t)y, (int8_t)z, (int8_t)t };
+    return r;
+}
+
+static inline v2s plp_emu_max2(v2s x, v2s y) {
+    v2s gt = x > y;
+    return (x & gt) | (y & ~gt);
+}
+
+static inline v4s plp_emu_max4(v4s x, v4s y) {
+    v4s gt = x > y;
+    return (x & gt) | (y & ~gt);
+}
+
+static inline v2s plp_emu_min2(v2s x, v2s y) {
+    v2s lt = x < y;
+    return (x & lt) | (y & ~lt);
+}
+
+static inline v4s plp_emu_min4(v4s x, v4s y) {
+    v4s lt = x < y;
+    return (x & lt) | (y & ~lt);
+}
+
+#define __DOTP2(x, y) plp_emu_sumdotp2((x), (y), 0)
+#define __SUMDOTP2(x, y, z) plp_emu_sumdotp2((x), (y), (z))
+#define __DOTP4(x, y) plp_emu_sumdotp4((x), (y), 0)
+#define __SUMDOTP4(x, y, z) plp_emu_sumdotp4((x), (y), (z))
+#define __builtin_pulp_sdotsp2(x, y, z) plp_emu_sumdotp2((x), (y), (z))
+#define __builtin_pulp_sdotsp4(x, y, z) plp_emu_sumdotp4((x), (y), (z))
+
+#define __PACK2(x, y) plp_emu_pack2((x), (y))
+#define __PACK4(x, y, z, t) plp_emu_pack4((x), (y), (z), (t))
+
+#define __ADD2(x, y) ((v2s)((v2u)(x) + (v2u)(y)))
+#define __SUB2(x, y) ((v2s)((v2u)(x) - (v2u)(y)))
+#define __ADD4(x, y) ((v4s)((v4u)(x) + (v4u)(y)))
+#define __SUB4(x, y) ((v4s)((v4u)(x) - (v4u)(y)))
+#define __SRA2(x, y) ((v2s)(x) >> (v2s)(y))
+#define __SRL2(x, y) ((v2s)((v2u)(x) >> (v2u)(y)))
+#define __SLL2(x, y) ((v2s)((v2u)(x) << (v2u)(y)))
+#define __SRA4(x, y) ((v4s)(x) >> (v4s)(y))
+#define __SLL4(x, y) ((v4s)((v4u)(x) << (v4u)(y)))
+#define __AND2(x, y) ((v2s)(x) & (v2s)(y))
+#define __AND4(x, y) ((v4s)(x) & (v4s)(y))
+#define __OR2(x, y) ((v2s)(x) | (v2s)(y))
+#define __OR4(x, y) ((v4s)(x) | (v4s)(y))
+#define __MAX2(x, y) plp_emu_max2((x), (y))
+#define __MIN2(x, y) plp_emu_min2((x), (y))
+#define __MAX4(x, y) plp_emu_max4((x), (y))
+#define __MIN4(x, y) plp_emu_min4((x), (y))
+
+#endif // __PLP_XPULPV2_EMU_H__
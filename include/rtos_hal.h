@@ -123,6 +123,184 @@ static inline unsigned int hal_perf_read(int id)
 
 
 
+#elif defined(RTOS_HOST)
+
+/* Host backend (Linux/pthreads). The cluster is emulated by a team of threads, L1 by a bounded
+   arena and the cluster DMA by memcpy, so that the library can be built and tested off-target.
+   The thread calling main() acts as the fabric controller, forked threads and code started with
+   hal_host_cluster_call() run on cluster 0. */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "plp_xpulpv2_emu.h"
+
+#ifndef HAL_HOST_NB_PE
+#define HAL_HOST_NB_PE 8
+#endif
+
+#ifndef HAL_HOST_L1_SIZE
+#define HAL_HOST_L1_SIZE (64 * 1024)
+#endif
+
+#ifndef ARCHI_FC_CID
+#define ARCHI_FC_CID 32
+#endif
+
+#define HAL_L1
+#define HAL_CL_L1
+#define HAL_L2
+
+int hal_core_id();
+
+int hal_cluster_id();
+
+uint32_t hal_cl_nb_pe_cores();
+
+void hal_team_barrier();
+
+void hal_cl_team_fork(int nb_cores, void (*entry)(void *), void *arg);
+
+void hal_host_cluster_call(void (*entry)(void *), void *arg);
+
+
+/* MEMORY ALLOCATION */
+
+void * hal_host_l1_malloc(int size);
+
+void hal_host_l1_free(void *chunk, int size);
+
+static inline void * hal_fc_l1_malloc(int size)
+{
+  return hal_host_l1_malloc(size);
+}
+
+static inline void hal_fc_l1_free(void *chunk, int size)
+{
+  hal_host_l1_free(chunk, size);
+}
+
+static inline void * hal_cl_l1_malloc(int size)
+{
+  return hal_host_l1_malloc(size);
+}
+
+static inline void hal_cl_l1_free(void *chunk, int size)
+{
+  hal_host_l1_free(chunk, size);
+}
+
+
+/* DMA */
+
+typedef enum {
+  HAL_CL_DMA_DIR_LOC2EXT = 0,
+  HAL_CL_DMA_DIR_EXT2LOC = 1
+} hal_cl_dma_dir_e;
+
+typedef struct {
+  uint32_t size;
+} hal_cl_dma_cmd_t;
+
+static inline void hal_cl_dma_cmd(uintptr_t ext, uintptr_t loc, uint32_t size, hal_cl_dma_dir_e dir, int merge __attribute__((unused)), hal_cl_dma_cmd_t * cmd)
+{
+  if (dir == HAL_CL_DMA_DIR_EXT2LOC)
+    memcpy((void *)loc, (const void *)ext, size);
+  else
+    memcpy((void *)ext, (const void *)loc, size);
+  cmd->size = size;
+}
+
+static inline void hal_cl_dma_cmd_wait(hal_cl_dma_cmd_t * cmd __attribute__((unused)))
+{
+}
+
+
+/* PERFORMANCE COUNTERS */
+
+/* Only HAL_PERF_CYCLES is backed by a real counter (the time stamp counter on x86, nanoseconds
+   of CLOCK_MONOTONIC otherwise), all other events read as 0. */
+
+#define HAL_PERF_CYCLES 0
+#define HAL_PERF_ACTIVE_CYCLES 1
+#define HAL_PERF_INSTR 2
+#define HAL_PERF_LD_STALL 3
+#define HAL_PERF_JR_STALL 4
+#define HAL_PERF_IMISS 5
+#define HAL_PERF_WBRANCH 6
+#define HAL_PERF_WBRANCH_CYC 7
+#define HAL_PERF_LD 8
+#define HAL_PERF_ST 9
+#define HAL_PERF_JUMP 10
+#define HAL_PERF_BRANCH 11
+#define HAL_PERF_DELAY_NOP 12
+#define HAL_PERF_LD_EXT_CYC 13
+#define HAL_PERF_ST_EXT_CYC 14
+#define HAL_PERF_TCDM_CONT 15
+
+typedef struct {
+  unsigned events;
+  uint64_t start;
+  uint64_t cycles;
+} hal_perf_t;
+
+extern __thread hal_perf_t * hal_host_perf;
+
+static inline uint64_t hal_host_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __builtin_ia32_rdtsc();
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static inline void hal_perf_init(hal_perf_t * perf)
+{
+  perf->events = 0;
+  perf->start = 0;
+  perf->cycles = 0;
+  hal_host_perf = perf;
+}
+
+static inline void hal_perf_conf(hal_perf_t * perf, unsigned events)
+{
+  perf->events = events;
+}
+
+static inline void hal_perf_reset(hal_perf_t * perf)
+{
+  perf->cycles = 0;
+}
+
+static inline void hal_perf_start(hal_perf_t * perf)
+{
+  hal_host_perf = perf;
+  perf->start = hal_host_cycles();
+}
+
+
+static inline void hal_perf_stop(hal_perf_t * perf)
+{
+  perf->cycles += hal_host_cycles() - perf->start;
+}
+
+static inline unsigned int hal_perf_read(int id)
+{
+  if (id != HAL_PERF_CYCLES || hal_host_perf == NULL)
+    return 0;
+  return (unsigned int)hal_host_perf->cycles;
+}
+
+
+
+
+
 #else /* PULP-RT */
 
 #include "rt/rt_api.h"
@@ -8720,3 +8720,21 @@ const int16_t sinTable_q16[FAST_MATH_TABLE_SIZE + 1] = {
     -7962,  -7571,  -7180,  -6787,  -6393,  -5998,  -5602,  -5205,  -4808,  -4410,  -4011,  -3612,
     -3212,  -2811,  -2411,  -2009,  -1608,  -1206,  -804,   -402,   0
 };
+
+/**
+  @par
+  Initial estimates of the reciprocal square root, used by plp_rsqrt_norm_q32. Entry i belongs to
+  the interval [(16 + i) / 16, (17 + i) / 16) of the normalized input and holds the value at the
+  center of the interval in Q0.16:
+  <pre>
+  for (i = 0; i < 48; i++)
+  {
+  rsqrtTable[i] = round(pow(2, 16) / sqrt((16 + i + 0.5) / 16));
+  } </pre>
+ */
+const uint16_t rsqrtTable_q16[RSQRT_TABLE_SIZE] = {
+    0xFC17, 0xF4C8, 0xEE13, 0xE7E4, 0xE22A, 0xDCD7, 0xD7E1, 0xD33C, 0xCEE1, 0xCAC8, 0xC6EB, 0xC345,
+    0xBFD0, 0xBC89, 0xB96B, 0xB673, 0xB39F, 0xB0EC, 0xAE56, 0xABDD, 0xA97E, 0xA738, 0xA508, 0xA2EE,
+    0xA0E8, 0x9EF5, 0x9D13, 0x9B42, 0x9981, 0x97CF, 0x962B, 0x9494, 0x930A, 0x918C, 0x9019, 0x8EB1,
+    0x8D53, 0x8C00, 0x8AB5, 0x8974, 0x883B, 0x870B, 0x85E2, 0x84C1, 0x83A7, 0x8293, 0x8187, 0x8081
+};
@@ -99,5 +99,55 @@ const plp_cfft_instance_q32 plp_cfft_sR_q32_len4096 = { 4096, twiddleCoef_4096_q
                                                         PLPBITREVINDEXTABLE_FIXED_4096_TABLE_LENGTH };
 
 
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len32 = { 32, &plp_cfft_sR_q16_len16,
+                                                      twiddleCoef_32_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len64 = { 64, &plp_cfft_sR_q16_len32,
+                                                      twiddleCoef_64_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len128 = { 128, &plp_cfft_sR_q16_len64,
+                                                       twiddleCoef_128_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len256 = { 256, &plp_cfft_sR_q16_len128,
+                                                       twiddleCoef_256_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len512 = { 512, &plp_cfft_sR_q16_len256,
+                                                       twiddleCoef_512_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len1024 = { 1024, &plp_cfft_sR_q16_len512,
+                                                        twiddleCoef_1024_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len2048 = { 2048, &plp_cfft_sR_q16_len1024,
+                                                        twiddleCoef_2048_q16 };
+
+const plp_rfft_instance_q16 plp_rfft_sR_q16_len4096 = { 4096, &plp_cfft_sR_q16_len2048,
+                                                        twiddleCoef_4096_q16 };
+
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len32 = { 32, &plp_cfft_sR_q32_len16,
+                                                      twiddleCoef_32_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len64 = { 64, &plp_cfft_sR_q32_len32,
+                                                      twiddleCoef_64_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len128 = { 128, &plp_cfft_sR_q32_len64,
+                                                       twiddleCoef_128_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len256 = { 256, &plp_cfft_sR_q32_len128,
+                                                       twiddleCoef_256_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len512 = { 512, &plp_cfft_sR_q32_len256,
+                                                       twiddleCoef_512_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len1024 = { 1024, &plp_cfft_sR_q32_len512,
+                                                        twiddleCoef_1024_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len2048 = { 2048, &plp_cfft_sR_q32_len1024,
+                                                        twiddleCoef_2048_q32 };
+
+const plp_rfft_instance_q32 plp_rfft_sR_q32_len4096 = { 4096, &plp_cfft_sR_q32_len2048,
+                                                        twiddleCoef_4096_q32 };
+
+
 const plp_fft_instance_f32 plp_rfft_sR_f32_len2048 = { 2048, 0, (float32_t *)twiddleCoef_rfft_2048,
                                                         (uint16_t *)bit_rev_radix2_LUT };
@@ -78,13 +78,15 @@ void plp_cmplx_mag_q16s_xpulpv2(const int16_t *pSrc,
                                 int16_t *pRes,
                                 uint32_t numSamples){
 
-    int16_t real, cmplx, sqr;
+    int32_t real, cmplx;
+    uint32_t mag;
     for (int i = 0; i < numSamples; i++) {
 
-        real = (pSrc[2 * i] * pSrc[2 * i]) >> fracBits;
-        cmplx = (pSrc[2 * i + 1] * pSrc[2 * i + 1]) >> fracBits;
-        sqr = real + cmplx;
-        plp_sqrt_q16(&sqr, fracBits, &pRes[i]);
+        // |z| * 2^fracBits = sqrt(real^2 + cmplx^2), the sum of the squares fits into 32 bits
+        real = pSrc[2 * i];
+        cmplx = pSrc[2 * i + 1];
+        mag = plp_sqrt_core_u32((uint32_t)(real * real) + (uint32_t)(cmplx * cmplx));
+        pRes[i] = (mag > 0x7FFF) ? 0x7FFF : (int16_t)mag;
     }
 }
 
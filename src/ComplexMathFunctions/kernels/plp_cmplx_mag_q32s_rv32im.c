@@ -79,13 +79,15 @@ void plp_cmplx_mag_q32s_rv32im(const int32_t *pSrc,
                                int32_t *pRes,
                                uint32_t numSamples){
 
-    int32_t real, cmplx, sqr;
+    int64_t real, cmplx;
+    uint32_t mag;
     for (int i = 0; i < numSamples; i++) {
 
-        real = (pSrc[2 * i] * pSrc[2 * i]) >> fracBits;
-        cmplx = (pSrc[2 * i + 1] * pSrc[2 * i + 1]) >> fracBits;
-        sqr = real + cmplx;
-        plp_sqrt_q32(&sqr, fracBits, &pRes[i]);
+        // |z| * 2^fracBits = sqrt(real^2 + cmplx^2), the sum of the squares fits into 64 bits
+        real = pSrc[2 * i];
+        cmplx = pSrc[2 * i + 1];
+        mag = plp_sqrt_core_u64((uint64_t)(real * real) + (uint64_t)(cmplx * cmplx));
+        pRes[i] = (mag > 0x7FFFFFFF) ? 0x7FFFFFFF : (int32_t)mag;
     }
 }
 
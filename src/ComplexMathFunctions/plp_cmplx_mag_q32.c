@@ -72,6 +72,10 @@
  * @param[in]  fracBits    fractional bits -> Q(32-fracBits).fracBits
  * @param      pRes        pointer to result
  * @param[in]  numSamples  The number samples
+ *
+ * @par Fix-Point
+ * The magnitude has the format of the input, saturated to the largest positive value. It is
+ * computed from the exact sum of the squares, since |z| * 2^fracBits = sqrt(real^2 + imag^2).
  */
 
 void plp_cmplx_mag_q32(const int32_t *pSrc,
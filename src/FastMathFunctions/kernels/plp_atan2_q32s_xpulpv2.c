@@ -0,0 +1,53 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_q32s_xpulpv2.c
+ * Description:  Calculates the inverse tangent of a 32-bit fixed point number for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup atan2
+*/
+
+/**
+   @addtogroup atan2Kernels
+   @{
+*/
+
+/**
+   @brief      Inverse tangent of a 32-bit fixed point number for XPULPV2 extension.
+   @param[in]  y  y coordinate, in any format
+   @param[in]  x  x coordinate, in the format of y
+   @return     atan2(y, x) / pi in Q1.31
+*/
+
+int32_t plp_atan2_q32s_xpulpv2(int32_t y, int32_t x) {
+    return plp_atan2_core_q32(y, x);
+}
+
+/**
+   @} end of atan2Kernels group
+*/
@@ -0,0 +1,96 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_vec_q16s_xpulpv2.c
+ * Description:  Calculates the inverse tangent of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FastMathVec
+*/
+
+/**
+   @addtogroup FastMathVecKernels
+   @{
+*/
+
+/**
+   @brief      Inverse tangent of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrcY      points to the y coordinates
+   @param[in]  pSrcX      points to the x coordinates
+   @param[out] pDst       points to the output vector
+   @param[in]  blockSize  number of samples in each vector
+   @return     none
+
+   @par
+   The results are bit-exact with plp_atan2_q16s_xpulpv2.
+*/
+void plp_atan2_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrcY,
+                                const int16_t *__restrict__ pSrcX,
+                                int16_t *__restrict__ pDst,
+                                uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        *((v2s *)pDst) = __PACK2(plp_atan2_core_q16(pSrcY[0], pSrcX[0]),
+                                 plp_atan2_core_q16(pSrcY[1], pSrcX[1]));
+        pSrcY += 2;
+        pSrcX += 2;
+        pDst += 2;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        *pDst++ = plp_atan2_core_q16(pSrcY[0], pSrcX[0]);
+        pSrcY++;
+        pSrcX++;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+   @} end of FastMathVecKernels group
+*/
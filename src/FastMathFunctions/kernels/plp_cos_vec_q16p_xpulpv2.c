@@ -0,0 +1,68 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_vec_q16p_xpulpv2.c
+ * Description:  Parallel cosine of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup FastMathVec
+*/
+
+/**
+   @addtogroup FastMathVecKernels
+   @{
+*/
+
+/**
+   @brief      Parallel cosine of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  args  pointer to plp_fast_math_vec_instance_q16 struct initialized by
+                     plp_cos_vec_q16_parallel
+   @return     none
+
+   @par
+   The samples are split into contiguous blocks of an even length, one per core, and every core
+   runs plp_cos_vec_q16s_xpulpv2 on its block.
+*/
+void plp_cos_vec_q16p_xpulpv2(void *args) {
+
+    plp_fast_math_vec_instance_q16 *S = (plp_fast_math_vec_instance_q16 *)args;
+
+    uint32_t core_id = hal_core_id();
+    uint32_t blkLen = ((S->blockSize + 2 * S->nPE - 1) / (2 * S->nPE)) * 2;
+    uint32_t start = MIN(core_id * blkLen, S->blockSize);
+    uint32_t stop = MIN(start + blkLen, S->blockSize);
+
+    plp_cos_vec_q16s_xpulpv2(S->pSrc + start, S->pDst + start, stop - start);
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of FastMathVecKernels group
+*/
@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_vec_q16s_xpulpv2.c
+ * Description:  Calculates the cosine of a 16-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @ingroup FastMathVec
+*/
+
+/**
+   @addtogroup FastMathVecKernels
+   @{
+*/
+
+static inline int16_t plp_sin_interp_q16(const int32_t index, const int32_t fract) {
+
+    int16_t sinVal;
+    int16_t a = sinTable_q16[index];
+    int16_t b = sinTable_q16[index + 1];
+
+    /* Linear interpolation process */
+    sinVal = (int32_t)(0x8000 - fract) * a >> 16;
+    sinVal = (int16_t)((((int32_t)sinVal << 16) + ((int32_t)fract * b)) >> 16);
+
+    return (sinVal << 1);
+}
+
+/**
+   @brief      Cosine of a 16-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+   @param[out] pDst       points to the output vector
+   @param[in]  blockSize  number of samples in each vector
+   @return     none
+
+   @par
+   Two samples are mapped to their table index and fraction at once with SIMD instructions, and
+   the two results are stored as one v2s. The results are bit-exact with plp_cos_q16s_xpulpv2.
+*/
+void plp_cos_vec_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
+                              int16_t *__restrict__ pDst,
+                              uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    v2s x, index, fract;
+    int32_t x0; /* Input mapped to [0, 1) */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        /* add 0.25 (pi/2) to read the sine table and convert negative numbers to the
+         * corresponding positive ones */
+        x = __AND2(__ADD2(*((v2s *)pSrc), ((v2s){ 0x2000, 0x2000 })), ((v2s){ 0x7fff, 0x7fff }));
+        pSrc += 2;
+
+        /* nearest indices and fractional values */
+        index = __SRL2(x, ((v2s){ FAST_MATH_Q16_SHIFT, FAST_MATH_Q16_SHIFT }));
+        fract = __SLL2(__AND2(x, ((v2s){ 0x3f, 0x3f })), ((v2s){ 9, 9 }));
+
+        *((v2s *)pDst) = __PACK2(plp_sin_interp_q16(index[0], fract[0]),
+                                 plp_sin_interp_q16(index[1], fract[1]));
+        pDst += 2;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        x0 = ((uint16_t)(*pSrc++) + 0x2000) & 0x7fff;
+        *pDst++ = plp_sin_interp_q16(x0 >> FAST_MATH_Q16_SHIFT, (x0 & 0x3f) << 9);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+   @} end of FastMathVecKernels group
+*/
@@ -0,0 +1,56 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_log_q16s_xpulpv2.c
+ * Description:  Calculates the natural logarithm of a 16-bit fixed point number for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup log
+*/
+
+/**
+   @addtogroup logKernels
+   @{
+*/
+
+/**
+   @brief      Natural logarithm of a 16-bit fixed point number for XPULPV2 extension.
+   @param[in]  x         input value
+   @param[in]  fracBits  number of fractional bits of the input and output, at most 15
+   @return     log(x) in the format of the input
+
+   @par
+   The result is computed in 32-bit precision with plp_log_core_q32 and rounded.
+*/
+
+int16_t plp_log_q16s_xpulpv2(int16_t x, uint32_t fracBits) {
+    return plp_log_core_q16(x, fracBits);
+}
+
+/**
+   @} end of logKernels group
+*/
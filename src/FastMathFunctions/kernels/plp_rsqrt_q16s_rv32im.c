@@ -0,0 +1,59 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rsqrt_q16s_rv32im.c
+ * Description:  16-bit fixed point reciprocal square root kernel for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup rsqrt
+*/
+
+/**
+   @addtogroup rsqrtKernels
+   @{
+*/
+
+/**
+   @brief         Reciprocal square root of a 16-bit fixed point number for RV32IM extension.
+   @param[in]     pSrc       points to the input value
+   @param[in]     fracBits   number of fractional bits of the input and output
+   @param[out]    pRes       Reciprocal square root returned here
+   @return        none
+*/
+
+void plp_rsqrt_q16s_rv32im(const int16_t *__restrict__ pSrc,
+                           const uint32_t fracBits,
+                           int16_t *__restrict__ pRes) {
+
+    int32_t res = plp_rsqrt_core_q32(*pSrc, fracBits, 2);
+
+    *pRes = (res > 0x7FFF) ? 0x7FFF : (int16_t)res;
+}
+
+/**
+   @} end of rsqrtKernels group
+*/
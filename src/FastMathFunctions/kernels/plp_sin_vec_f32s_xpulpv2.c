@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sin_vec_f32s_xpulpv2.c
+ * Description:  Calculates the sine of a 32-bit floating point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @ingroup FastMathVec
+*/
+
+/**
+   @addtogroup FastMathVecKernels
+   @{
+*/
+
+static inline float32_t plp_sin_interp_f32(const float32_t x) {
+
+    float32_t in, findex, fract;
+    uint16_t index;
+    int32_t n;
+
+    /* Scale input to [0 1] range from [0 2*PI] */
+    in = x * 0.159154943092f;
+
+    /* Floor towards -infinity and map to [0 1] */
+    n = (int32_t)in;
+    if (in < 0.0f) {
+        n--;
+    }
+    in = in - (float32_t)n;
+
+    /* Calculation of index of the table */
+    findex = (float32_t)FAST_MATH_TABLE_SIZE * in;
+    index = (uint16_t)findex;
+
+    /* when "in" is exactly 1, we need to rotate the index down to 0 */
+    if (index >= FAST_MATH_TABLE_SIZE) {
+        index = 0;
+        findex -= (float32_t)FAST_MATH_TABLE_SIZE;
+    }
+
+    fract = findex - (float32_t)index;
+
+    /* Linear interpolation process */
+    return (1.0f - fract) * sinTable_f32[index] + fract * sinTable_f32[index + 1];
+}
+
+/**
+   @brief      Sine of a 32-bit floating point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector, in radians
+   @param[out] pDst       points to the output vector
+   @param[in]  blockSize  number of samples in each vector
+   @return     none
+
+   @par
+   The results are bit-exact with plp_sin_f32s_xpulpv2.
+*/
+void plp_sin_vec_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                              float32_t *__restrict__ pDst,
+                              uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        *pDst++ = plp_sin_interp_f32(pSrc[0]);
+        *pDst++ = plp_sin_interp_f32(pSrc[1]);
+        pSrc += 2;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        *pDst++ = plp_sin_interp_f32(*pSrc++);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+   @} end of FastMathVecKernels group
+*/
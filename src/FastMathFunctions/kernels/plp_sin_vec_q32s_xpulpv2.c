@@ -0,0 +1,109 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sin_vec_q32s_xpulpv2.c
+ * Description:  Calculates the sine of a 32-bit fixed point vector for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_common_tables.h"
+#include "plp_math.h"
+
+/**
+   @ingroup FastMathVec
+*/
+
+/**
+   @addtogroup FastMathVecKernels
+   @{
+*/
+
+static inline int32_t plp_sin_interp_q32(const int32_t index, const int32_t fract) {
+
+    int32_t sinVal;
+    int32_t a = sinTable_q32[index];
+    int32_t b = sinTable_q32[index + 1];
+
+    /* Linear interpolation process */
+    sinVal = (int64_t)(0x80000000 - fract) * a >> 32;
+    sinVal = (int32_t)((((int64_t)sinVal << 32) + ((int64_t)fract * b)) >> 32);
+
+    return (sinVal << 1);
+}
+
+/**
+   @brief      Sine of a 32-bit fixed point vector for XPULPV2 extension.
+   @param[in]  pSrc       points to the input vector, Q1.31 values in [0, 1) are mapped to [0, 2*PI)
+   @param[out] pDst       points to the output vector
+   @param[in]  blockSize  number of samples in each vector
+   @return     none
+
+   @par
+   The results are bit-exact with plp_sin_q32s_xpulpv2.
+*/
+void plp_sin_vec_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                              int32_t *__restrict__ pDst,
+                              uint32_t blockSize) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int32_t x0, x1; /* Inputs mapped to [0, 1) */
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 outputs at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        /* convert negative numbers to the corresponding positive ones */
+        x0 = *pSrc++ & 0x7fffffff;
+        x1 = *pSrc++ & 0x7fffffff;
+
+        *pDst++ = plp_sin_interp_q32(x0 >> FAST_MATH_Q32_SHIFT, (x0 & 0x3fffff) << 9);
+        *pDst++ = plp_sin_interp_q32(x1 >> FAST_MATH_Q32_SHIFT, (x1 & 0x3fffff) << 9);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining outputs */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        x0 = *pSrc++ & 0x7fffffff;
+        *pDst++ = plp_sin_interp_q32(x0 >> FAST_MATH_Q32_SHIFT, (x0 & 0x3fffff) << 9);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+   @} end of FastMathVecKernels group
+*/
@@ -33,7 +33,6 @@
  * with Apache-2.0.
  */
 
-#define sqrt2 0b1011010100000100
 #include "plp_math.h"
 
 /**
@@ -42,7 +41,6 @@
 
 /**
    @defgroup sqrtKernels Sqrt Kernels
-
 */
 
 /**
@@ -52,101 +50,23 @@
 
 /**
    @brief         Square root of a 16-bit fixed point number for XPULPV2 extension.
-   @param[in]     pSrc       points to the input vector
-   @param[out]    pRes    Square root returned here
+   @param[in]     pSrc       points to the input value
+   @param[in]     fracBits   number of fractional bits of the input and output
+   @param[out]    pRes       Square root returned here
    @return        none
+
+   @par
+   The result is exact, i.e. the largest value whose square does not exceed the input. It is
+   computed in constant time with plp_sqrt_core_q16, negative inputs return 0.
 */
 
 void plp_sqrt_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
                            const uint32_t fracBits,
                            int16_t *__restrict__ pRes) {
 
-    int16_t number, temp1, intermediate_fixpoint, signBits, half;
-    int32_t bits_val1;
-    float temp_float1;
-    union {
-        int32_t fracval;
-        float floatval;
-    } tempconv;
-
-    number = *pSrc;
-
-    /* If the input is a positive number then compute the signBits. */
-    if (number > 0) {
-        signBits = __builtin_clz(number) - 17;
-
-        /* Shift by the number of signBits */
-        if ((signBits % 2) == 0) {
-            number = number << signBits;
-        } else {
-            number = number << (signBits - 1);
-        }
-
-        /* Calculate half value of the number */
-        half = number >> 1;
-        /* Store the number for later use */
-        temp1 = number;
-
-        /* Convert to float */
-        temp_float1 = number * 3.051757812500000e-005f;
-        /*Store as integer */
-        tempconv.floatval = temp_float1;
-        bits_val1 = tempconv.fracval;
-        /* Subtract the shifted value from the magic number to give intial guess */
-        bits_val1 = 0x5f3759df - (bits_val1 >> 1); /* gives initial guess */
-        /* Store as float */
-        tempconv.fracval = bits_val1;
-        temp_float1 = tempconv.floatval;
-        /* Convert to integer format */
-        intermediate_fixpoint = (int32_t)(temp_float1 * 16384);
-
-        intermediate_fixpoint =
-            ((int16_t)((int32_t)intermediate_fixpoint *
-                           (0x3000 - ((int16_t)((((int16_t)(((int32_t)intermediate_fixpoint *
-                                                             intermediate_fixpoint) >>
-                                                            15)) *
-                                                 (int32_t)half) >>
-                                                15))) >>
-                       15))
-            << 2;
-
-        intermediate_fixpoint =
-            ((int16_t)((int32_t)intermediate_fixpoint *
-                           (0x3000 - ((int16_t)((((int16_t)(((int32_t)intermediate_fixpoint *
-                                                             intermediate_fixpoint) >>
-                                                            15)) *
-                                                 (int32_t)half) >>
-                                                15))) >>
-                       15))
-            << 2;
-
-        intermediate_fixpoint =
-            ((int16_t)((int32_t)intermediate_fixpoint *
-                           (0x3000 - ((int16_t)((((int16_t)(((int32_t)intermediate_fixpoint *
-                                                             intermediate_fixpoint) >>
-                                                            15)) *
-                                                 (int32_t)half) >>
-                                                15))) >>
-                       15))
-            << 2;
-
-        intermediate_fixpoint = ((int16_t)(((int32_t)temp1 * intermediate_fixpoint) >> 15)) << 1;
-
-        if ((16 - fracBits) > 1) {
-            intermediate_fixpoint = intermediate_fixpoint >> ((int32_t)(16 - fracBits) >> 1);
-            if ((16 - fracBits) % 2 == 0) {
-                intermediate_fixpoint = ((int32_t)intermediate_fixpoint * sqrt2) >> 15;
-            }
-        }
-
-        if ((signBits % 2) == 0) {
-            intermediate_fixpoint = intermediate_fixpoint >> (signBits / 2);
-        } else {
-            intermediate_fixpoint = intermediate_fixpoint >> ((signBits - 1) / 2);
-        }
-        *pRes = intermediate_fixpoint;
-
-    } else {
-        *pRes = 0;
-    }
+    *pRes = plp_sqrt_core_q16(*pSrc, fracBits);
 }
+
+/**
+   @} end of sqrtKernels group
+*/
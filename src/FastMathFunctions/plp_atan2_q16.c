@@ -0,0 +1,58 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_q16.c
+ * Description:  Calculates the inverse tangent of a 16-bit fixed point number
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMath
+*/
+
+/**
+   @addtogroup atan2
+   @{
+*/
+
+/**
+   @brief      Glue code for inverse tangent of a 16-bit fixed point number.
+   @param[in]  y  y coordinate, in any format
+   @param[in]  x  x coordinate, in the format of y
+   @return     atan2(y, x) / pi in Q1.15
+*/
+
+int16_t plp_atan2_q16(int16_t y, int16_t x) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        return plp_atan2_q16s_rv32im(y, x);
+    } else {
+        return plp_atan2_q16s_xpulpv2(y, x);
+    }
+}
+
+/**
+   @} end of atan2 group
+*/
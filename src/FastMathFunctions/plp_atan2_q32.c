@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_atan2_q32.c
+ * Description:  Calculates the inverse tangent of a 32-bit fixed point number
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMath
+*/
+
+/**
+   @defgroup atan2 Inverse Tangent
+
+   Four-quadrant inverse tangent, y = atan2(y, x). The fixed point versions accept the
+   coordinates in any format (both with the same one) and return the angle divided by pi, i.e. the
+   angle in [-pi, pi] is mapped to [-1, 1) in Q1.31 or Q1.15, the input format of plp_sin and
+   plp_cos. The floating point version returns the angle in radians. The quotient of the
+   coordinates is reduced to the first octant and the inverse tangent is evaluated with a
+   polynomial, hence the latency does not depend on the input.
+
+   Maximum absolute error: 2 LSB (q32), 0.5 LSB (q16), 2^-21 (f32).
+*/
+
+/**
+   @addtogroup atan2
+   @{
+*/
+
+/**
+   @brief      Glue code for inverse tangent of a 32-bit fixed point number.
+   @param[in]  y  y coordinate, in any format
+   @param[in]  x  x coordinate, in the format of y
+   @return     atan2(y, x) / pi in Q1.31
+*/
+
+int32_t plp_atan2_q32(int32_t y, int32_t x) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        return plp_atan2_q32s_rv32im(y, x);
+    } else {
+        return plp_atan2_q32s_xpulpv2(y, x);
+    }
+}
+
+/**
+   @} end of atan2 group
+*/
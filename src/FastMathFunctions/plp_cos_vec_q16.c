@@ -0,0 +1,60 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cos_vec_q16.c
+ * Description:  Calculates the cosine of a 16-bit fixed point vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMath
+*/
+
+/**
+   @addtogroup FastMathVec
+   @{
+*/
+
+/**
+   @brief      Glue code for cosine of a 16-bit fixed point vector.
+   @param[in]  pSrc       points to the input vector, Q1.15 values in [0, 1) are mapped to [0, 2*PI)
+   @param[out] pDst       points to the output vector
+   @param[in]  blockSize  number of samples in each vector
+   @return     none
+*/
+void plp_cos_vec_q16(const int16_t *__restrict__ pSrc,
+                     int16_t *__restrict__ pDst,
+                     uint32_t blockSize) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_cos_vec_q16s_rv32im(pSrc, pDst, blockSize);
+    } else {
+        plp_cos_vec_q16s_xpulpv2(pSrc, pDst, blockSize);
+    }
+}
+
+/**
+   @} end of FastMathVec group
+*/
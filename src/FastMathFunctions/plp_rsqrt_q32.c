@@ -0,0 +1,71 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rsqrt_q32.c
+ * Description:  Calculates the reciprocal square root of a 32-bit fixed point number
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMath
+*/
+
+/**
+   @defgroup rsqrt Reciprocal Sqrt
+
+   Reciprocal square root of a fixed point number, y = 1 / sqrt(x), where the input and the output
+   have the same number of fractional bits. The input is normalized with count leading zeros and
+   the result is computed with a table lookup followed by a fixed number of Newton iterations,
+   hence the latency does not depend on the input. Results which do not fit the output format, as
+   well as the results for inputs x <= 0, saturate to the largest positive value.
+*/
+
+/**
+   @addtogroup rsqrt
+   @{
+*/
+
+/**
+   @brief         Glue code for reciprocal square root of a 32-bit fixed point number.
+   @param[in]     pSrc       points to the input value
+   @param[in]     fracBits   number of fractional bits of the input and output
+   @param[out]    pRes       Reciprocal square root returned here
+   @return        none
+*/
+
+void plp_rsqrt_q32(const int32_t *__restrict__ pSrc,
+                   const uint32_t fracBits,
+                   int32_t *__restrict__ pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_rsqrt_q32s_rv32im(pSrc, fracBits, pRes);
+    } else {
+        plp_rsqrt_q32s_xpulpv2(pSrc, fracBits, pRes);
+    }
+}
+
+/**
+   @} end of rsqrt group
+*/
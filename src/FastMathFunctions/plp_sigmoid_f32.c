@@ -0,0 +1,57 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_sigmoid_f32.c
+ * Description:  Calculates the logistic sigmoid of a 32-bit floating point number
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMath
+*/
+
+/**
+   @addtogroup sigmoid
+   @{
+*/
+
+/**
+   @brief      Glue code for logistic sigmoid of a 32-bit floating point number.
+   @param[in]  x  input value
+   @return     1 / (1 + exp(-x))
+*/
+
+float32_t plp_sigmoid_f32(float32_t x) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        return 0.0f;
+    } else {
+        return plp_sigmoid_f32s_xpulpv2(x);
+    }
+}
+
+/**
+   @} end of sigmoid group
+*/
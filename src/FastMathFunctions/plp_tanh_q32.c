@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_tanh_q32.c
+ * Description:  Calculates the hyperbolic tangent of a 32-bit fixed point number
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupMath
+*/
+
+/**
+   @defgroup tanh Hyperbolic Tangent
+
+   Hyperbolic tangent, y = tanh(x). For the fixed point versions, the input and the output
+   have the same number of fractional bits. The result is computed from exp(-2 |x|) and a
+   reciprocal without any division instruction, hence the latency does not depend on the input.
+
+   Maximum absolute error: 2^-29 in addition to the rounding of the output (q32), 0.5 LSB (q16),
+   4 ulp (f32).
+*/
+
+/**
+   @addtogroup tanh
+   @{
+*/
+
+/**
+   @brief      Glue code for hyperbolic tangent of a 32-bit fixed point number.
+   @param[in]  x         input value
+   @param[in]  fracBits  number of fractional bits of the input and output
+   @return     tanh(x) in the format of the input
+*/
+
+int32_t plp_tanh_q32(int32_t x, uint32_t fracBits) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        return plp_tanh_q32s_rv32im(x, fracBits);
+    } else {
+        return plp_tanh_q32s_xpulpv2(x, fracBits);
+    }
+}
+
+/**
+   @} end of tanh group
+*/
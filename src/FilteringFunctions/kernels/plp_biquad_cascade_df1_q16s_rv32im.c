@@ -0,0 +1,118 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16s_rv32im.c
+ * Description:  16-bit fixed point biquad cascade filter for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @defgroup BiquadCascadeKernels Biquad Cascade IIR Filter Kernels
+   This module contains the kernel code for the biquad cascade IIR filters.
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/* rounds the accumulator to fracBits fractional bits and saturates it to 16 bits */
+static inline int32_t plp_biquad_sat_q16(int64_t acc, uint32_t fracBits) {
+    if (fracBits > 0) {
+        acc = (acc + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    if (acc > 32767) {
+        return 32767;
+    } else if (acc < -32768) {
+        return -32768;
+    }
+    return (int32_t)acc;
+}
+
+/**
+   @brief      16-bit fixed point biquad cascade filter (DF1) kernel for RV32IM extension.
+
+   Every stage accumulates the five products in 64 bits, and rounds and saturates the result to
+   S->fracBits fractional bits.
+
+   @param[in]   S          points to an instance of the biquad cascade structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+*/
+void plp_biquad_cascade_df1_q16s_rv32im(const plp_biquad_cascade_df1_instance_q16 *S,
+                                        const int16_t *pSrc,
+                                        uint32_t blockSize,
+                                        int16_t *pDst) {
+    uint32_t numStages = S->numStages;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+    const int16_t *pIn = pSrc;
+    uint32_t stage, n;
+
+    for (stage = 0; stage < numStages; stage++) {
+        int32_t b0 = pCoeffs[0];
+        int32_t b1 = pCoeffs[2];
+        int32_t b2 = pCoeffs[3];
+        int32_t a1 = pCoeffs[4];
+        int32_t a2 = pCoeffs[5];
+        int32_t x1 = pState[0];
+        int32_t x2 = pState[1];
+        int32_t y1 = pState[2];
+        int32_t y2 = pState[3];
+
+        for (n = 0; n < blockSize; n++) {
+            int32_t x0 = pIn[n];
+            int64_t acc = (int64_t)(b0 * x0) + (b1 * x1) + (b2 * x2) + (a1 * y1) + (a2 * y2);
+            int32_t y0 = plp_biquad_sat_q16(acc, fracBits);
+
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            pDst[n] = y0;
+        }
+
+        pState[0] = x1;
+        pState[1] = x2;
+        pState[2] = y1;
+        pState[3] = y2;
+
+        /* the output of this stage is the input of the next one */
+        pIn = pDst;
+        pState += 4;
+        pCoeffs += 6;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
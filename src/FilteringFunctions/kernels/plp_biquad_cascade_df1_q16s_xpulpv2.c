@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16s_xpulpv2.c
+ * Description:  16-bit fixed point biquad cascade filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/* rounds the accumulator to fracBits fractional bits and saturates it to 16 bits */
+static inline int32_t plp_biquad_sat_q16(int64_t acc, uint32_t fracBits) {
+    if (fracBits > 0) {
+        acc = (acc + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    if (acc > 32767) {
+        return 32767;
+    } else if (acc < -32768) {
+        return -32768;
+    }
+    return (int32_t)acc;
+}
+
+/**
+   @brief      16-bit fixed point biquad cascade filter (DF1) kernel for XPULPV2 extension.
+
+   Every stage accumulates the five products in 64 bits, and rounds and saturates the result to
+   S->fracBits fractional bits.
+
+   @param[in]   S          points to an instance of the biquad cascade structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+
+   @par Exploiting SIMD instructions
+   The coefficients and the delayed samples of both the input and the output are kept in pairs of
+   16 bit values, such that the four delayed terms are computed with two __DOTP2. Each of them is
+   at most 2^31 - 1 in magnitude, as long as no coefficient is -32768.
+*/
+void plp_biquad_cascade_df1_q16s_xpulpv2(const plp_biquad_cascade_df1_instance_q16 *S,
+                                         const int16_t *pSrc,
+                                         uint32_t blockSize,
+                                         int16_t *pDst) {
+    uint32_t numStages = S->numStages;
+    const int16_t *pCoeffs = S->pCoeffs;
+    int16_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+    const int16_t *pIn = pSrc;
+    uint32_t stage, n;
+
+    for (stage = 0; stage < numStages; stage++) {
+        int32_t b0 = pCoeffs[0];
+        v2s b12 = *((v2s *)&pCoeffs[2]); // {b1, b2}
+        v2s a12 = *((v2s *)&pCoeffs[4]); // {a1, a2}
+        v2s x12 = *((v2s *)&pState[0]);  // {x[n-1], x[n-2]}
+        v2s y12 = *((v2s *)&pState[2]);  // {y[n-1], y[n-2]}
+
+        for (n = 0; n < blockSize; n++) {
+            int32_t x0 = pIn[n];
+            int64_t acc = (int64_t)(b0 * x0) + __DOTP2(x12, b12) + __DOTP2(y12, a12);
+            int32_t y0 = plp_biquad_sat_q16(acc, fracBits);
+
+            x12 = __PACK2(x0, x12[0]);
+            y12 = __PACK2(y0, y12[0]);
+            pDst[n] = y0;
+        }
+
+        *((v2s *)&pState[0]) = x12;
+        *((v2s *)&pState[2]) = y12;
+
+        /* the output of this stage is the input of the next one */
+        pIn = pDst;
+        pState += 4;
+        pCoeffs += 6;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
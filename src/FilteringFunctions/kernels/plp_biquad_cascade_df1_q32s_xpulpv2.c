@@ -0,0 +1,117 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q32s_xpulpv2.c
+ * Description:  32-bit fixed point biquad cascade filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/* rounds the accumulator to fracBits fractional bits and saturates it to 32 bits */
+static inline int32_t plp_biquad_sat_q32(int64_t acc, uint32_t fracBits) {
+    if (fracBits > 0) {
+        acc = (acc + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    if (acc > INT32_MAX) {
+        return INT32_MAX;
+    } else if (acc < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)acc;
+}
+
+/**
+   @brief      32-bit fixed point biquad cascade filter (DF1) kernel for XPULPV2 extension.
+
+   Every stage accumulates the five products in 64 bits, and rounds and saturates the result to
+   S->fracBits fractional bits.
+
+   @param[in]   S          points to an instance of the biquad cascade structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+*/
+void plp_biquad_cascade_df1_q32s_xpulpv2(const plp_biquad_cascade_df1_instance_q32 *S,
+                                         const int32_t *pSrc,
+                                         uint32_t blockSize,
+                                         int32_t *pDst) {
+    uint32_t numStages = S->numStages;
+    const int32_t *pCoeffs = S->pCoeffs;
+    int32_t *pState = S->pState;
+    uint32_t fracBits = S->fracBits;
+    const int32_t *pIn = pSrc;
+    uint32_t stage, n;
+
+    for (stage = 0; stage < numStages; stage++) {
+        int32_t b0 = pCoeffs[0];
+        int32_t b1 = pCoeffs[1];
+        int32_t b2 = pCoeffs[2];
+        int32_t a1 = pCoeffs[3];
+        int32_t a2 = pCoeffs[4];
+        int32_t x1 = pState[0];
+        int32_t x2 = pState[1];
+        int32_t y1 = pState[2];
+        int32_t y2 = pState[3];
+
+        for (n = 0; n < blockSize; n++) {
+            int32_t x0 = pIn[n];
+            int64_t acc = (int64_t)b0 * x0;
+            acc += (int64_t)b1 * x1;
+            acc += (int64_t)b2 * x2;
+            acc += (int64_t)a1 * y1;
+            acc += (int64_t)a2 * y2;
+            int32_t y0 = plp_biquad_sat_q32(acc, fracBits);
+
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            pDst[n] = y0;
+        }
+
+        pState[0] = x1;
+        pState[1] = x2;
+        pState[2] = y1;
+        pState[3] = y2;
+
+        /* the output of this stage is the input of the next one */
+        pIn = pDst;
+        pState += 4;
+        pCoeffs += 5;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
@@ -0,0 +1,64 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_f32p_xpulpv2.c
+ * Description:  Parallel 32-bit floating point biquad cascade filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/**
+   @brief      Parallel 32-bit floating point biquad cascade filter (DF2T) kernel for XPULPV2
+               extension.
+
+   The channels are distributed cyclically among the cores, every core filters its channels with
+   plp_biquad_cascade_df2T_f32s_xpulpv2.
+
+   @param[in]   args    points to the plp_biquad_cascade_df2T_instance_f32_parallel
+   @return      none
+*/
+void plp_biquad_cascade_df2T_f32p_xpulpv2(void *args) {
+    plp_biquad_cascade_df2T_instance_f32_parallel *a =
+        (plp_biquad_cascade_df2T_instance_f32_parallel *)args;
+    uint32_t blockSize = a->blockSize;
+    uint32_t c;
+
+    for (c = hal_core_id(); c < a->nChannels; c += a->nPE) {
+        plp_biquad_cascade_df2T_f32s_xpulpv2(&a->S[c], a->pSrc + c * blockSize, blockSize,
+                                             a->pDst + c * blockSize);
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_f32s_xpulpv2.c
+ * Description:  32-bit floating point biquad cascade filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup BiquadCascade
+*/
+
+/**
+   @addtogroup BiquadCascadeKernels
+   @{
+*/
+
+/**
+   @brief      32-bit floating point biquad cascade filter (DF2T) kernel for XPULPV2 extension.
+
+   @param[in]   S          points to an instance of the biquad cascade structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+*/
+void plp_biquad_cascade_df2T_f32s_xpulpv2(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                          const float32_t *pSrc,
+                                          uint32_t blockSize,
+                                          float32_t *pDst) {
+    uint32_t numStages = S->numStages;
+    const float32_t *pCoeffs = S->pCoeffs;
+    float32_t *pState = S->pState;
+    const float32_t *pIn = pSrc;
+    uint32_t stage, n;
+
+    for (stage = 0; stage < numStages; stage++) {
+        float32_t b0 = pCoeffs[0];
+        float32_t b1 = pCoeffs[1];
+        float32_t b2 = pCoeffs[2];
+        float32_t a1 = pCoeffs[3];
+        float32_t a2 = pCoeffs[4];
+        float32_t d1 = pState[0];
+        float32_t d2 = pState[1];
+
+        for (n = 0; n < blockSize; n++) {
+            float32_t x0 = pIn[n];
+            float32_t y0 = b0 * x0 + d1;
+
+            d1 = b1 * x0 + a1 * y0 + d2;
+            d2 = b2 * x0 + a2 * y0;
+            pDst[n] = y0;
+        }
+
+        pState[0] = d1;
+        pState[1] = d2;
+
+        /* the output of this stage is the input of the next one */
+        pIn = pDst;
+        pState += 2;
+        pCoeffs += 5;
+    }
+}
+
+/**
+   @} end of BiquadCascadeKernels group
+*/
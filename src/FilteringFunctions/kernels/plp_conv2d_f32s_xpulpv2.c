@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_f32s_xpulpv2.c
+ * Description:  Valid 2D convolution of 32-bit floating point images for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief      Valid 2D convolution of 32-bit floating point images kernel for XPULPV2 extension.
+   @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+   @param[in]  srcRows  number of rows of the input image
+   @param[in]  srcCols  number of columns of the input image
+   @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+   @param[in]  kerRows  number of rows of the filter kernel
+   @param[in]  kerCols  number of columns of the filter kernel
+   @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                        (srcCols - kerCols + 1) elements
+   @return     none
+
+   @par Loop unrolling
+   Four neighbouring output pixels are computed at once, such that every element of the filter
+   kernel is loaded once for four multiply-accumulates.
+*/
+void plp_conv2d_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                             uint32_t srcRows,
+                             uint32_t srcCols,
+                             const float32_t *__restrict__ pKernel,
+                             uint32_t kerRows,
+                             uint32_t kerCols,
+                             float32_t *__restrict__ pDst) {
+
+    uint32_t dstRows = srcRows - kerRows + 1;
+    uint32_t dstCols = srcCols - kerCols + 1;
+    uint32_t i, j, m, n;
+
+    for (i = 0; i < dstRows; i++) {
+
+        float32_t *pOut = pDst + i * dstCols;
+
+        for (j = 0; j + 4 <= dstCols; j += 4) {
+            float32_t acc0 = 0.0f;
+            float32_t acc1 = 0.0f;
+            float32_t acc2 = 0.0f;
+            float32_t acc3 = 0.0f;
+            const float32_t *pKer = pKernel + kerRows * kerCols - 1; // last element of the kernel
+
+            for (m = 0; m < kerRows; m++) {
+                const float32_t *pIn = pSrc + (i + m) * srcCols + j;
+                for (n = 0; n < kerCols; n++) {
+                    float32_t h = *pKer--;
+                    acc0 += pIn[n] * h;
+                    acc1 += pIn[n + 1] * h;
+                    acc2 += pIn[n + 2] * h;
+                    acc3 += pIn[n + 3] * h;
+                }
+            }
+
+            pOut[j] = acc0;
+            pOut[j + 1] = acc1;
+            pOut[j + 2] = acc2;
+            pOut[j + 3] = acc3;
+        }
+
+        // remaining outputs at the end of the row
+        for (; j < dstCols; j++) {
+            float32_t sum = 0.0f;
+            const float32_t *pKer = pKernel + kerRows * kerCols - 1;
+            for (m = 0; m < kerRows; m++) {
+                const float32_t *pIn = pSrc + (i + m) * srcCols + j;
+                for (n = 0; n < kerCols; n++) {
+                    sum += pIn[n] * *pKer--;
+                }
+            }
+            pOut[j] = sum;
+        }
+    }
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
@@ -0,0 +1,187 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i16p_xpulpv2.c
+ * Description:  Parallel tiled valid 2D convolution of 16-bit integer images for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief Start the transfer of the input pixels of tile t into the L1 buffer buf.
+   @param[in]  a    pointer to the instance struct
+   @param[in]  t    index of the tile
+   @param[in]  buf  buffer to be filled (0 or 1)
+   @return     none
+*/
+static void plp_conv2d_i16_load(plp_conv2d_instance_i16 *a, uint32_t t, uint32_t buf) {
+
+    uint32_t dstRows = a->srcRows - a->kerRows + 1;
+    uint32_t dstCols = a->srcCols - a->kerCols + 1;
+    uint32_t nTilesCols = (dstCols + a->tileCols - 1) / a->tileCols;
+
+    uint32_t r0 = (t / nTilesCols) * a->tileRows;
+    uint32_t c0 = (t % nTilesCols) * a->tileCols;
+    uint32_t curRows = (dstRows - r0 < a->tileRows) ? dstRows - r0 : a->tileRows;
+    uint32_t curCols = (dstCols - c0 < a->tileCols) ? dstCols - c0 : a->tileCols;
+
+    // the tile including the halo
+    uint32_t inRows = curRows + a->kerRows - 1;
+    uint32_t inCols = curCols + a->kerCols - 1;
+
+    int16_t *pLoc =
+        a->pBufSrc + buf * (a->tileRows + a->kerRows - 1) * (a->tileCols + a->kerCols - 1);
+
+    // the tile is stored densely in L1, rows which are contiguous in L2 are merged into a single
+    // transfer
+    if (inCols == a->srcCols) {
+        hal_cl_dma_cmd((uintptr_t)(a->pSrc + r0 * a->srcCols), (uintptr_t)pLoc,
+                       sizeof(int16_t) * inRows * inCols, HAL_CL_DMA_DIR_EXT2LOC, 0,
+                       &a->dmaLoad[buf]);
+    } else {
+        for (uint32_t m = 0; m < inRows; m++) {
+            hal_cl_dma_cmd((uintptr_t)(a->pSrc + (r0 + m) * a->srcCols + c0),
+                           (uintptr_t)(pLoc + m * inCols), sizeof(int16_t) * inCols,
+                           HAL_CL_DMA_DIR_EXT2LOC, m != 0, &a->dmaLoad[buf]);
+        }
+    }
+}
+
+/**
+   @brief Parallel tiled valid 2D convolution of 16-bit integer images kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_conv2d_instance_i16 struct initialized by
+                     plp_conv2d_i16_parallel
+   @return     none
+
+   @par Double buffering
+   The output image is computed tile by tile. Core 0 drives the DMA: while all cores compute
+   tile t, the input pixels of tile t + 1 (including the halo) are transferred into the other
+   input buffer, and the output tile t - 1 is written back to L2 from the other output buffer.
+   Within a tile, the output rows are split among the cores with plp_mat_partition, and every
+   core runs plp_conv2d_i16s_xpulpv2 on its rows.
+*/
+void plp_conv2d_i16p_xpulpv2(void *args) {
+
+    plp_conv2d_instance_i16 *a = (plp_conv2d_instance_i16 *)args;
+
+    uint32_t kerRows = a->kerRows;
+    uint32_t kerCols = a->kerCols;
+    uint32_t tileRows = a->tileRows;
+    uint32_t tileCols = a->tileCols;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t dstRows = a->srcRows - kerRows + 1;
+    uint32_t dstCols = a->srcCols - kerCols + 1;
+    uint32_t nTilesRows = (dstRows + tileRows - 1) / tileRows;
+    uint32_t nTilesCols = (dstCols + tileCols - 1) / tileCols;
+    uint32_t nTiles = nTilesRows * nTilesCols;
+    uint32_t sizeBufSrc = (tileRows + kerRows - 1) * (tileCols + kerCols - 1);
+
+    uint32_t t, i;
+
+    if (core_id == 0) {
+        plp_conv2d_i16_load(a, 0, 0);
+    }
+
+    for (t = 0; t < nTiles; t++) {
+
+        uint32_t buf = t & 1;
+
+        uint32_t r0 = (t / nTilesCols) * tileRows;
+        uint32_t c0 = (t % nTilesCols) * tileCols;
+        uint32_t curRows = (dstRows - r0 < tileRows) ? dstRows - r0 : tileRows;
+        uint32_t curCols = (dstCols - c0 < tileCols) ? dstCols - c0 : tileCols;
+        uint32_t inCols = curCols + kerCols - 1;
+
+        if (core_id == 0) {
+            hal_cl_dma_cmd_wait(&a->dmaLoad[buf]);
+            // the output buffer is reused, its previous content must be in L2
+            if (t >= 2) {
+                hal_cl_dma_cmd_wait(&a->dmaStore[buf]);
+            }
+        }
+
+        // the input tile t is in L1 and all cores are done with tile t - 1
+        hal_team_barrier();
+
+        if (core_id == 0 && t + 1 < nTiles) {
+            plp_conv2d_i16_load(a, t + 1, buf ^ 1);
+        }
+
+        const int16_t *pIn = a->pBufSrc + buf * sizeBufSrc;
+        int32_t *pOut = a->pBufDst + buf * tileRows * tileCols;
+
+        plp_mat_tile tile;
+        plp_mat_partition(curRows, 1, 1, nPE, core_id, &tile);
+
+        if (tile.rowEnd > tile.rowStart) {
+            plp_conv2d_i16s_xpulpv2(pIn + tile.rowStart * inCols,
+                                     tile.rowEnd - tile.rowStart + kerRows - 1, inCols,
+                                     a->pBufKer, kerRows, kerCols,
+                                     pOut + tile.rowStart * curCols);
+        }
+
+        // write the finished output tile back to L2
+        hal_team_barrier();
+        if (core_id == 0) {
+            if (curCols == dstCols) {
+                hal_cl_dma_cmd((uintptr_t)(pDst + r0 * dstCols), (uintptr_t)pOut,
+                               sizeof(int32_t) * curRows * curCols, HAL_CL_DMA_DIR_LOC2EXT, 0,
+                               &a->dmaStore[buf]);
+            } else {
+                for (i = 0; i < curRows; i++) {
+                    hal_cl_dma_cmd((uintptr_t)(pDst + (r0 + i) * dstCols + c0),
+                                   (uintptr_t)(pOut + i * curCols), sizeof(int32_t) * curCols,
+                                   HAL_CL_DMA_DIR_LOC2EXT, i != 0, &a->dmaStore[buf]);
+                }
+            }
+        }
+    }
+
+    if (core_id == 0) {
+        if (nTiles >= 2) {
+            hal_cl_dma_cmd_wait(&a->dmaStore[nTiles & 1]);
+        }
+        hal_cl_dma_cmd_wait(&a->dmaStore[(nTiles - 1) & 1]);
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
@@ -0,0 +1,81 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i16s_rv32im.c
+ * Description:  Valid 2D convolution of 16-bit integer images for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief      Valid 2D convolution of 16-bit integer images kernel for RV32IM extension.
+   @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+   @param[in]  srcRows  number of rows of the input image
+   @param[in]  srcCols  number of columns of the input image
+   @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+   @param[in]  kerRows  number of rows of the filter kernel
+   @param[in]  kerCols  number of columns of the filter kernel
+   @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                        (srcCols - kerCols + 1) elements
+   @return     none
+*/
+void plp_conv2d_i16s_rv32im(const int16_t *__restrict__ pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            const int16_t *__restrict__ pKernel,
+                            uint32_t kerRows,
+                            uint32_t kerCols,
+                            int32_t *__restrict__ pDst) {
+
+    uint32_t dstRows = srcRows - kerRows + 1;
+    uint32_t dstCols = srcCols - kerCols + 1;
+    uint32_t i, j, m, n;
+
+    for (i = 0; i < dstRows; i++) {
+        for (j = 0; j < dstCols; j++) {
+            int32_t sum = 0;
+            const int16_t *pKer = pKernel + kerRows * kerCols - 1; // last element of the kernel
+            for (m = 0; m < kerRows; m++) {
+                const int16_t *pIn = pSrc + (i + m) * srcCols + j;
+                for (n = 0; n < kerCols; n++) {
+                    sum += (int32_t)pIn[n] * (int32_t)*pKer--;
+                }
+            }
+            *pDst++ = sum;
+        }
+    }
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
@@ -0,0 +1,136 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8s_xpulpv2.c
+ * Description:  Valid 2D convolution of 8-bit integer images for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define shufflemask (v4s) { 3, 2, 1, 0 }
+
+/**
+   @ingroup Conv2d
+*/
+
+/**
+   @addtogroup Conv2dKernels
+   @{
+*/
+
+/**
+   @brief      Valid 2D convolution of 8-bit integer images kernel for XPULPV2 extension.
+   @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+   @param[in]  srcRows  number of rows of the input image
+   @param[in]  srcCols  number of columns of the input image
+   @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+   @param[in]  kerRows  number of rows of the filter kernel
+   @param[in]  kerCols  number of columns of the filter kernel
+   @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                        (srcCols - kerCols + 1) elements
+   @return     none
+
+   @par Exploiting SIMD instructions
+   Four neighbouring output pixels are computed at once. Every row of the filter kernel is processed
+   in chunks of 4 elements, which are loaded in reverse order into a SIMD vector. For the last
+   chunk, the remaining 1 to 3 elements are padded with zeros. The vector is multiplied with the
+   input row at four consecutive offsets, using sum-of-dot-product instructions. Since the last
+   chunk is padded, the four outputs read up to (kerCols + 3) / 4 * 4 + 3 input pixels of every row.
+   Outputs for which this would exceed the input row are computed one by one.
+*/
+void plp_conv2d_i8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t kerRows,
+                            uint32_t kerCols,
+                            int32_t *__restrict__ pDst) {
+
+    uint32_t dstRows = srcRows - kerRows + 1;
+    uint32_t dstCols = srcCols - kerCols + 1;
+    uint32_t kerVecs = kerCols / 4; // number of full chunks of a kernel row
+    uint32_t kerLeft = kerCols % 4; // elements of the last, partial chunk
+    uint32_t padCols = (kerVecs + (kerLeft > 0)) * 4;
+    uint32_t i, j, m, n, k;
+
+    for (i = 0; i < dstRows; i++) {
+
+        int32_t *pOut = pDst + i * dstCols;
+
+        for (j = 0; j + padCols + 3 <= srcCols; j += 4) {
+            int32_t acc0 = 0;
+            int32_t acc1 = 0;
+            int32_t acc2 = 0;
+            int32_t acc3 = 0;
+            const int8_t *pKer = pKernel + kerRows * kerCols - 1; // last element of the kernel
+
+            for (m = 0; m < kerRows; m++) {
+                const int8_t *pIn = pSrc + (i + m) * srcCols + j;
+                v4s h;
+
+                for (k = 0; k < kerVecs; k++) {
+                    h = *((v4s *)(pKer - 3));
+                    h = __builtin_shuffle(h, h, shufflemask);
+                    acc0 = __SUMDOTP4(*((v4s *)pIn), h, acc0);
+                    acc1 = __SUMDOTP4(*((v4s *)(pIn + 1)), h, acc1);
+                    acc2 = __SUMDOTP4(*((v4s *)(pIn + 2)), h, acc2);
+                    acc3 = __SUMDOTP4(*((v4s *)(pIn + 3)), h, acc3);
+                    pIn += 4;
+                    pKer -= 4;
+                }
+                if (kerLeft > 0) {
+                    h = __PACK4(pKer[0], (kerLeft > 1) ? pKer[-1] : 0,
+                                (kerLeft > 2) ? pKer[-2] : 0, 0);
+                    acc0 = __SUMDOTP4(*((v4s *)pIn), h, acc0);
+                    acc1 = __SUMDOTP4(*((v4s *)(pIn + 1)), h, acc1);
+                    acc2 = __SUMDOTP4(*((v4s *)(pIn + 2)), h, acc2);
+                    acc3 = __SUMDOTP4(*((v4s *)(pIn + 3)), h, acc3);
+                    pKer -= kerLeft;
+                }
+            }
+
+            pOut[j] = acc0;
+            pOut[j + 1] = acc1;
+            pOut[j + 2] = acc2;
+            pOut[j + 3] = acc3;
+        }
+
+        // remaining outputs at the end of the row
+        for (; j < dstCols; j++) {
+            int32_t sum = 0;
+            const int8_t *pKer = pKernel + kerRows * kerCols - 1;
+            for (m = 0; m < kerRows; m++) {
+                const int8_t *pIn = pSrc + (i + m) * srcCols + j;
+                for (n = 0; n < kerCols; n++) {
+                    sum += (int32_t)pIn[n] * (int32_t)*pKer--;
+                }
+            }
+            pOut[j] = sum;
+        }
+    }
+}
+
+/**
+   @} end of Conv2dKernels group
+*/
@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_rep_i8p_xpulpv2.c
+ * Description:  Parallel 8-bit integer convolution with replicated data for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup BasicConvolution
+*/
+
+/**
+   @addtogroup BasicConvolutionKernels
+   @{
+*/
+
+/**
+   @brief Parallel 8-bit integer convolution with replicated data kernel for XPULPV2 extension.
+   @param[in]  args  pointer to plp_conv_rep_instance_i8 struct initialized by
+                     plp_conv_rep_init_i8, with nPE and pRes set
+   @return     none
+
+   @par
+   The outputs are split into contiguous slices of multiples of 4 samples, one per core. Since
+   the replicated copies are shifted by one element each, every slice starts on the same
+   alignment as the whole vector, and every core runs plp_conv_valid_rep_i8s_xpulpv2 on its
+   slice of the shared buffers. If S->revRes is set, the cores reverse the result afterwards.
+*/
+void plp_conv_rep_i8p_xpulpv2(void *args) {
+
+    plp_conv_rep_instance_i8 *S = (plp_conv_rep_instance_i8 *)args;
+
+    uint32_t nPE = S->nPE;
+    int32_t *pRes = S->pRes;
+    uint32_t core_id = hal_core_id();
+
+    uint32_t resLen = S->srcALen - S->srcBLen + 1;
+    uint32_t blkLen = ((resLen + 4 * nPE - 1) / (4 * nPE)) * 4;
+    uint32_t start = MIN(core_id * blkLen, resLen);
+    uint32_t stop = MIN(start + blkLen, resLen);
+
+    if (stop > start) {
+        plp_conv_valid_rep_i8s_xpulpv2(S->pSrcA + start, stop - start + S->srcBLen - 1,
+                                        S->srcAMem, S->pSrcB, S->srcBLen, pRes + start);
+    }
+
+    if (S->revRes) {
+        hal_team_barrier();
+
+        uint32_t half = resLen >> 1;
+        uint32_t revLen = (half + nPE - 1) / nPE;
+        uint32_t i;
+
+        for (i = MIN(core_id * revLen, half); i < MIN((core_id + 1) * revLen, half); i++) {
+            int32_t tmp = pRes[i];
+            pRes[i] = pRes[resLen - 1 - i];
+            pRes[resLen - 1 - i] = tmp;
+        }
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of BasicConvolutionKernels group
+*/
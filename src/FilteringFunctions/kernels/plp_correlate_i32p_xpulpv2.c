@@ -0,0 +1,97 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_i32p_xpulpv2.c
+ * Description:  Parallel correlation of 32-bit integer vectors for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+#define MAX(x, y) (((x) > (y)) ? (x) : (y))
+
+/**
+   @ingroup BasicCorrelation
+*/
+
+/**
+   @addtogroup BasicCorrelationKernels
+   @{
+*/
+
+/* dot product of len samples, unrolled by two */
+static inline int32_t plp_correlate_dot_i32(const int32_t *pA, const int32_t *pB, int32_t len) {
+    int32_t sum = 0;
+    int32_t i;
+
+    for (i = 0; i + 2 <= len; i += 2) {
+        sum = __MAC(sum, pA[i], pB[i]);
+        sum = __MAC(sum, pA[i + 1], pB[i + 1]);
+    }
+    if (i < len) {
+        sum = __MAC(sum, pA[i], pB[i]);
+    }
+
+    return sum;
+}
+
+/**
+   @brief Parallel correlation of 32-bit integer vectors kernel for XPULPV2 extension.
+
+   Every core computes a contiguous range of the srcALen + srcBLen - 1 outputs,
+   pRes[k] = sum_n pSrcA[n + k - (srcBLen - 1)] pSrcB[n], where n runs over the overlap of both
+   vectors. The result is the same as for plp_correlate_i32.
+
+   @param[in]  task_args  pointer to plp_correlate_instance_i32 struct initialized by
+                          plp_correlate_i32_parallel
+   @return     none
+*/
+void plp_correlate_i32p_xpulpv2(void *task_args) {
+
+    plp_correlate_instance_i32 *S = (plp_correlate_instance_i32 *)task_args;
+
+    const int32_t *pSrcA = S->pSrcA;
+    const int32_t *pSrcB = S->pSrcB;
+    int32_t srcALen = S->srcALen;
+    int32_t srcBLen = S->srcBLen;
+    int32_t *pRes = S->pRes;
+
+    int32_t resLen = srcALen + srcBLen - 1;
+    int32_t chunk = (resLen + S->nPE - 1) / S->nPE;
+    int32_t start = MIN(hal_core_id() * chunk, resLen);
+    int32_t end = MIN(start + chunk, resLen);
+
+    for (int32_t k = start; k < end; k++) {
+        /* pSrcB[n] is aligned with pSrcA[n + lag] for n in [first, last) */
+        int32_t lag = k - (srcBLen - 1);
+        int32_t first = MAX(0, -lag);
+        int32_t last = MIN(srcBLen, srcALen - lag);
+
+        pRes[k] = plp_correlate_dot_i32(pSrcA + (first + lag), pSrcB + first, last - first);
+    }
+}
+
+/**
+   @} end of BasicCorrelationKernels
+*/
@@ -56,7 +56,9 @@ void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
     const int32_t *pSrc1, *pSrc2;
     int32_t src1Len, src2Len;
 
-    if (srcALen > srcBLen) {
+    int32_t inc = 1;
+
+    if (srcALen >= srcBLen) {
         pSrc1 = pSrcA;
         pSrc2 = pSrcB;
         src1Len = srcALen;
@@ -66,6 +68,9 @@ void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
         pSrc1 = pSrcB;
         src2Len = srcALen;
         src1Len = srcBLen;
+        /* the correlation of the swapped vectors is reversed, so it is stored backwards */
+        pRes += srcALen + srcBLen - 2;
+        inc = -1;
     }
 
     int32_t temp = 0;
@@ -77,7 +82,8 @@ void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
         for (int j = 0; j < i; j++) {
             temp += pSrc1[j] * pSrc2[src2Len - i + j];
         }
-        *pRes++ = temp;
+        *pRes = temp;
+        pRes += inc;
         temp = 0;
     }
 
@@ -87,7 +93,8 @@ void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
         for (int j = 0; j < src2Len; j++) {
             temp += pSrc1[j + i] * pSrc2[j];
         }
-        *pRes++ = temp;
+        *pRes = temp;
+        pRes += inc;
         temp = 0;
     }
 
@@ -97,7 +104,8 @@ void plp_correlate_i32s_rv32im(const int32_t *pSrcA,
         for (int j = 0; j < i; j++) {
             temp += pSrc1[offset + src2Len - i + j] * pSrc2[j];
         }
-        *pRes++ = temp;
+        *pRes = temp;
+        pRes += inc;
         temp = 0;
     }
 }
@@ -0,0 +1,195 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_f32s_xpulpv2.c
+ * Description:  FFT-based convolution and correlation of 32-bit floating point vectors for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#include "plp_common_tables.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup FFTConvolution
+*/
+
+/**
+   @defgroup FFTConvolutionKernels FFT Convolution Kernels
+   Computes the convolution and the correlation of two vectors with the overlap-save method.
+*/
+
+/**
+   @addtogroup FFTConvolutionKernels
+   @{
+*/
+
+/*
+ * Both the convolution and the correlation are computed as the convolution y = x * h of the longer
+ * vector x with the shorter vector h, where h is read backwards for the correlation and y is
+ * written backwards if pSrcA is the shorter vector of a correlation:
+ *   corr(A, B) = conv(A, rev(B)) = rev(conv(B, rev(A)))
+ */
+
+static void plp_fftconv_f32_direct(const float32_t *pX,
+                                   uint32_t lenX,
+                                   const float32_t *pH,
+                                   int32_t strideH,
+                                   uint32_t lenH,
+                                   int32_t revOut,
+                                   float32_t *pRes) {
+    uint32_t nOut = lenX + lenH - 1;
+    uint32_t n, i;
+
+    for (n = 0; n < nOut; n++) {
+        float32_t sum = 0.0f;
+        for (i = n >= lenX ? n - lenX + 1 : 0; i <= MIN(n, lenH - 1); i++) {
+            sum += pX[n - i] * pH[strideH * (int32_t)i];
+        }
+        pRes[revOut ? nOut - 1 - n : n] = sum;
+    }
+}
+
+static int plp_fftconv_f32_blocks(const float32_t *pX,
+                                  uint32_t lenX,
+                                  const float32_t *pH,
+                                  int32_t strideH,
+                                  uint32_t lenH,
+                                  int32_t revOut,
+                                  uint32_t L,
+                                  float32_t *pRes) {
+    uint32_t nOut = lenX + lenH - 1;
+    uint32_t step = L - lenH + 1;
+    uint32_t size = (L + 3 * (L + 2)) * sizeof(float32_t);
+    uint32_t start, n, i, k;
+    float32_t *pTw, *pT, *pXf, *pHf;
+
+    pTw = (float32_t *)hal_cl_l1_malloc(size);
+    if (pTw == NULL) {
+        return 0;
+    }
+    pT = pTw + L;
+    pXf = pT + L + 2;
+    pHf = pXf + L + 2;
+
+    // the twiddle factors of length L are every (2048 / L)-th of the table of length 2048
+    for (k = 0; k < L / 2; k++) {
+        pTw[2 * k] = twiddleCoef_rfft_2048[k * (2048 / L)].re;
+        pTw[2 * k + 1] = twiddleCoef_rfft_2048[k * (2048 / L)].im;
+    }
+
+    plp_fft_instance_f32 S = { L, 0, pTw, NULL };
+
+    // spectrum of h, zero-padded to L
+    for (i = 0; i < L; i++) {
+        pT[i] = i < lenH ? pH[strideH * (int32_t)i] : 0.0f;
+    }
+    plp_rfft_f32_xpulpv2(&S, pT, pHf);
+
+    for (start = 0; start < nOut; start += step) {
+        // the block of outputs start .. start + step - 1 needs x[start - lenH + 1 .. start + step]
+        int32_t base = (int32_t)start - (int32_t)(lenH - 1);
+        for (i = 0; i < L; i++) {
+            int32_t idx = base + (int32_t)i;
+            pT[i] = (idx >= 0 && idx < (int32_t)lenX) ? pX[idx] : 0.0f;
+        }
+
+        plp_rfft_f32_xpulpv2(&S, pT, pXf);
+
+        for (k = 0; k <= L / 2; k++) {
+            float32_t xr = pXf[2 * k];
+            float32_t xi = pXf[2 * k + 1];
+            float32_t hr = pHf[2 * k];
+            float32_t hi = pHf[2 * k + 1];
+            pXf[2 * k] = xr * hr - xi * hi;
+            pXf[2 * k + 1] = xr * hi + xi * hr;
+        }
+
+        plp_rifft_f32_xpulpv2(&S, pXf, pT);
+
+        // the first lenH - 1 values are wrapped around
+        for (n = 0; n < MIN(step, nOut - start); n++) {
+            pRes[revOut ? nOut - 1 - start - n : start + n] = pT[lenH - 1 + n];
+        }
+    }
+
+    hal_cl_l1_free(pTw, size);
+
+    return 1;
+}
+
+/**
+   @brief      FFT-based convolution or correlation of 32-bit floating point vectors for XPULPV2.
+   @param[in]  pSrcA      points to the first input vector
+   @param[in]  srcALen    Length of the first input vector
+   @param[in]  pSrcB      points to the second input vector
+   @param[in]  srcBLen    Length of the second input vector
+   @param[in]  corrFlag   0 for the convolution, 1 for the correlation
+   @param[out] pRes       output result returned here, srcALen + srcBLen - 1 values
+   @return     none
+*/
+void plp_fftconv_f32s_xpulpv2(const float32_t *pSrcA,
+                              uint32_t srcALen,
+                              const float32_t *pSrcB,
+                              uint32_t srcBLen,
+                              uint8_t corrFlag,
+                              float32_t *pRes) {
+    const float32_t *pX, *pH;
+    uint32_t lenX, lenH, L;
+    int32_t strideH = 1;
+    int32_t revOut = 0;
+
+    if (srcALen == 0 || srcBLen == 0) {
+        return;
+    }
+
+    if (srcALen >= srcBLen) {
+        pX = pSrcA;
+        lenX = srcALen;
+        pH = pSrcB;
+        lenH = srcBLen;
+    } else {
+        pX = pSrcB;
+        lenX = srcBLen;
+        pH = pSrcA;
+        lenH = srcALen;
+        revOut = corrFlag;
+    }
+
+    if (corrFlag) {
+        pH = pH + lenH - 1;
+        strideH = -1;
+    }
+
+    L = plp_fftconv_block_len(srcALen, srcBLen, PLP_FFTCONV_F32_MAX_LEN);
+
+    if (L == 0 || !plp_fftconv_f32_blocks(pX, lenX, pH, strideH, lenH, revOut, L, pRes)) {
+        plp_fftconv_f32_direct(pX, lenX, pH, strideH, lenH, revOut, pRes);
+    }
+}
+
+/**
+   @} end of FFTConvolutionKernels group
+*/
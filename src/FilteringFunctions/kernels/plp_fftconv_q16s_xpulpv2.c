@@ -0,0 +1,273 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_q16s_xpulpv2.c
+ * Description:  FFT-based convolution and correlation of 16-bit fixed point vectors for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#include "plp_const_structs.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup FFTConvolution
+*/
+
+/**
+   @addtogroup FFTConvolutionKernels
+   @{
+*/
+
+/*
+ * Both the convolution and the correlation are computed as the convolution y = x * h of the longer
+ * vector x with the shorter vector h, where h is read backwards for the correlation and y is
+ * written backwards if pSrcA is the shorter vector of a correlation:
+ *   corr(A, B) = conv(A, rev(B)) = rev(conv(B, rev(A)))
+ */
+
+/*
+ * The blocks are transformed with the 32-bit real FFT (which scales by 1/L) after shifting them
+ * left by sx (x) and sh (h) bits, such that their largest values use 30 bits. The spectral product
+ * is shifted right by s bits, such that the product of the largest components of both spectra
+ * just fits into 32 bits. After the inverse FFT (which scales by 1/L as well), the result is
+ * shifted by e = s - g bits, where g = sx + sh + fracBits - 2 log2(L), to get fracBits fractional
+ * bits. Normalizing every block keeps the errors of the transforms (a few LSBs of the 32-bit
+ * values) below the LSB of the result.
+ */
+
+static const plp_rfft_instance_q32 *plp_fftconv_rfft_q32(uint32_t L) {
+    switch (L) {
+    case 32:
+        return &plp_rfft_sR_q32_len32;
+    case 64:
+        return &plp_rfft_sR_q32_len64;
+    case 128:
+        return &plp_rfft_sR_q32_len128;
+    case 256:
+        return &plp_rfft_sR_q32_len256;
+    case 512:
+        return &plp_rfft_sR_q32_len512;
+    case 1024:
+        return &plp_rfft_sR_q32_len1024;
+    case 2048:
+        return &plp_rfft_sR_q32_len2048;
+    case 4096:
+        return &plp_rfft_sR_q32_len4096;
+    default:
+        return NULL;
+    }
+}
+
+static void plp_fftconv_q16_direct(const int16_t *pX,
+                                   uint32_t lenX,
+                                   const int16_t *pH,
+                                   int32_t strideH,
+                                   uint32_t lenH,
+                                   int32_t revOut,
+                                   uint32_t fracBits,
+                                   int32_t *pRes) {
+    uint32_t nOut = lenX + lenH - 1;
+    uint32_t n, i;
+
+    for (n = 0; n < nOut; n++) {
+        int64_t sum = 0;
+        for (i = n >= lenX ? n - lenX + 1 : 0; i <= MIN(n, lenH - 1); i++) {
+            sum += pX[n - i] * pH[strideH * (int32_t)i];
+        }
+        if (fracBits > 0) {
+            sum = ((sum >> (fracBits - 1)) + 1) >> 1;
+        }
+        pRes[revOut ? nOut - 1 - n : n] = (int32_t)sum;
+    }
+}
+
+static int32_t plp_fftconv_norm_q16(const int16_t *p, int32_t stride, uint32_t len) {
+    uint32_t m = 0;
+    uint32_t i, b;
+
+    for (i = 0; i < len; i++) {
+        int32_t v = p[stride * (int32_t)i];
+        uint32_t a = v < 0 ? -v : v;
+        m = a > m ? a : m;
+    }
+    for (b = 0; (m >> b) != 0; b++)
+        ;
+    return 30 - b;
+}
+
+static int32_t plp_fftconv_max_abs_q32(const int32_t *p, uint32_t len) {
+    uint32_t m = 0;
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        uint32_t a = p[i] < 0 ? -(uint32_t)p[i] : (uint32_t)p[i];
+        m = a > m ? a : m;
+    }
+    return m;
+}
+
+static int plp_fftconv_q16_blocks(const int16_t *pX,
+                                  uint32_t lenX,
+                                  const int16_t *pH,
+                                  int32_t strideH,
+                                  uint32_t lenH,
+                                  int32_t revOut,
+                                  uint32_t fracBits,
+                                  uint32_t L,
+                                  int32_t *pRes) {
+    const plp_rfft_instance_q32 *S = plp_fftconv_rfft_q32(L);
+    uint32_t nOut = lenX + lenH - 1;
+    uint32_t step = L - lenH + 1;
+    uint32_t size = 2 * (L + 2) * sizeof(int32_t);
+    uint32_t start, n, i, k, log2L, maxH;
+    int32_t g, e, shift, sx, sh;
+    uint64_t bound;
+    int32_t *pT, *pHf;
+
+    if (S == NULL) {
+        return 0;
+    }
+
+    pHf = (int32_t *)hal_cl_l1_malloc(size);
+    if (pHf == NULL) {
+        return 0;
+    }
+    pT = pHf + L + 2;
+
+    for (log2L = 0; (1U << log2L) < L; log2L++)
+        ;
+
+    // spectrum of h, zero-padded to L
+    sh = plp_fftconv_norm_q16(pH, strideH, lenH);
+    for (i = 0; i < L; i++) {
+        pHf[i] = i < lenH ? (int32_t)pH[strideH * (int32_t)i] << sh : 0;
+    }
+    plp_rfft_q32s_xpulpv2(S, pHf, pHf);
+    maxH = plp_fftconv_max_abs_q32(pHf, L + 2);
+
+    for (start = 0; start < nOut; start += step) {
+        // the block of outputs start .. start + step - 1 needs x[start - lenH + 1 .. start + step]
+        int32_t base = (int32_t)start - (int32_t)(lenH - 1);
+        int32_t lo = base > 0 ? base : 0;
+        int32_t hi = MIN(base + (int32_t)L, (int32_t)lenX);
+        sx = plp_fftconv_norm_q16(pX + lo, 1, hi - lo);
+        for (i = 0; i < L; i++) {
+            int32_t idx = base + (int32_t)i;
+            pT[i] = (idx >= 0 && idx < (int32_t)lenX) ? (int32_t)pX[idx] << sx : 0;
+        }
+
+        plp_rfft_q32s_xpulpv2(S, pT, pT);
+
+        // |re|, |im| <= 2 max|X| max|H| >> shift must fit into 31 bits, and -e < 32
+        g = sx + sh + (int32_t)fracBits - 2 * (int32_t)log2L;
+        bound = 2 * (uint64_t)plp_fftconv_max_abs_q32(pT, L + 2) * maxH;
+        for (shift = 1; shift < 63 && (bound >> shift) >= 0x80000000ULL; shift++)
+            ;
+        for (; shift > 1 && shift > g - 31 && (bound >> (shift - 1)) < 0x80000000ULL; shift--)
+            ;
+        shift = shift > g - 31 ? shift : g - 31;
+        e = shift - g;
+
+        for (k = 0; k <= L / 2; k++) {
+            int64_t xr = pT[2 * k];
+            int64_t xi = pT[2 * k + 1];
+            int64_t hr = pHf[2 * k];
+            int64_t hi = pHf[2 * k + 1];
+            pT[2 * k] = (int32_t)(((xr * hr >> 1) - (xi * hi >> 1)) >> (shift - 1));
+            pT[2 * k + 1] = (int32_t)(((xr * hi >> 1) + (xi * hr >> 1)) >> (shift - 1));
+        }
+
+        plp_rifft_q32s_xpulpv2(S, pT, pT);
+
+        // the first lenH - 1 values are wrapped around
+        for (n = 0; n < MIN(step, nOut - start); n++) {
+            int32_t y = pT[lenH - 1 + n];
+            y = e >= 0 ? (int32_t)((uint32_t)y << e) : ((y >> (-e - 1)) + 1) >> 1;
+            pRes[revOut ? nOut - 1 - start - n : start + n] = y;
+        }
+    }
+
+    hal_cl_l1_free(pHf, size);
+
+    return 1;
+}
+
+/**
+   @brief      FFT-based convolution or correlation of 16-bit fixed point vectors for XPULPV2.
+   @param[in]  pSrcA      points to the first input vector
+   @param[in]  srcALen    Length of the first input vector
+   @param[in]  pSrcB      points to the second input vector
+   @param[in]  srcBLen    Length of the second input vector
+   @param[in]  corrFlag   0 for the convolution, 1 for the correlation
+   @param[in]  fracBits   number of fractional bits of the result
+   @param[out] pRes       output result returned here, srcALen + srcBLen - 1 values
+   @return     none
+*/
+void plp_fftconv_q16s_xpulpv2(const int16_t *pSrcA,
+                              uint32_t srcALen,
+                              const int16_t *pSrcB,
+                              uint32_t srcBLen,
+                              uint8_t corrFlag,
+                              uint32_t fracBits,
+                              int32_t *pRes) {
+    const int16_t *pX, *pH;
+    uint32_t lenX, lenH, L;
+    int32_t strideH = 1;
+    int32_t revOut = 0;
+
+    if (srcALen == 0 || srcBLen == 0) {
+        return;
+    }
+
+    if (srcALen >= srcBLen) {
+        pX = pSrcA;
+        lenX = srcALen;
+        pH = pSrcB;
+        lenH = srcBLen;
+    } else {
+        pX = pSrcB;
+        lenX = srcBLen;
+        pH = pSrcA;
+        lenH = srcALen;
+        revOut = corrFlag;
+    }
+
+    if (corrFlag) {
+        pH = pH + lenH - 1;
+        strideH = -1;
+    }
+
+    L = plp_fftconv_block_len(srcALen, srcBLen, PLP_FFTCONV_Q16_MAX_LEN);
+
+    if (L == 0 ||
+        !plp_fftconv_q16_blocks(pX, lenX, pH, strideH, lenH, revOut, fracBits, L, pRes)) {
+        plp_fftconv_q16_direct(pX, lenX, pH, strideH, lenH, revOut, fracBits, pRes);
+    }
+}
+
+/**
+   @} end of FFTConvolutionKernels group
+*/
@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_q16p_xpulpv2.c
+ * Description:  Parallel 16-bit fixed point FIR decimation filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup FIRDecimate
+*/
+
+/**
+   @addtogroup FIRDecimateKernels
+   @{
+*/
+
+/* rounds the accumulator to fracBits fractional bits and saturates it to 16 bits */
+static inline int16_t plp_fir_decimate_sat_q16(int32_t acc, uint32_t fracBits) {
+    if (fracBits > 0) {
+        acc = (acc + (1 << (fracBits - 1))) >> fracBits;
+    }
+    if (acc > 32767) {
+        return 32767;
+    } else if (acc < -32768) {
+        return -32768;
+    }
+    return (int16_t)acc;
+}
+
+/*
+ * Computes the outputs start .. end - 1, y[m] = sum_k pCoeffs[k] pState[mM + k]. Two outputs are
+ * computed at once, such that every coefficient pair is loaded once for both of them. The taps are
+ * processed in pairs with __SUMDOTP2; the loads of the delay line are misaligned if mM is odd.
+ */
+static inline void plp_fir_decimate_block_q16(const int16_t *pState,
+                                              const int16_t *pCoeffs,
+                                              uint32_t numTaps,
+                                              uint32_t M,
+                                              uint32_t start,
+                                              uint32_t end,
+                                              uint32_t fracBits,
+                                              int16_t *pDst) {
+    uint32_t nPairs = numTaps >> 1;
+    uint32_t m, k;
+
+    for (m = start; m + 2 <= end; m += 2) {
+        const int16_t *px0 = pState + m * M;
+        const int16_t *px1 = px0 + M;
+        int32_t acc0 = 0, acc1 = 0;
+
+        for (k = 0; k < nPairs; k++) {
+            v2s c = *((v2s *)&pCoeffs[2 * k]);
+            acc0 = __SUMDOTP2(*((v2s *)&px0[2 * k]), c, acc0);
+            acc1 = __SUMDOTP2(*((v2s *)&px1[2 * k]), c, acc1);
+        }
+
+        if (numTaps & 1) {
+            acc0 = __MAC(acc0, px0[numTaps - 1], pCoeffs[numTaps - 1]);
+            acc1 = __MAC(acc1, px1[numTaps - 1], pCoeffs[numTaps - 1]);
+        }
+
+        pDst[m] = plp_fir_decimate_sat_q16(acc0, fracBits);
+        pDst[m + 1] = plp_fir_decimate_sat_q16(acc1, fracBits);
+    }
+
+    if (m < end) {
+        const int16_t *px0 = pState + m * M;
+        int32_t acc0 = 0;
+
+        for (k = 0; k < nPairs; k++) {
+            acc0 = __SUMDOTP2(*((v2s *)&px0[2 * k]), *((v2s *)&pCoeffs[2 * k]), acc0);
+        }
+
+        if (numTaps & 1) {
+            acc0 = __MAC(acc0, px0[numTaps - 1], pCoeffs[numTaps - 1]);
+        }
+
+        pDst[m] = plp_fir_decimate_sat_q16(acc0, fracBits);
+    }
+}
+
+/**
+   @brief      Parallel 16-bit fixed point FIR decimation filter kernel for XPULPV2 extension.
+
+   Every core appends its part of the new samples to the delay line and computes the outputs of
+   the same part. After all cores are done, core 0 moves the last numTaps - 1 samples to the
+   beginning of the delay line. The result is bit-exact to plp_fir_decimate_q16s_xpulpv2.
+
+   @param[in]   args    points to the plp_fir_decimate_instance_q16_parallel
+   @return      none
+*/
+void plp_fir_decimate_q16p_xpulpv2(void *args) {
+    plp_fir_decimate_instance_q16_parallel *a = (plp_fir_decimate_instance_q16_parallel *)args;
+    const plp_fir_decimate_instance_q16 *S = a->S;
+    const int16_t *pSrc = a->pSrc;
+    int16_t *pDst = a->pDst;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t M = S->M;
+    uint32_t numTaps = S->numTaps;
+    int16_t *pState = S->pState;
+
+    int core_id = hal_core_id();
+    uint32_t i;
+
+    /* the outputs are split among the cores, and the input samples accordingly */
+    uint32_t nOut = blockSize / M;
+    uint32_t chunk = (nOut + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * chunk, nOut);
+    uint32_t end = MIN(start + chunk, nOut);
+
+    for (i = start * M; i < end * M; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    hal_team_barrier();
+
+    plp_fir_decimate_block_q16(pState, S->pCoeffs, numTaps, M, start, end, S->fracBits, pDst);
+
+    hal_team_barrier();
+
+    if (core_id == 0) {
+        for (i = 0; i < numTaps - 1; i++) {
+            pState[i] = pState[blockSize + i];
+        }
+    }
+}
+
+/**
+   @} end of FIRDecimateKernels group
+*/
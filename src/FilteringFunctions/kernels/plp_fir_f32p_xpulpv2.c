@@ -0,0 +1,132 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_f32p_xpulpv2.c
+ * Description:  Parallel FIR filter of 32-bit floating point vectors for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/*
+ * Computes the outputs start .. end - 1, y[n] = sum_k pCoeffs[k] pState[n + k]. Four outputs are
+ * computed at once, such that every coefficient is loaded once per four outputs.
+ */
+static inline void plp_fir_block_f32(const float32_t *pState,
+                                     const float32_t *pCoeffs,
+                                     uint32_t numTaps,
+                                     uint32_t start,
+                                     uint32_t end,
+                                     float32_t *pDst) {
+    uint32_t n, k;
+
+    for (n = start; n + 4 <= end; n += 4) {
+        const float32_t *px = pState + n;
+        float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+        float32_t x0 = px[0], x1 = px[1], x2 = px[2];
+
+        for (k = 0; k < numTaps; k++) {
+            float32_t c = pCoeffs[k];
+            float32_t x3 = px[k + 3];
+            acc0 += x0 * c;
+            acc1 += x1 * c;
+            acc2 += x2 * c;
+            acc3 += x3 * c;
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+        }
+
+        pDst[n] = acc0;
+        pDst[n + 1] = acc1;
+        pDst[n + 2] = acc2;
+        pDst[n + 3] = acc3;
+    }
+
+    for (; n < end; n++) {
+        float32_t sum = 0.0f;
+        for (k = 0; k < numTaps; k++) {
+            sum += pState[n + k] * pCoeffs[k];
+        }
+        pDst[n] = sum;
+    }
+}
+
+/**
+   @brief      Parallel FIR filter of 32-bit floating point vectors kernel for XPULPV2 extension.
+
+   Every core appends its part of the new samples to the delay line and computes the same part of
+   the outputs. After all cores are done, core 0 moves the last numTaps - 1 samples to the
+   beginning of the delay line. The result is bit-exact to plp_fir_f32s_xpulpv2.
+
+   @param[in]   args    points to the plp_fir_instance_f32_parallel
+   @return      none
+*/
+void plp_fir_f32p_xpulpv2(void *args) {
+    plp_fir_instance_f32_parallel *a = (plp_fir_instance_f32_parallel *)args;
+    const plp_fir_instance_f32 *S = a->S;
+    const float32_t *pSrc = a->pSrc;
+    float32_t *pDst = a->pDst;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t numTaps = S->numTaps;
+    float32_t *pState = S->pState;
+
+    int core_id = hal_core_id();
+    uint32_t i;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * chunk, blockSize);
+    uint32_t end = MIN(start + chunk, blockSize);
+
+    for (i = start; i < end; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    hal_team_barrier();
+
+    plp_fir_block_f32(pState, S->pCoeffs, numTaps, start, end, pDst);
+
+    hal_team_barrier();
+
+    if (core_id == 0) {
+        for (i = 0; i < numTaps - 1; i++) {
+            pState[i] = pState[blockSize + i];
+        }
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
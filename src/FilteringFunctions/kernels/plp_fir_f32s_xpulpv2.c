@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_f32s_xpulpv2.c
+ * Description:  FIR filter of 32-bit floating point vectors for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/*
+ * Computes the outputs start .. end - 1, y[n] = sum_k pCoeffs[k] pState[n + k]. Four outputs are
+ * computed at once, such that every coefficient is loaded once per four outputs.
+ */
+static inline void plp_fir_block_f32(const float32_t *pState,
+                                     const float32_t *pCoeffs,
+                                     uint32_t numTaps,
+                                     uint32_t start,
+                                     uint32_t end,
+                                     float32_t *pDst) {
+    uint32_t n, k;
+
+    for (n = start; n + 4 <= end; n += 4) {
+        const float32_t *px = pState + n;
+        float32_t acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+        float32_t x0 = px[0], x1 = px[1], x2 = px[2];
+
+        for (k = 0; k < numTaps; k++) {
+            float32_t c = pCoeffs[k];
+            float32_t x3 = px[k + 3];
+            acc0 += x0 * c;
+            acc1 += x1 * c;
+            acc2 += x2 * c;
+            acc3 += x3 * c;
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+        }
+
+        pDst[n] = acc0;
+        pDst[n + 1] = acc1;
+        pDst[n + 2] = acc2;
+        pDst[n + 3] = acc3;
+    }
+
+    for (; n < end; n++) {
+        float32_t sum = 0.0f;
+        for (k = 0; k < numTaps; k++) {
+            sum += pState[n + k] * pCoeffs[k];
+        }
+        pDst[n] = sum;
+    }
+}
+
+/**
+   @brief      FIR filter of 32-bit floating point vectors kernel for XPULPV2 extension.
+
+   The new samples are appended to the delay line, the outputs are computed, and the last
+   numTaps - 1 samples are moved to the beginning of the delay line for the next call.
+
+   @param[in]   S          points to an instance of the 32-bit floating point FIR filter structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+*/
+void plp_fir_f32s_xpulpv2(const plp_fir_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pDst) {
+    uint32_t numTaps = S->numTaps;
+    float32_t *pState = S->pState;
+    uint32_t i;
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    plp_fir_block_f32(pState, S->pCoeffs, numTaps, 0, blockSize, pDst);
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
@@ -0,0 +1,149 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_i16p_xpulpv2.c
+ * Description:  Parallel FIR filter of 16-bit integer vectors for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+#define shufflemask1                                                                               \
+    (v2s) { 1, 2 }
+
+/*
+ * Computes the outputs start .. end - 1, y[n] = sum_k pCoeffs[k] pState[n + k]. Four outputs are
+ * computed at once, with two taps per __SUMDOTP2. The delay line is loaded in aligned words (if
+ * start is even) and the odd windows are built with shuffles. The last one or two taps are
+ * computed separately, such that no sample beyond pState[end + numTaps - 2] is read.
+ */
+static inline void plp_fir_block_i16(const int16_t *pState,
+                                     const int16_t *pCoeffs,
+                                     uint32_t numTaps,
+                                     uint32_t start,
+                                     uint32_t end,
+                                     int32_t *pDst) {
+    uint32_t nPairs = (numTaps - 1) >> 1;
+    uint32_t n, k;
+
+    for (n = start; n + 4 <= end; n += 4) {
+        const int16_t *px = pState + n;
+        int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        v2s x0 = *((v2s *)px);
+
+        for (k = 0; k < nPairs; k++) {
+            v2s c = *((v2s *)&pCoeffs[2 * k]);
+            v2s x2 = *((v2s *)(px + 2));
+            v2s x4 = *((v2s *)(px + 4));
+            v2s x1 = __builtin_shuffle(x0, x2, shufflemask1);
+            v2s x3 = __builtin_shuffle(x2, x4, shufflemask1);
+            acc0 = __SUMDOTP2(x0, c, acc0);
+            acc1 = __SUMDOTP2(x1, c, acc1);
+            acc2 = __SUMDOTP2(x2, c, acc2);
+            acc3 = __SUMDOTP2(x3, c, acc3);
+            x0 = x2;
+            px += 2;
+        }
+
+        for (k = 2 * nPairs; k < numTaps; k++) {
+            int32_t c = pCoeffs[k];
+            acc0 = __MAC(acc0, pState[n + k], c);
+            acc1 = __MAC(acc1, pState[n + k + 1], c);
+            acc2 = __MAC(acc2, pState[n + k + 2], c);
+            acc3 = __MAC(acc3, pState[n + k + 3], c);
+        }
+
+        pDst[n] = acc0;
+        pDst[n + 1] = acc1;
+        pDst[n + 2] = acc2;
+        pDst[n + 3] = acc3;
+    }
+
+    for (; n < end; n++) {
+        int32_t sum = 0;
+        for (k = 0; k < numTaps; k++) {
+            sum = __MAC(sum, pState[n + k], pCoeffs[k]);
+        }
+        pDst[n] = sum;
+    }
+}
+
+/**
+   @brief      Parallel FIR filter of 16-bit integer vectors kernel for XPULPV2 extension.
+
+   Every core appends its part of the new samples to the delay line and computes the same part of
+   the outputs. After all cores are done, core 0 moves the last numTaps - 1 samples to the
+   beginning of the delay line. The result is bit-exact to plp_fir_i16s_xpulpv2.
+
+   @param[in]   args    points to the plp_fir_instance_i16_parallel
+   @return      none
+*/
+void plp_fir_i16p_xpulpv2(void *args) {
+    plp_fir_instance_i16_parallel *a = (plp_fir_instance_i16_parallel *)args;
+    const plp_fir_instance_i16 *S = a->S;
+    const int16_t *pSrc = a->pSrc;
+    int32_t *pDst = a->pDst;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t numTaps = S->numTaps;
+    int16_t *pState = S->pState;
+
+    int core_id = hal_core_id();
+    uint32_t i;
+
+    /* every core computes a chunk of a multiple of 4 outputs, such that its loads stay aligned */
+    uint32_t chunk = (((blockSize + nPE - 1) / nPE) + 3) & ~3U;
+    uint32_t start = MIN(core_id * chunk, blockSize);
+    uint32_t end = MIN(start + chunk, blockSize);
+
+    for (i = start; i < end; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    hal_team_barrier();
+
+    plp_fir_block_i16(pState, S->pCoeffs, numTaps, start, end, pDst);
+
+    hal_team_barrier();
+
+    if (core_id == 0) {
+        for (i = 0; i < numTaps - 1; i++) {
+            pState[i] = pState[blockSize + i];
+        }
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
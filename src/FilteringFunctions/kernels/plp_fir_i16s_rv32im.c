@@ -0,0 +1,93 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_i16s_rv32im.c
+ * Description:  FIR filter of 16-bit integer vectors for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/* Computes the outputs start .. end - 1, y[n] = sum_k pCoeffs[k] pState[n + k]. */
+static inline void plp_fir_block_i16(const int16_t *pState,
+                                     const int16_t *pCoeffs,
+                                     uint32_t numTaps,
+                                     uint32_t start,
+                                     uint32_t end,
+                                     int32_t *pDst) {
+    uint32_t n, k;
+
+    for (n = start; n < end; n++) {
+        int32_t sum = 0;
+        for (k = 0; k < numTaps; k++) {
+            sum += pState[n + k] * pCoeffs[k];
+        }
+        pDst[n] = sum;
+    }
+}
+
+/**
+   @brief      FIR filter of 16-bit integer vectors kernel for RV32IM extension.
+
+   The new samples are appended to the delay line, the outputs are computed, and the last
+   numTaps - 1 samples are moved to the beginning of the delay line for the next call.
+
+   @param[in]   S          points to an instance of the 16-bit integer FIR filter structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+*/
+void plp_fir_i16s_rv32im(const plp_fir_instance_i16 *S,
+                         const int16_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         int32_t *__restrict__ pDst) {
+    uint32_t numTaps = S->numTaps;
+    int16_t *pState = S->pState;
+    uint32_t i;
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    plp_fir_block_i16(pState, S->pCoeffs, numTaps, 0, blockSize, pDst);
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
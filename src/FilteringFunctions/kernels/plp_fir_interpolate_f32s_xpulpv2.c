@@ -0,0 +1,122 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_f32s_xpulpv2.c
+ * Description:  32-bit floating point FIR interpolation filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIRInterpolate
+*/
+
+/**
+   @addtogroup FIRInterpolateKernels
+   @{
+*/
+
+/*
+ * Computes the outputs of the inputs start .. end - 1,
+ * y[nL + j] = sum_i pCoeffs[L - 1 - j + iL] pState[n + i].
+ * The same phase of two consecutive inputs is computed at once, such that every coefficient is
+ * loaded once for both outputs.
+ */
+static inline void plp_fir_interpolate_block_f32(const float32_t *pState,
+                                                 const float32_t *pCoeffs,
+                                                 uint32_t L,
+                                                 uint32_t phaseLength,
+                                                 uint32_t start,
+                                                 uint32_t end,
+                                                 float32_t *pDst) {
+    uint32_t n, j, i;
+
+    for (n = start; n + 2 <= end; n += 2) {
+        const float32_t *px = pState + n;
+        for (j = 0; j < L; j++) {
+            const float32_t *pc = pCoeffs + (L - 1 - j);
+            float32_t acc0 = 0.0f, acc1 = 0.0f;
+            float32_t x0 = px[0];
+            for (i = 0; i < phaseLength; i++) {
+                float32_t c = pc[i * L];
+                float32_t x1 = px[i + 1];
+                acc0 += x0 * c;
+                acc1 += x1 * c;
+                x0 = x1;
+            }
+            pDst[n * L + j] = acc0;
+            pDst[(n + 1) * L + j] = acc1;
+        }
+    }
+
+    if (n < end) {
+        const float32_t *px = pState + n;
+        for (j = 0; j < L; j++) {
+            const float32_t *pc = pCoeffs + (L - 1 - j);
+            float32_t acc0 = 0.0f;
+            for (i = 0; i < phaseLength; i++) {
+                acc0 += px[i] * pc[i * L];
+            }
+            pDst[n * L + j] = acc0;
+        }
+    }
+}
+
+/**
+   @brief      32-bit floating point FIR interpolation filter kernel for XPULPV2 extension.
+
+   The new samples are appended to the delay line, the outputs are computed, and the last
+   phaseLength - 1 samples are moved to the beginning of the delay line for the next call.
+
+   @param[in]   S          points to an instance of the FIR interpolation structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of input samples to process
+   @param[out]  pDst       points to the block of blockSize * S->L output samples
+   @return      none
+*/
+void plp_fir_interpolate_f32s_xpulpv2(const plp_fir_interpolate_instance_f32 *S,
+                                      const float32_t *__restrict__ pSrc,
+                                      uint32_t blockSize,
+                                      float32_t *__restrict__ pDst) {
+    uint32_t L = S->L;
+    uint32_t phaseLength = S->phaseLength;
+    float32_t *pState = S->pState;
+    uint32_t i;
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[phaseLength - 1 + i] = pSrc[i];
+    }
+
+    plp_fir_interpolate_block_f32(pState, S->pCoeffs, L, phaseLength, 0, blockSize, pDst);
+
+    /* keep the last phaseLength - 1 samples for the next block */
+    for (i = 0; i < phaseLength - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRInterpolateKernels group
+*/
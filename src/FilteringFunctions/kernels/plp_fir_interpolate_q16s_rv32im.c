@@ -0,0 +1,122 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q16s_rv32im.c
+ * Description:  16-bit fixed point FIR interpolation filter for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIRInterpolate
+*/
+
+/**
+   @defgroup FIRInterpolateKernels FIR Interpolation Kernels
+   This module contains the kernel code for the stateful FIR interpolation filters.
+*/
+
+/**
+   @addtogroup FIRInterpolateKernels
+   @{
+*/
+
+/* rounds the accumulator to fracBits fractional bits and saturates it to 16 bits */
+static inline int16_t plp_fir_interpolate_sat_q16(int32_t acc, uint32_t fracBits) {
+    if (fracBits > 0) {
+        acc = (acc + (1 << (fracBits - 1))) >> fracBits;
+    }
+    if (acc > 32767) {
+        return 32767;
+    } else if (acc < -32768) {
+        return -32768;
+    }
+    return (int16_t)acc;
+}
+
+/*
+ * Computes the outputs of the inputs start .. end - 1,
+ * y[nL + j] = sum_i pCoeffs[L - 1 - j + iL] pState[n + i].
+ */
+static inline void plp_fir_interpolate_block_q16(const int16_t *pState,
+                                                 const int16_t *pCoeffs,
+                                                 uint32_t L,
+                                                 uint32_t phaseLength,
+                                                 uint32_t start,
+                                                 uint32_t end,
+                                                 uint32_t fracBits,
+                                                 int16_t *pDst) {
+    uint32_t n, j, i;
+
+    for (n = start; n < end; n++) {
+        const int16_t *px = pState + n;
+        for (j = 0; j < L; j++) {
+            const int16_t *pc = pCoeffs + (L - 1 - j);
+            int32_t sum = 0;
+            for (i = 0; i < phaseLength; i++) {
+                sum += px[i] * pc[i * L];
+            }
+            pDst[n * L + j] = plp_fir_interpolate_sat_q16(sum, fracBits);
+        }
+    }
+}
+
+/**
+   @brief      16-bit fixed point FIR interpolation filter kernel for RV32IM extension.
+
+   The new samples are appended to the delay line, the outputs are computed, and the last
+   phaseLength - 1 samples are moved to the beginning of the delay line for the next call.
+
+   @param[in]   S          points to an instance of the FIR interpolation structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of input samples to process
+   @param[out]  pDst       points to the block of blockSize * S->L output samples
+   @return      none
+*/
+void plp_fir_interpolate_q16s_rv32im(const plp_fir_interpolate_instance_q16 *S,
+                                     const int16_t *__restrict__ pSrc,
+                                     uint32_t blockSize,
+                                     int16_t *__restrict__ pDst) {
+    uint32_t L = S->L;
+    uint32_t phaseLength = S->phaseLength;
+    int16_t *pState = S->pState;
+    uint32_t i;
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[phaseLength - 1 + i] = pSrc[i];
+    }
+
+    plp_fir_interpolate_block_q16(pState, S->pCoeffs, L, phaseLength, 0, blockSize,
+        S->fracBits, pDst);
+
+    /* keep the last phaseLength - 1 samples for the next block */
+    for (i = 0; i < phaseLength - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRInterpolateKernels group
+*/
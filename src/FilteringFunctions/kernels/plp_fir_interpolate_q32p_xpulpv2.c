@@ -0,0 +1,151 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed point FIR interpolation filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup FIRInterpolate
+*/
+
+/**
+   @addtogroup FIRInterpolateKernels
+   @{
+*/
+
+/* rounds the accumulator to fracBits fractional bits and saturates it to 32 bits */
+static inline int32_t plp_fir_interpolate_sat_q32(int64_t acc, uint32_t fracBits) {
+    if (fracBits > 0) {
+        acc = (acc + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    if (acc > INT32_MAX) {
+        return INT32_MAX;
+    } else if (acc < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)acc;
+}
+
+/*
+ * Computes the outputs of the inputs start .. end - 1,
+ * y[nL + j] = sum_i pCoeffs[L - 1 - j + iL] pState[n + i].
+ * The same phase of two consecutive inputs is computed at once, such that every coefficient is
+ * loaded once for both outputs.
+ */
+static inline void plp_fir_interpolate_block_q32(const int32_t *pState,
+                                                 const int32_t *pCoeffs,
+                                                 uint32_t L,
+                                                 uint32_t phaseLength,
+                                                 uint32_t start,
+                                                 uint32_t end,
+                                                 uint32_t fracBits,
+                                                 int32_t *pDst) {
+    uint32_t n, j, i;
+
+    for (n = start; n + 2 <= end; n += 2) {
+        const int32_t *px = pState + n;
+        for (j = 0; j < L; j++) {
+            const int32_t *pc = pCoeffs + (L - 1 - j);
+            int64_t acc0 = 0, acc1 = 0;
+            int32_t x0 = px[0];
+            for (i = 0; i < phaseLength; i++) {
+                int32_t c = pc[i * L];
+                int32_t x1 = px[i + 1];
+                acc0 += (int64_t)x0 * c;
+                acc1 += (int64_t)x1 * c;
+                x0 = x1;
+            }
+            pDst[n * L + j] = plp_fir_interpolate_sat_q32(acc0, fracBits);
+            pDst[(n + 1) * L + j] = plp_fir_interpolate_sat_q32(acc1, fracBits);
+        }
+    }
+
+    if (n < end) {
+        const int32_t *px = pState + n;
+        for (j = 0; j < L; j++) {
+            const int32_t *pc = pCoeffs + (L - 1 - j);
+            int64_t acc0 = 0;
+            for (i = 0; i < phaseLength; i++) {
+                acc0 += (int64_t)px[i] * pc[i * L];
+            }
+            pDst[n * L + j] = plp_fir_interpolate_sat_q32(acc0, fracBits);
+        }
+    }
+}
+
+/**
+   @brief      Parallel 32-bit fixed point FIR interpolation filter kernel for XPULPV2 extension.
+
+   Every core appends its part of the new samples to the delay line and computes the outputs of
+   the same part. After all cores are done, core 0 moves the last phaseLength - 1 samples to the
+   beginning of the delay line. The result is bit-exact to plp_fir_interpolate_q32s_xpulpv2.
+
+   @param[in]   args    points to the plp_fir_interpolate_instance_q32_parallel
+   @return      none
+*/
+void plp_fir_interpolate_q32p_xpulpv2(void *args) {
+    plp_fir_interpolate_instance_q32_parallel *a =
+        (plp_fir_interpolate_instance_q32_parallel *)args;
+    const plp_fir_interpolate_instance_q32 *S = a->S;
+    const int32_t *pSrc = a->pSrc;
+    int32_t *pDst = a->pDst;
+    uint32_t blockSize = a->blockSize;
+    uint32_t nPE = a->nPE;
+    uint32_t L = S->L;
+    uint32_t phaseLength = S->phaseLength;
+    int32_t *pState = S->pState;
+
+    int core_id = hal_core_id();
+    uint32_t i;
+
+    uint32_t chunk = (blockSize + nPE - 1) / nPE;
+    uint32_t start = MIN(core_id * chunk, blockSize);
+    uint32_t end = MIN(start + chunk, blockSize);
+
+    for (i = start; i < end; i++) {
+        pState[phaseLength - 1 + i] = pSrc[i];
+    }
+
+    hal_team_barrier();
+
+    plp_fir_interpolate_block_q32(pState, S->pCoeffs, L, phaseLength, start, end,
+        S->fracBits, pDst);
+
+    hal_team_barrier();
+
+    if (core_id == 0) {
+        for (i = 0; i < phaseLength - 1; i++) {
+            pState[i] = pState[blockSize + i];
+        }
+    }
+}
+
+/**
+   @} end of FIRInterpolateKernels group
+*/
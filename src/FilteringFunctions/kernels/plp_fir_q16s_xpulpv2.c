@@ -0,0 +1,141 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q16s_xpulpv2.c
+ * Description:  FIR filter of 16-bit fixed point vectors for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+#define shufflemask1                                                                               \
+    (v2s) { 1, 2 }
+
+/*
+ * Computes the outputs start .. end - 1, y[n] = sum_k pCoeffs[k] pState[n + k]. Four outputs are
+ * computed at once, with two taps per __SUMDOTP2. The delay line is loaded in aligned words (if
+ * start is even) and the odd windows are built with shuffles. The last one or two taps are
+ * computed separately, such that no sample beyond pState[end + numTaps - 2] is read.
+ */
+static inline void plp_fir_block_q16(const int16_t *pState,
+                                     const int16_t *pCoeffs,
+                                     uint32_t numTaps,
+                                     uint32_t start,
+                                     uint32_t end,
+                                     uint32_t fracBits,
+                                     int16_t *pDst) {
+    uint32_t nPairs = (numTaps - 1) >> 1;
+    uint32_t n, k;
+
+    for (n = start; n + 4 <= end; n += 4) {
+        const int16_t *px = pState + n;
+        int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        v2s x0 = *((v2s *)px);
+
+        for (k = 0; k < nPairs; k++) {
+            v2s c = *((v2s *)&pCoeffs[2 * k]);
+            v2s x2 = *((v2s *)(px + 2));
+            v2s x4 = *((v2s *)(px + 4));
+            v2s x1 = __builtin_shuffle(x0, x2, shufflemask1);
+            v2s x3 = __builtin_shuffle(x2, x4, shufflemask1);
+            acc0 = __SUMDOTP2(x0, c, acc0);
+            acc1 = __SUMDOTP2(x1, c, acc1);
+            acc2 = __SUMDOTP2(x2, c, acc2);
+            acc3 = __SUMDOTP2(x3, c, acc3);
+            x0 = x2;
+            px += 2;
+        }
+
+        for (k = 2 * nPairs; k < numTaps; k++) {
+            int32_t c = pCoeffs[k];
+            acc0 = __MAC(acc0, pState[n + k], c);
+            acc1 = __MAC(acc1, pState[n + k + 1], c);
+            acc2 = __MAC(acc2, pState[n + k + 2], c);
+            acc3 = __MAC(acc3, pState[n + k + 3], c);
+        }
+
+        pDst[n] = __CLIP(__ROUNDNORM_REG(acc0, fracBits), 15);
+        pDst[n + 1] = __CLIP(__ROUNDNORM_REG(acc1, fracBits), 15);
+        pDst[n + 2] = __CLIP(__ROUNDNORM_REG(acc2, fracBits), 15);
+        pDst[n + 3] = __CLIP(__ROUNDNORM_REG(acc3, fracBits), 15);
+    }
+
+    for (; n < end; n++) {
+        int32_t sum = 0;
+        for (k = 0; k < numTaps; k++) {
+            sum = __MAC(sum, pState[n + k], pCoeffs[k]);
+        }
+        pDst[n] = __CLIP(__ROUNDNORM_REG(sum, fracBits), 15);
+    }
+}
+
+/**
+   @brief      FIR filter of 16-bit fixed point vectors kernel for XPULPV2 extension.
+
+   The new samples are appended to the delay line, the outputs are computed, and the last
+   numTaps - 1 samples are moved to the beginning of the delay line for the next call.
+
+   @param[in]   S          points to an instance of the 16-bit fixed point FIR filter structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+
+   @par Exploiting SIMD instructions
+   The 16 bit samples and coefficients are packed into 32 bit vectors, and four outputs are
+   accumulated at once with __SUMDOTP2. Word-aligned state and coefficient buffers avoid
+   misaligned loads.
+*/
+void plp_fir_q16s_xpulpv2(const plp_fir_instance_q16 *S,
+                          const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int16_t *__restrict__ pDst) {
+    uint32_t numTaps = S->numTaps;
+    int16_t *pState = S->pState;
+    uint32_t i;
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    plp_fir_block_q16(pState, S->pCoeffs, numTaps, 0, blockSize, S->fracBits, pDst);
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
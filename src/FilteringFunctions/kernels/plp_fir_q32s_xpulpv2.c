@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_q32s_xpulpv2.c
+ * Description:  FIR filter of 32-bit fixed point vectors for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup FIR
+*/
+
+/**
+   @addtogroup FIRKernels
+   @{
+*/
+
+/* rounds the 64-bit accumulator to fracBits fractional bits and saturates it to 32 bits */
+static inline int32_t plp_fir_sat_q32(int64_t acc, uint32_t fracBits) {
+    if (fracBits > 0) {
+        acc = (acc + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    if (acc > INT32_MAX) {
+        return INT32_MAX;
+    } else if (acc < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)acc;
+}
+
+/*
+ * Computes the outputs start .. end - 1, y[n] = sum_k pCoeffs[k] pState[n + k], with 64-bit
+ * accumulators. Four outputs are computed at once, such that every coefficient is loaded once per
+ * four outputs.
+ */
+static inline void plp_fir_block_q32(const int32_t *pState,
+                                     const int32_t *pCoeffs,
+                                     uint32_t numTaps,
+                                     uint32_t start,
+                                     uint32_t end,
+                                     uint32_t fracBits,
+                                     int32_t *pDst) {
+    uint32_t n, k;
+
+    for (n = start; n + 4 <= end; n += 4) {
+        const int32_t *px = pState + n;
+        int64_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        int32_t x0 = px[0], x1 = px[1], x2 = px[2];
+
+        for (k = 0; k < numTaps; k++) {
+            int32_t c = pCoeffs[k];
+            int32_t x3 = px[k + 3];
+            acc0 += (int64_t)x0 * c;
+            acc1 += (int64_t)x1 * c;
+            acc2 += (int64_t)x2 * c;
+            acc3 += (int64_t)x3 * c;
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+        }
+
+        pDst[n] = plp_fir_sat_q32(acc0, fracBits);
+        pDst[n + 1] = plp_fir_sat_q32(acc1, fracBits);
+        pDst[n + 2] = plp_fir_sat_q32(acc2, fracBits);
+        pDst[n + 3] = plp_fir_sat_q32(acc3, fracBits);
+    }
+
+    for (; n < end; n++) {
+        int64_t sum = 0;
+        for (k = 0; k < numTaps; k++) {
+            sum += (int64_t)pState[n + k] * pCoeffs[k];
+        }
+        pDst[n] = plp_fir_sat_q32(sum, fracBits);
+    }
+}
+
+/**
+   @brief      FIR filter of 32-bit fixed point vectors kernel for XPULPV2 extension.
+
+   The new samples are appended to the delay line, the outputs are computed, and the last
+   numTaps - 1 samples are moved to the beginning of the delay line for the next call.
+
+   @param[in]   S          points to an instance of the 32-bit fixed point FIR filter structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+*/
+void plp_fir_q32s_xpulpv2(const plp_fir_instance_q32 *S,
+                          const int32_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          int32_t *__restrict__ pDst) {
+    uint32_t numTaps = S->numTaps;
+    int32_t *pState = S->pState;
+    uint32_t i;
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    plp_fir_block_q32(pState, S->pCoeffs, numTaps, 0, blockSize, S->fracBits, pDst);
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of FIRKernels group
+*/
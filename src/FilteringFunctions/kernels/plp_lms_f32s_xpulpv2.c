@@ -0,0 +1,120 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_f32s_xpulpv2.c
+ * Description:  32-bit floating point LMS filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LMS
+*/
+
+/**
+   @addtogroup LMSKernels
+   @{
+*/
+
+/**
+   @brief      32-bit floating point LMS filter kernel for XPULPV2 extension.
+
+   The output of the first sample is computed with the current coefficients. After that, the
+   coefficient update of every sample and the output of the next sample are computed in one pass.
+
+   @param[in]   S          points to an instance of the LMS structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   pRef       points to the block of reference (desired) samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pOut       points to the block of filter outputs
+   @param[out]  pErr       points to the block of errors, pRef - pOut
+   @return      none
+*/
+void plp_lms_f32s_xpulpv2(plp_lms_instance_f32 *S,
+                          const float32_t *__restrict__ pSrc,
+                          const float32_t *__restrict__ pRef,
+                          uint32_t blockSize,
+                          float32_t *__restrict__ pOut,
+                          float32_t *__restrict__ pErr) {
+    uint32_t numTaps = S->numTaps;
+    float32_t *pState = S->pState;
+    float32_t *pCoeffs = S->pCoeffs;
+    float32_t mu = S->mu;
+    float32_t acc = 0.0f;
+    uint32_t i, n, k;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    /* output of the first sample */
+    for (k = 0; k < numTaps; k++) {
+        acc += pCoeffs[k] * pState[k];
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const float32_t *px = pState + n;
+        float32_t y = acc;
+        float32_t e = pRef[n] - y;
+
+        pOut[n] = y;
+        pErr[n] = e;
+
+        /* step of the coefficient update */
+        float32_t alpha = mu * e;
+
+        acc = 0.0f;
+        if (n + 1 < blockSize) {
+            /* update the coefficients with the current samples and filter the next samples in
+               the same pass, such that every coefficient and sample is loaded only once */
+            float32_t xk = px[0];
+            for (k = 0; k < numTaps; k++) {
+                float32_t xn = px[k + 1];
+                float32_t c = pCoeffs[k] + alpha * xk;
+                pCoeffs[k] = c;
+                acc += c * xn;
+                xk = xn;
+            }
+        } else {
+            /* last sample of the block, only update the coefficients */
+            for (k = 0; k < numTaps; k++) {
+                pCoeffs[k] = pCoeffs[k] + alpha * px[k];
+            }
+        }
+    }
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of LMSKernels group
+*/
@@ -0,0 +1,167 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_q16s_rv32im.c
+ * Description:  16-bit fixed point normalized LMS filter for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LMSNorm
+*/
+
+/**
+   @defgroup LMSNormKernels NLMS Filter Kernels
+   This module contains the kernel code for the normalized LMS filters.
+*/
+
+/**
+   @addtogroup LMSNormKernels
+   @{
+*/
+
+/* rounds x to fracBits fractional bits */
+static inline int32_t plp_lms_norm_round_q16(int32_t x, uint32_t fracBits) {
+    if (fracBits > 0) {
+        x = (x + (1 << (fracBits - 1))) >> fracBits;
+    }
+    return x;
+}
+
+/* saturates x to 16 bits */
+static inline int32_t plp_lms_norm_sat_q16(int32_t x) {
+    if (x > 32767) {
+        return 32767;
+    } else if (x < -32768) {
+        return -32768;
+    }
+    return x;
+}
+
+/* coefficient update c + alpha x, rounded and saturated */
+static inline int32_t plp_lms_norm_update_q16(int32_t c,
+                                              int32_t alpha,
+                                              int32_t x,
+                                              uint32_t fracBits) {
+    return plp_lms_norm_sat_q16(c + plp_lms_norm_round_q16(alpha * x, fracBits));
+}
+
+/**
+   @brief      16-bit fixed point normalized LMS filter kernel for RV32IM extension.
+
+   The output of the first sample is computed with the current coefficients. After that, the
+   coefficient update of every sample and the output of the next sample are computed in one pass.
+
+   The output is accumulated in 32 bits, then rounded and saturated to 16 bits. The
+   coefficient updates are rounded and saturated as well.
+
+   The step size is mu / (E + 2^-fracBits), where E is the energy of the delay line, computed with
+   fracBits fractional bits. Its product with the error is saturated to 16 bits.
+
+   @param[in]   S          points to an instance of the normalized LMS structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   pRef       points to the block of reference (desired) samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pOut       points to the block of filter outputs
+   @param[out]  pErr       points to the block of errors, pRef - pOut
+   @return      none
+*/
+void plp_lms_norm_q16s_rv32im(plp_lms_norm_instance_q16 *S,
+                              const int16_t *__restrict__ pSrc,
+                              const int16_t *__restrict__ pRef,
+                              uint32_t blockSize,
+                              int16_t *__restrict__ pOut,
+                              int16_t *__restrict__ pErr) {
+    uint32_t numTaps = S->numTaps;
+    int16_t *pState = S->pState;
+    int16_t *pCoeffs = S->pCoeffs;
+    int16_t mu = S->mu;
+    uint32_t fracBits = S->fracBits;
+    int32_t energy = S->energy;
+    int16_t x0 = S->x0;
+    int32_t acc = 0;
+    uint32_t i, n, k;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    /* output of the first sample */
+    for (k = 0; k < numTaps; k++) {
+        acc += pCoeffs[k] * pState[k];
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const int16_t *px = pState + n;
+        int16_t y = plp_lms_norm_sat_q16(plp_lms_norm_round_q16(acc, fracBits));
+        int16_t e = plp_lms_norm_sat_q16(pRef[n] - y);
+
+        pOut[n] = y;
+        pErr[n] = e;
+
+        /* energy of the delay line of this sample, with fracBits fractional bits */
+        energy += ((px[numTaps - 1] * px[numTaps - 1]) >> fracBits) - ((x0 * x0) >> fracBits);
+        x0 = px[0];
+
+        /* step of the coefficient update, normalized by the energy */
+        int32_t alpha = plp_lms_norm_sat_q16((mu * e) / (energy + 1));
+
+        acc = 0;
+        if (n + 1 < blockSize) {
+            /* update the coefficients with the current samples and filter the next samples in
+               the same pass, such that every coefficient and sample is loaded only once */
+            int16_t xk = px[0];
+            for (k = 0; k < numTaps; k++) {
+                int16_t xn = px[k + 1];
+                int32_t c = plp_lms_norm_update_q16(pCoeffs[k], alpha, xk, fracBits);
+                pCoeffs[k] = c;
+                acc += c * xn;
+                xk = xn;
+            }
+        } else {
+            /* last sample of the block, only update the coefficients */
+            for (k = 0; k < numTaps; k++) {
+                pCoeffs[k] = plp_lms_norm_update_q16(pCoeffs[k], alpha, px[k], fracBits);
+            }
+        }
+    }
+
+    S->energy = energy;
+    S->x0 = x0;
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of LMSNormKernels group
+*/
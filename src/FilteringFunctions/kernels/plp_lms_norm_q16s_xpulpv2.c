@@ -0,0 +1,146 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_q16s_xpulpv2.c
+ * Description:  16-bit fixed point normalized LMS filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LMSNorm
+*/
+
+/**
+   @addtogroup LMSNormKernels
+   @{
+*/
+
+/**
+   @brief      16-bit fixed point normalized LMS filter kernel for XPULPV2 extension.
+
+   The output of the first sample is computed with the current coefficients. After that, the
+   coefficient update of every sample and the output of the next sample are computed in one pass.
+
+   The output is accumulated in 32 bits with __SUMDOTP2, then rounded and saturated to 16 bits. The
+   coefficient updates are rounded and saturated as well.
+   The coefficients are accessed in pairs, so pCoeffs must be 4-byte aligned.
+
+   The step size is mu / (E + 2^-fracBits), where E is the energy of the delay line, computed with
+   fracBits fractional bits. Its product with the error is saturated to 16 bits.
+
+   @param[in]   S          points to an instance of the normalized LMS structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   pRef       points to the block of reference (desired) samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pOut       points to the block of filter outputs
+   @param[out]  pErr       points to the block of errors, pRef - pOut
+   @return      none
+*/
+void plp_lms_norm_q16s_xpulpv2(plp_lms_norm_instance_q16 *S,
+                               const int16_t *__restrict__ pSrc,
+                               const int16_t *__restrict__ pRef,
+                               uint32_t blockSize,
+                               int16_t *__restrict__ pOut,
+                               int16_t *__restrict__ pErr) {
+    uint32_t numTaps = S->numTaps;
+    int16_t *pState = S->pState;
+    int16_t *pCoeffs = S->pCoeffs;
+    int16_t mu = S->mu;
+    uint32_t fracBits = S->fracBits;
+    int32_t energy = S->energy;
+    int16_t x0 = S->x0;
+    int32_t acc = 0;
+    uint32_t i, n, k;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    /* output of the first sample */
+    for (k = 0; k + 2 <= numTaps; k += 2) {
+        acc = __SUMDOTP2(*((v2s *)&pCoeffs[k]), *((v2s *)&pState[k]), acc);
+    }
+    if (k < numTaps) {
+        acc += pCoeffs[k] * pState[k];
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const int16_t *px = pState + n;
+        int16_t y = __CLIP(__ROUNDNORM_REG(acc, fracBits), 15);
+        int16_t e = __CLIP(pRef[n] - y, 15);
+
+        pOut[n] = y;
+        pErr[n] = e;
+
+        /* energy of the delay line of this sample, with fracBits fractional bits */
+        energy += ((px[numTaps - 1] * px[numTaps - 1]) >> fracBits) - ((x0 * x0) >> fracBits);
+        x0 = px[0];
+
+        /* step of the coefficient update, normalized by the energy */
+        int32_t alpha = __CLIP((mu * e) / (energy + 1), 15);
+
+        acc = 0;
+        if (n + 1 < blockSize) {
+            /* update the coefficients with the current samples and filter the next samples in
+               the same pass, such that every coefficient and sample is loaded only once */
+            int32_t xk = px[0];
+            for (k = 0; k + 2 <= numTaps; k += 2) {
+                v2s xn = *((v2s *)&px[k + 1]);
+                int32_t c0 = __CLIP(pCoeffs[k] + __ROUNDNORM_REG(alpha * xk, fracBits), 15);
+                int32_t c1 = __CLIP(pCoeffs[k + 1] + __ROUNDNORM_REG(alpha * xn[0], fracBits), 15);
+                v2s c = __PACK2(c0, c1);
+                *((v2s *)&pCoeffs[k]) = c;
+                acc = __SUMDOTP2(c, xn, acc);
+                xk = xn[1];
+            }
+            if (k < numTaps) {
+                pCoeffs[k] = __CLIP(pCoeffs[k] + __ROUNDNORM_REG(alpha * xk, fracBits), 15);
+                acc += pCoeffs[k] * px[k + 1];
+            }
+        } else {
+            /* last sample of the block, only update the coefficients */
+            for (k = 0; k < numTaps; k++) {
+                pCoeffs[k] = __CLIP(pCoeffs[k] + __ROUNDNORM_REG(alpha * px[k], fracBits), 15);
+            }
+        }
+    }
+
+    S->energy = energy;
+    S->x0 = x0;
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of LMSNormKernels group
+*/
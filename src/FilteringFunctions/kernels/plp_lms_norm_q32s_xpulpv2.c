@@ -0,0 +1,163 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_q32s_xpulpv2.c
+ * Description:  32-bit fixed point normalized LMS filter for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup LMSNorm
+*/
+
+/**
+   @addtogroup LMSNormKernels
+   @{
+*/
+
+/* rounds x to fracBits fractional bits */
+static inline int64_t plp_lms_norm_round_q32(int64_t x, uint32_t fracBits) {
+    if (fracBits > 0) {
+        x = (x + ((int64_t)1 << (fracBits - 1))) >> fracBits;
+    }
+    return x;
+}
+
+/* saturates x to 32 bits */
+static inline int32_t plp_lms_norm_sat_q32(int64_t x) {
+    if (x > INT32_MAX) {
+        return INT32_MAX;
+    } else if (x < INT32_MIN) {
+        return INT32_MIN;
+    }
+    return (int32_t)x;
+}
+
+/* coefficient update c + alpha x, rounded and saturated */
+static inline int32_t plp_lms_norm_update_q32(int32_t c,
+                                              int32_t alpha,
+                                              int32_t x,
+                                              uint32_t fracBits) {
+    return plp_lms_norm_sat_q32(c + plp_lms_norm_round_q32((int64_t)alpha * x, fracBits));
+}
+
+/**
+   @brief      32-bit fixed point normalized LMS filter kernel for XPULPV2 extension.
+
+   The output of the first sample is computed with the current coefficients. After that, the
+   coefficient update of every sample and the output of the next sample are computed in one pass.
+
+   The output is accumulated in 64 bits, then rounded and saturated to 32 bits. The coefficient
+   updates are rounded and saturated as well.
+
+   The step size is mu / (E + 2^-fracBits), where E is the energy of the delay line, computed with
+   fracBits fractional bits in 64 bits. Its product with the error is saturated to 32 bits.
+
+   @param[in]   S          points to an instance of the normalized LMS structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   pRef       points to the block of reference (desired) samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pOut       points to the block of filter outputs
+   @param[out]  pErr       points to the block of errors, pRef - pOut
+   @return      none
+*/
+void plp_lms_norm_q32s_xpulpv2(plp_lms_norm_instance_q32 *S,
+                               const int32_t *__restrict__ pSrc,
+                               const int32_t *__restrict__ pRef,
+                               uint32_t blockSize,
+                               int32_t *__restrict__ pOut,
+                               int32_t *__restrict__ pErr) {
+    uint32_t numTaps = S->numTaps;
+    int32_t *pState = S->pState;
+    int32_t *pCoeffs = S->pCoeffs;
+    int32_t mu = S->mu;
+    uint32_t fracBits = S->fracBits;
+    int64_t energy = S->energy;
+    int32_t x0 = S->x0;
+    int64_t acc = 0;
+    uint32_t i, n, k;
+
+    if (blockSize == 0) {
+        return;
+    }
+
+    /* append the new samples to the delay line */
+    for (i = 0; i < blockSize; i++) {
+        pState[numTaps - 1 + i] = pSrc[i];
+    }
+
+    /* output of the first sample */
+    for (k = 0; k < numTaps; k++) {
+        acc += (int64_t)pCoeffs[k] * pState[k];
+    }
+
+    for (n = 0; n < blockSize; n++) {
+        const int32_t *px = pState + n;
+        int32_t y = plp_lms_norm_sat_q32(plp_lms_norm_round_q32(acc, fracBits));
+        int32_t e = plp_lms_norm_sat_q32((int64_t)pRef[n] - y);
+
+        pOut[n] = y;
+        pErr[n] = e;
+
+        /* energy of the delay line of this sample, with fracBits fractional bits */
+        energy += (((int64_t)px[numTaps - 1] * px[numTaps - 1]) >> fracBits) -
+                  (((int64_t)x0 * x0) >> fracBits);
+        x0 = px[0];
+
+        /* step of the coefficient update, normalized by the energy */
+        int32_t alpha = plp_lms_norm_sat_q32(((int64_t)mu * e) / (energy + 1));
+
+        acc = 0;
+        if (n + 1 < blockSize) {
+            /* update the coefficients with the current samples and filter the next samples in
+               the same pass, such that every coefficient and sample is loaded only once */
+            int32_t xk = px[0];
+            for (k = 0; k < numTaps; k++) {
+                int32_t xn = px[k + 1];
+                int32_t c = plp_lms_norm_update_q32(pCoeffs[k], alpha, xk, fracBits);
+                pCoeffs[k] = c;
+                acc += (int64_t)c * xn;
+                xk = xn;
+            }
+        } else {
+            /* last sample of the block, only update the coefficients */
+            for (k = 0; k < numTaps; k++) {
+                pCoeffs[k] = plp_lms_norm_update_q32(pCoeffs[k], alpha, px[k], fracBits);
+            }
+        }
+    }
+
+    S->energy = energy;
+    S->x0 = x0;
+
+    /* keep the last numTaps - 1 samples for the next block */
+    for (i = 0; i < numTaps - 1; i++) {
+        pState[i] = pState[blockSize + i];
+    }
+}
+
+/**
+   @} end of LMSNormKernels group
+*/
@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup BiquadCascade Biquad Cascade IIR Filters
+   This module contains the glue code for the cascades of second order IIR sections (biquads),
+   which process a stream block by block. The kernel codes (kernels) are in the Module Biquad
+   Cascade IIR Filter Kernels.
+
+   Every stage computes
+   y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2],
+   i.e., the feedback coefficients a1 and a2 have the opposite sign as in the usual (MATLAB)
+   notation. As in CMSIS-DSP, the fixed point versions use the Direct Form I, the floating point
+   version the Direct Form II transposed. The output of a stage is the input of the next one.
+
+   The parallel versions filter independent channels, which are distributed among the cores, since
+   the recursion of a single channel is inherently serial.
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief      Initialization of the 16-bit fixed point biquad cascade filter instance (DF1).
+
+   The state is cleared, i.e., the filter starts from zero initial conditions.
+
+   @param[out]  S          points to an instance of the biquad cascade structure
+   @param[in]   numStages  number of second order stages
+   @param[in]   pCoeffs    points to the coefficients, 6 per stage:
+                           {b10, 0, b11, b12, a11, a12, b20, 0, b21, ...}, with a zero after
+                           every b0, such that the coefficient pairs are word-aligned
+   @param[in]   pState     points to the state buffer of length 4 * numStages, holding
+                           {x[n-1], x[n-2], y[n-1], y[n-2]} per stage
+   @param[in]   fracBits   number of fractional bits of the coefficients
+   @return      none
+*/
+void plp_biquad_cascade_df1_init_q16(plp_biquad_cascade_df1_instance_q16 *S,
+                                     uint32_t numStages,
+                                     const int16_t *pCoeffs,
+                                     int16_t *pState,
+                                     uint32_t fracBits) {
+    uint32_t i;
+
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < 4 * numStages; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
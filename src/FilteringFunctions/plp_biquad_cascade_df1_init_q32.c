@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_init_q32.c
+ * Description:  Initialization of the 32-bit fixed point biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief      Initialization of the 32-bit fixed point biquad cascade filter instance (DF1).
+
+   The state is cleared, i.e., the filter starts from zero initial conditions.
+
+   @param[out]  S          points to an instance of the biquad cascade structure
+   @param[in]   numStages  number of second order stages
+   @param[in]   pCoeffs    points to the coefficients, 5 per stage:
+                           {b10, b11, b12, a11, a12, b20, b21, ...}
+   @param[in]   pState     points to the state buffer of length 4 * numStages, holding
+                           {x[n-1], x[n-2], y[n-1], y[n-2]} per stage
+   @param[in]   fracBits   number of fractional bits of the coefficients
+   @return      none
+*/
+void plp_biquad_cascade_df1_init_q32(plp_biquad_cascade_df1_instance_q32 *S,
+                                     uint32_t numStages,
+                                     const int32_t *pCoeffs,
+                                     int32_t *pState,
+                                     uint32_t fracBits) {
+    uint32_t i;
+
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < 4 * numStages; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
@@ -0,0 +1,69 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df1_q16.c
+ * Description:  Glue code for the 16-bit fixed point biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief      Glue code for the 16-bit fixed point biquad cascade filter (DF1).
+
+   Filters the next blockSize samples of the stream and updates the state in S->pState. The
+   processing can be done in-place (pSrc == pDst).
+
+   The products are accumulated in 64 bits, shifted right by S->fracBits with rounding and
+   saturated to the output format.
+
+   @param[in]   S          points to an instance of the biquad cascade structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+*/
+void plp_biquad_cascade_df1_q16(const plp_biquad_cascade_df1_instance_q16 *S,
+                                const int16_t *pSrc,
+                                uint32_t blockSize,
+                                int16_t *pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_biquad_cascade_df1_q16s_rv32im(S, pSrc, blockSize, pDst);
+    } else {
+        plp_biquad_cascade_df1_q16s_xpulpv2(S, pSrc, blockSize, pDst);
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_f32_parallel.c
+ * Description:  Glue code for the parallel 32-bit floating point biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief      Glue code for the parallel 32-bit floating point biquad cascade filter (DF2T).
+
+   Filters nChannels independent streams, each with its own instance S[c]. The samples of channel
+   c are pSrc[c * blockSize] .. pSrc[c * blockSize + blockSize - 1], and the same for pDst. The
+   channels are distributed among the cores, the result is the same as calling
+   plp_biquad_cascade_df2T_f32 for every channel.
+
+   @param[in]   S          points to the array of nChannels filter instances
+   @param[in]   nChannels  number of independent channels
+   @param[in]   pSrc       points to the input samples, blockSize per channel
+   @param[in]   blockSize  number of samples per channel
+   @param[in]   nPE        number of parallel processing units
+   @param[out]  pDst       points to the output samples, blockSize per channel
+   @return      none
+*/
+void plp_biquad_cascade_df2T_f32_parallel(const plp_biquad_cascade_df2T_instance_f32 *S,
+                                          uint32_t nChannels,
+                                          const float32_t *pSrc,
+                                          uint32_t blockSize,
+                                          uint32_t nPE,
+                                          float32_t *pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_biquad_cascade_df2T_instance_f32_parallel args = { .S = S,
+                                                                 .nChannels = nChannels,
+                                                                 .pSrc = pSrc,
+                                                                 .blockSize = blockSize,
+                                                                 .nPE = nPE,
+                                                                 .pDst = pDst };
+
+        hal_cl_team_fork(nPE, plp_biquad_cascade_df2T_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
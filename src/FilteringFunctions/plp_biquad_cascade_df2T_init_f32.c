@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_biquad_cascade_df2T_init_f32.c
+ * Description:  Initialization of the 32-bit floating point biquad cascade filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BiquadCascade
+   @{
+*/
+
+/**
+   @brief      Initialization of the 32-bit floating point biquad cascade filter instance (DF2T).
+
+   The state is cleared, i.e., the filter starts from zero initial conditions.
+
+   @param[out]  S          points to an instance of the biquad cascade structure
+   @param[in]   numStages  number of second order stages
+   @param[in]   pCoeffs    points to the coefficients, 5 per stage:
+                           {b10, b11, b12, a11, a12, b20, b21, ...}
+   @param[in]   pState     points to the state buffer of length 2 * numStages, holding
+                           {d1, d2} per stage
+   @return      none
+*/
+void plp_biquad_cascade_df2T_init_f32(plp_biquad_cascade_df2T_instance_f32 *S,
+                                      uint32_t numStages,
+                                      const float32_t *pCoeffs,
+                                      float32_t *pState) {
+    uint32_t i;
+
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    for (i = 0; i < 2 * numStages; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of BiquadCascade group
+*/
@@ -0,0 +1,78 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i16.c
+ * Description:  Glue code for the valid 2D convolution of 16-bit integer images
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Conv2d
+   @{
+*/
+
+/**
+   @brief      Glue code for the valid 2D convolution of 16-bit integer images.
+   @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+   @param[in]  srcRows  number of rows of the input image
+   @param[in]  srcCols  number of columns of the input image
+   @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+   @param[in]  kerRows  number of rows of the filter kernel
+   @param[in]  kerCols  number of columns of the filter kernel
+   @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                        (srcCols - kerCols + 1) elements
+   @return     none
+
+   @par Exploiting SIMD instructions
+   On the cluster, four neighbouring output pixels are computed at once. Every row of the filter
+   kernel is loaded in reverse order into SIMD vectors, which are multiplied with the input row
+   at four consecutive offsets.
+*/
+void plp_conv2d_i16(const int16_t *__restrict__ pSrc,
+                    uint32_t srcRows,
+                    uint32_t srcCols,
+                    const int16_t *__restrict__ pKernel,
+                    uint32_t kerRows,
+                    uint32_t kerCols,
+                    int32_t *__restrict__ pDst) {
+
+    if (kerRows == 0 || kerCols == 0 || srcRows < kerRows || srcCols < kerCols) {
+        return;
+    }
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_conv2d_i16s_rv32im(pSrc, srcRows, srcCols, pKernel, kerRows, kerCols, pDst);
+    } else {
+        plp_conv2d_i16s_xpulpv2(pSrc, srcRows, srcCols, pKernel, kerRows, kerCols, pDst);
+    }
+}
+
+/**
+   @} end of Conv2d group
+*/
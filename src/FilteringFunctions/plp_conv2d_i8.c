@@ -0,0 +1,90 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8.c
+ * Description:  Glue code for the valid 2D convolution of 8-bit integer images
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup Conv2d 2D Convolution
+   This module contains the glue code for the 2D convolution of images, e.g. for image filtering.
+   The kernel codes (kernels) are in the Module 2D Convolution Kernels.
+
+   The output image is the valid part of the convolution of the input image with the filter
+   kernel, i.e. y[i][j] = sum_m sum_n x[i + m][j + n] h[kerRows - 1 - m][kerCols - 1 - n], for
+   0 <= i <= srcRows - kerRows and 0 <= j <= srcCols - kerCols. All images are stored row by row.
+   For correlation (which is what most image filters are specified as), the kernel has to be
+   flipped in both dimensions beforehand.
+*/
+
+/**
+   @addtogroup Conv2d
+   @{
+*/
+
+/**
+   @brief      Glue code for the valid 2D convolution of 8-bit integer images.
+   @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+   @param[in]  srcRows  number of rows of the input image
+   @param[in]  srcCols  number of columns of the input image
+   @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+   @param[in]  kerRows  number of rows of the filter kernel
+   @param[in]  kerCols  number of columns of the filter kernel
+   @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                        (srcCols - kerCols + 1) elements
+   @return     none
+
+   @par Exploiting SIMD instructions
+   On the cluster, four neighbouring output pixels are computed at once. Every row of the filter
+   kernel is loaded in reverse order into SIMD vectors, which are multiplied with the input row
+   at four consecutive offsets.
+*/
+void plp_conv2d_i8(const int8_t *__restrict__ pSrc,
+                   uint32_t srcRows,
+                   uint32_t srcCols,
+                   const int8_t *__restrict__ pKernel,
+                   uint32_t kerRows,
+                   uint32_t kerCols,
+                   int32_t *__restrict__ pDst) {
+
+    if (kerRows == 0 || kerCols == 0 || srcRows < kerRows || srcCols < kerCols) {
+        return;
+    }
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_conv2d_i8s_rv32im(pSrc, srcRows, srcCols, pKernel, kerRows, kerCols, pDst);
+    } else {
+        plp_conv2d_i8s_xpulpv2(pSrc, srcRows, srcCols, pKernel, kerRows, kerCols, pDst);
+    }
+}
+
+/**
+   @} end of Conv2d group
+*/
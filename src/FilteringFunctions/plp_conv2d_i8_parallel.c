@@ -0,0 +1,134 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv2d_i8_parallel.c
+ * Description:  Glue code for the parallel valid 2D convolution of 8-bit integer images
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup Conv2d
+   @{
+*/
+
+/**
+   @brief      Glue code for the parallel valid 2D convolution of 8-bit integer images
+               in L2.
+   @param[in]  pSrc     points to the input image of srcRows x srcCols elements
+   @param[in]  srcRows  number of rows of the input image
+   @param[in]  srcCols  number of columns of the input image
+   @param[in]  pKernel  points to the filter kernel of kerRows x kerCols elements
+   @param[in]  kerRows  number of rows of the filter kernel
+   @param[in]  kerCols  number of columns of the filter kernel
+   @param[in]  nPE      number of cores to use
+   @param[out] pDst     points to the output image of (srcRows - kerRows + 1) x
+                        (srcCols - kerCols + 1) elements
+   @return     none
+
+   @par Tiling
+   The output image is split into tiles of at most 16 x 128 pixels. For every tile, the input
+   pixels it depends on, i.e. the tile extended by kerRows - 1 halo rows and kerCols - 1 halo
+   columns, are transferred into L1 by DMA, double buffered. The filter kernel is copied into L1
+   once. If the buffers do not fit into the free L1 memory, the larger tile dimension is halved
+   until they do.
+*/
+void plp_conv2d_i8_parallel(const int8_t *__restrict__ pSrc,
+                            uint32_t srcRows,
+                            uint32_t srcCols,
+                            const int8_t *__restrict__ pKernel,
+                            uint32_t kerRows,
+                            uint32_t kerCols,
+                            uint32_t nPE,
+                            int32_t *__restrict__ pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (kerRows == 0 || kerCols == 0 || srcRows < kerRows || srcCols < kerCols) {
+            return;
+        }
+
+        uint32_t dstRows = srcRows - kerRows + 1;
+        uint32_t dstCols = srcCols - kerCols + 1;
+        uint32_t tileRows = (dstRows < 16) ? dstRows : 16;
+        uint32_t tileCols = (dstCols < 128) ? dstCols : 128;
+
+        uint32_t sizeDst, sizeSrc, sizeKer;
+        int32_t *pBuf;
+
+        sizeKer = sizeof(int8_t) * kerRows * kerCols;
+
+        while (1) {
+            sizeDst = 2 * sizeof(int32_t) * tileRows * tileCols;
+            sizeSrc = 2 * sizeof(int8_t) * (tileRows + kerRows - 1) * (tileCols + kerCols - 1);
+            sizeSrc = (sizeSrc + 3) & ~3; // keeps the kernel buffer aligned
+            pBuf = hal_cl_l1_malloc(sizeDst + sizeSrc + sizeKer);
+            if (pBuf != NULL) {
+                break;
+            }
+            if (tileRows == 1 && tileCols == 1) {
+                printf("Error: insufficient L1 memory!\n");
+                return;
+            }
+            if (tileCols >= tileRows) {
+                tileCols = (tileCols + 1) >> 1;
+            } else {
+                tileRows = (tileRows + 1) >> 1;
+            }
+        }
+
+        plp_conv2d_instance_i8 args = {
+            .pSrc = pSrc,
+            .srcRows = srcRows,
+            .srcCols = srcCols,
+            .kerRows = kerRows,
+            .kerCols = kerCols,
+            .tileRows = tileRows,
+            .tileCols = tileCols,
+            .nPE = nPE,
+            .pBufSrc = (int8_t *)((uint8_t *)pBuf + sizeDst),
+            .pBufKer = (int8_t *)((uint8_t *)pBuf + sizeDst + sizeSrc),
+            .pBufDst = pBuf,
+            .pDst = pDst
+        };
+
+        hal_cl_dma_cmd((uintptr_t)pKernel, (uintptr_t)args.pBufKer, sizeKer,
+                       HAL_CL_DMA_DIR_EXT2LOC, 0, &args.dmaLoad[0]);
+        hal_cl_dma_cmd_wait(&args.dmaLoad[0]);
+
+        hal_cl_team_fork(nPE, plp_conv2d_i8p_xpulpv2, (void *)&args);
+
+        hal_cl_l1_free(pBuf, sizeDst + sizeSrc + sizeKer);
+    }
+}
+
+/**
+   @} end of Conv2d group
+*/
@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_conv_rep_init_i16.c
+ * Description:  Setup of the replicated L1 buffers for the 16-bit integer convolution
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicConvolution
+   @{
+*/
+
+/**
+   @brief      Setup of the replicated L1 buffers for the convolution and correlation of
+               16-bit integer vectors.
+
+   The SIMD kernels compute 2 neighbouring outputs at once, which needs the longer vector at 2
+   different offsets. Instead of unaligned loads or shuffles, the longer vector is replicated 2
+   times in L1, copy i being shifted by i elements, such that all loads of the kernel
+   plp_conv_valid_rep_i16s_xpulpv2 are aligned. This function allocates the buffers and fills
+   them by DMA. For the full convolution and correlation, srcBLen - 1 zeros are added on both
+   sides of the longer vector (srcBLen being the length of the shorter one), which reduces them
+   to a valid convolution. For the correlation, the shorter vector is stored reversed. It is
+   placed such that its SIMD loads are aligned as well.
+
+   The inputs are ordered by length, since the convolution is commutative. The correlation with
+   a longer second vector is the reversed correlation with swapped inputs, which is indicated by
+   S->revRes.
+
+   @param[out] S        points to the instance structure, to be passed to the kernels
+   @param[in]  pSrcA    points to the first input vector, in L2
+   @param[in]  srcALen  Length of the first input vector
+   @param[in]  pSrcB    points to the second input vector, in L2
+   @param[in]  srcBLen  Length of the second input vector
+   @param[in]  full     0: valid convolution, 1: full convolution (or correlation)
+   @param[in]  corr     0: convolution, 1: correlation
+   @return     0 on success, 1 if the buffers do not fit into L1 (then, nothing is allocated)
+*/
+int plp_conv_rep_init_i16(plp_conv_rep_instance_i16 *S,
+                          const int16_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int16_t *pSrcB,
+                          const uint32_t srcBLen,
+                          uint32_t full,
+                          uint32_t corr) {
+
+    const int16_t *pLong;
+    const int16_t *pShort;
+    uint32_t longLen, shortLen;
+
+    if (srcALen >= srcBLen) {
+        pLong = pSrcA;
+        pShort = pSrcB;
+        longLen = srcALen;
+        shortLen = srcBLen;
+        S->revRes = 0;
+    } else {
+        pLong = pSrcB;
+        pShort = pSrcA;
+        longLen = srcBLen;
+        shortLen = srcALen;
+        S->revRes = corr;
+    }
+
+    // the kernel needs at least 2 taps, a single tap is extended with a leading zero and the
+    // longer vector with a trailing zero
+    uint32_t kerLen = (shortLen < 2) ? 2 : shortLen;
+    uint32_t pad = full ? shortLen - 1 : 0;
+    uint32_t padLen = pad + longLen + pad + (kerLen - shortLen);
+    uint32_t memLen = ((padLen + 1) >> 1) << 1; // aligned length of one copy
+    uint32_t guard = 4 + (kerLen & 1);          // elements in front of the shorter vector
+
+    S->memSize = sizeof(int16_t) * (2 * memLen + guard + kerLen);
+    S->pSrcA = hal_cl_l1_malloc(S->memSize);
+    if (S->pSrcA == NULL) {
+        return 1;
+    }
+    S->srcALen = padLen;
+    S->srcAMem = memLen;
+    S->pSrcB = S->pSrcA + 2 * memLen + guard;
+    S->srcBLen = kerLen;
+
+    hal_cl_dma_cmd_t copy;
+    int merge = 0;
+    uint32_t i, k;
+
+    // copy i holds the padded longer vector from element i on
+    for (i = 0; i < 2; i++) {
+        int16_t *pCopy = S->pSrcA + i * memLen;
+        uint32_t lead = (pad > i) ? pad - i : 0; // leading zeros
+        uint32_t skip = (i > pad) ? i - pad : 0; // elements of the longer vector not in the copy
+        uint32_t len = (skip < longLen) ? longLen - skip : 0;
+
+        if (len > 0) {
+            hal_cl_dma_cmd((uintptr_t)(pLong + skip), (uintptr_t)(pCopy + lead),
+                           sizeof(int16_t) * len, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+            merge = 1;
+        }
+        for (k = 0; k < lead; k++) {
+            pCopy[k] = 0;
+        }
+        for (k = lead + len; k < memLen; k++) {
+            pCopy[k] = 0;
+        }
+    }
+
+    for (k = 0; k < guard + kerLen - shortLen; k++) {
+        S->pSrcA[2 * memLen + k] = 0;
+    }
+    if (corr) {
+        for (k = 0; k < shortLen; k++) {
+            S->pSrcB[kerLen - 1 - k] = pShort[k];
+        }
+    } else {
+        hal_cl_dma_cmd((uintptr_t)pShort, (uintptr_t)(S->pSrcB + kerLen - shortLen),
+                       sizeof(int16_t) * shortLen, HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+        merge = 1;
+    }
+
+    if (merge) {
+        hal_cl_dma_cmd_wait(&copy);
+    }
+
+    return 0;
+}
+
+/**
+   @} end of BasicConvolution group
+*/
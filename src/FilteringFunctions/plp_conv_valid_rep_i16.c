@@ -56,66 +56,26 @@ void plp_conv_valid_rep_i16(const int16_t *pSrcA,
                             const uint32_t srcBLen,
                             int32_t *pRes) {
 
-    uint32_t in1Len, in2Len;
-    const int16_t *pIn1;
-    const int16_t *pIn2;
-
-    if (srcALen >= srcBLen) {
-        in1Len = srcALen;
-        in2Len = srcBLen;
-        pIn1 = pSrcA;
-        pIn2 = pSrcB;
-    } else {
-        in2Len = srcALen;
-        in1Len = srcBLen;
-        pIn2 = pSrcA;
-        pIn1 = pSrcB;
-    }
-
     if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_conv_valid_i16(pSrcA, srcALen, pSrcB, srcBLen, pRes);
+        return;
+    }
 
-        printf("Errorr: Not Implemented!");
-
-    } else {
-
-        /*
-         * because of data replication, the first copy starts at index 0, and must go up to index
-         * in1Len - 2, therefore, it is in1Len - 1 long. The last copy starts at index 1 and goes
-         * up to index in1Len - 1.
-         */
-
-        // compute required memory size
-        uint32_t len_align = ((in1Len + 1) >> 1) << 1; // compute aligned memory size
-        uint32_t mem_size = len_align << 1;            // memory size for all 2 replications
-
-        int16_t *p_1_loc = hal_cl_l1_malloc(sizeof(int16_t) * mem_size);
-        int16_t *p_2_loc = hal_cl_l1_malloc(sizeof(int16_t) * in2Len);
-
-        if (p_1_loc == NULL || p_2_loc == NULL) {
-            printf("Error: insufficient L1 memory!\n");
-            return;
-        }
-
-        // copy the data over to the L1 data, replicated 4 times
-        hal_cl_dma_cmd_t copy;
-        int merge = 0;
-
-        for (int i = 0; i < 2; i++) {
-            hal_cl_dma_cmd((unsigned int)(pIn1 + i), (unsigned int)(p_1_loc + i * len_align),
-                          sizeof(int16_t) * (in1Len - i), HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
-            merge = 1;
-        }
+    if (srcALen == 0 || srcBLen == 0) {
+        return;
+    }
 
-        hal_cl_dma_cmd((unsigned int)pIn2, (unsigned int)p_2_loc, sizeof(int16_t) * in2Len,
-                      HAL_CL_DMA_DIR_EXT2LOC, merge, &copy);
+    // the data is replicated in L1, such that all SIMD loads of the kernel are aligned
+    plp_conv_rep_instance_i16 S;
 
-        hal_cl_dma_cmd_wait(&copy);
+    if (plp_conv_rep_init_i16(&S, pSrcA, srcALen, pSrcB, srcBLen, 0, 0)) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
 
-        plp_conv_valid_rep_i16s_xpulpv2(p_1_loc, in1Len, len_align, p_2_loc, in2Len, pRes);
+    plp_conv_valid_rep_i16s_xpulpv2(S.pSrcA, S.srcALen, S.srcAMem, S.pSrcB, S.srcBLen, pRes);
 
-        hal_cl_l1_free(p_1_loc, sizeof(int16_t) * mem_size);
-        hal_cl_l1_free(p_2_loc, sizeof(int16_t) * in2Len);
-    }
+    hal_cl_l1_free(S.pSrcA, S.memSize);
 }
 
 /**
@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_correlate_rep_i8.c
+ * Description:  8-bit integer correlation with data replication glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup BasicCorrelation
+   @{
+*/
+
+/**
+   @brief Glue code for correlation of 8-bit integer vectors with data replication.
+
+   On the fabric controller, the computation is done by plp_correlate_i8.
+
+   @param[in]  pSrcA   points to the first input vector, in L2
+   @param[in]  srcALen Length of the first input vector
+   @param[in]  pSrcB   points to the second input vector, in L2
+   @param[in]  srcBLen Length of the second input vector
+   @param[out] pRes    output result returned here, of size srcALen + srcBLen - 1
+   @return     none
+
+   @par Data replication
+   The longer vector is replicated in L1 by plp_conv_rep_init_i8, such that the SIMD kernel
+   only issues aligned loads. If the buffers do not fit into L1, an error is printed.
+*/
+void plp_correlate_rep_i8(const int8_t *pSrcA,
+                          const uint32_t srcALen,
+                          const int8_t *pSrcB,
+                          const uint32_t srcBLen,
+                          int32_t *pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_correlate_i8(pSrcA, srcALen, pSrcB, srcBLen, pRes);
+        return;
+    }
+
+    if (srcALen == 0 || srcBLen == 0) {
+        return;
+    }
+
+    plp_conv_rep_instance_i8 S;
+
+    if (plp_conv_rep_init_i8(&S, pSrcA, srcALen, pSrcB, srcBLen, 1, 1)) {
+        printf("Error: insufficient L1 memory!\n");
+        return;
+    }
+
+    plp_conv_valid_rep_i8s_xpulpv2(S.pSrcA, S.srcALen, S.srcAMem, S.pSrcB, S.srcBLen, pRes);
+
+    if (S.revRes) {
+        uint32_t resLen = srcALen + srcBLen - 1;
+        for (uint32_t i = 0; i < resLen / 2; i++) {
+            int32_t tmp = pRes[i];
+            pRes[i] = pRes[resLen - 1 - i];
+            pRes[resLen - 1 - i] = tmp;
+        }
+    }
+
+    hal_cl_l1_free(S.pSrcA, S.memSize);
+}
+
+/**
+   @} end of BasicCorrelation group
+*/
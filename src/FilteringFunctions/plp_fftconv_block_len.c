@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_block_len.c
+ * Description:  Block length of the FFT-based convolution and correlation
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup FFTConvolution FFT Convolution
+   This module contains the convolution and the correlation of long vectors with the overlap-save
+   method. The longer vector is cut into blocks of L - M + 1 samples, where M is the length of the
+   shorter one. Every block is extended by the M - 1 preceding samples, transformed with a real FFT
+   of length L, multiplied with the spectrum of the shorter vector (computed once) and transformed
+   back. The last L - M + 1 samples of the result are the exact (linear) convolution, the first
+   M - 1 ones contain the wrap-around of the circular convolution and are discarded.
+
+   The block length L is chosen by plp_fftconv_block_len. If the direct form is cheaper (short
+   vectors) or if the working buffers cannot be allocated in L1, the functions compute the direct
+   form. The kernel codes (kernels) are in the Module FFT Convolution Kernels.
+*/
+
+/**
+   @addtogroup FFTConvolution
+   @{
+*/
+
+/**
+   @brief      Block length of the FFT-based convolution and correlation.
+
+   The cost of a block of length L is modelled as 3 L log2(L) + 10 L operations: a forward and an
+   inverse real FFT with L/4 log2(L) butterflies of about 6 operations each, plus the spectral
+   product, the split passes and the data movement. The direct form costs one multiply-accumulate
+   per tap and output sample. The cheapest power of two L >= 2M - 1, starting from 32, is
+   returned, where M is the length of the shorter vector.
+
+   @param[in]  srcALen  length of the first input vector
+   @param[in]  srcBLen  length of the second input vector
+   @param[in]  maxLen   largest supported FFT length
+   @return     the FFT length, or 0 if the direct form is cheaper
+*/
+uint32_t plp_fftconv_block_len(uint32_t srcALen, uint32_t srcBLen, uint32_t maxLen) {
+
+    uint32_t lenH = srcALen < srcBLen ? srcALen : srcBLen;
+    uint32_t nOut = srcALen + srcBLen - 1;
+    uint32_t L, log2L, step, nBlocks;
+    uint64_t cost, best;
+    uint32_t bestLen = 0;
+
+    if (lenH == 0) {
+        return 0;
+    }
+
+    // direct form, one multiply-accumulate per tap and output sample
+    best = (uint64_t)lenH * nOut;
+
+    for (L = 32, log2L = 5; L <= maxLen; L <<= 1, log2L++) {
+        if (L < 2 * lenH - 1) {
+            continue;
+        }
+
+        step = L - lenH + 1;
+        nBlocks = (nOut + step - 1) / step;
+        cost = (uint64_t)nBlocks * L * (3 * log2L + 10);
+
+        if (cost < best) {
+            best = cost;
+            bestLen = L;
+        }
+
+        // longer blocks only add zeros
+        if (nBlocks == 1) {
+            break;
+        }
+    }
+
+    return bestLen;
+}
+
+/**
+   @} end of FFTConvolution group
+*/
@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_f32.c
+ * Description:  FFT-based convolution of 32-bit floating point vectors
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FFTConvolution
+   @{
+*/
+
+/**
+   @brief      Glue code for the FFT-based convolution of 32-bit floating point vectors.
+
+   Computes the full convolution of length srcALen + srcBLen - 1,
+   pRes[n] = sum_i pSrcA[i] pSrcB[n - i],
+   with the overlap-save method and FFT lengths up to PLP_FFTCONV_F32_MAX_LEN.
+
+   @param[in]  pSrcA      points to the first input vector
+   @param[in]  srcALen    Length of the first input vector
+   @param[in]  pSrcB      points to the second input vector
+   @param[in]  srcBLen    Length of the second input vector
+   @param[out] pRes       output result returned here
+   @return     none
+*/
+void plp_fftconv_f32(const float32_t *pSrcA,
+                     const uint32_t srcALen,
+                     const float32_t *pSrcB,
+                     const uint32_t srcBLen,
+                     float32_t *pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_fftconv_f32s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, 0, pRes);
+}
+
+/**
+   @} end of FFTConvolution group
+*/
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fftconv_q16.c
+ * Description:  FFT-based convolution of 16-bit fixed point vectors
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FFTConvolution
+   @{
+*/
+
+/**
+   @brief      Glue code for the FFT-based convolution of 16-bit fixed point vectors.
+
+   Computes the full convolution of length srcALen + srcBLen - 1,
+   pRes[n] = sum_i pSrcA[i] pSrcB[n - i],
+   shifted right by fracBits with rounding. The blocks are transformed with the 32-bit real FFT of
+   up to PLP_FFTCONV_Q16_MAX_LEN points and normalized with block exponents, such that the result
+   is accurate to about one LSB.
+
+   @param[in]  pSrcA      points to the first input vector
+   @param[in]  srcALen    Length of the first input vector
+   @param[in]  pSrcB      points to the second input vector
+   @param[in]  srcBLen    Length of the second input vector
+   @param[in]  fracBits   number of fractional bits of the result (15 for Q1.15 inputs and output)
+   @param[out] pRes       output result returned here
+   @return     none
+*/
+void plp_fftconv_q16(const int16_t *pSrcA,
+                     const uint32_t srcALen,
+                     const int16_t *pSrcB,
+                     const uint32_t srcBLen,
+                     uint32_t fracBits,
+                     int32_t *pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_fftconv_q16s_rv32im(pSrcA, srcALen, pSrcB, srcBLen, 0, fracBits, pRes);
+    } else {
+        plp_fftconv_q16s_xpulpv2(pSrcA, srcALen, pSrcB, srcBLen, 0, fracBits, pRes);
+    }
+}
+
+/**
+   @} end of FFTConvolution group
+*/
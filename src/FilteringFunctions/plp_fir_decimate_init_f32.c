@@ -0,0 +1,79 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_init_f32.c
+ * Description:  Initialization of the 32-bit floating point FIR decimation filter instance
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIRDecimate
+   @{
+*/
+
+/**
+   @brief      Initialization of the 32-bit floating point FIR decimation filter instance.
+
+   The delay line is cleared, i.e., the filter starts from zero initial conditions.
+
+   @param[out]  S          points to an instance of the FIR decimation structure
+   @param[in]   numTaps    number of filter coefficients
+   @param[in]   M          decimation factor
+   @param[in]   pCoeffs    points to the numTaps coefficients in time-reversed order
+   @param[in]   pState     points to the state buffer of length numTaps + blockSize - 1
+   @param[in]   blockSize  maximum number of input samples processed per call
+   @return      0 on success, 1 if M is zero or blockSize is not a multiple of M
+*/
+int plp_fir_decimate_init_f32(plp_fir_decimate_instance_f32 *S,
+                              uint32_t numTaps,
+                              uint32_t M,
+                              const float32_t *pCoeffs,
+                              float32_t *pState,
+                              uint32_t blockSize) {
+    uint32_t i;
+
+    if (M == 0 || blockSize % M != 0) {
+        return 1;
+    }
+
+    S->M = M;
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+
+    return 0;
+}
+
+/**
+   @} end of FIRDecimate group
+*/
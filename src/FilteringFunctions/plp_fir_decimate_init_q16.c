@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_decimate_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point FIR decimation filter instance
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup FIRDecimate FIR Decimation
+   This module contains the glue code for the stateful FIR decimation filters. The kernel codes
+   (kernels) are in the Module FIR Decimation Kernels.
+
+   The filter computes only the retained outputs y[m] = sum_k b[k] x[mM - k] of the FIR filter,
+   i.e., M times fewer multiply-accumulates than filtering and discarding. Like for the FIR filters
+   (see plp_fir_init_q16), the coefficients are stored in time-reversed order and the last
+   numTaps - 1 input samples are kept in a delay line, such that consecutive calls continue the
+   same stream. The number of input samples per call must be a multiple of M.
+*/
+
+/**
+   @addtogroup FIRDecimate
+   @{
+*/
+
+/**
+   @brief      Initialization of the 16-bit fixed point FIR decimation filter instance.
+
+   The delay line is cleared, i.e., the filter starts from zero initial conditions.
+
+   @param[out]  S          points to an instance of the FIR decimation structure
+   @param[in]   numTaps    number of filter coefficients
+   @param[in]   M          decimation factor
+   @param[in]   pCoeffs    points to the numTaps coefficients in time-reversed order
+   @param[in]   pState     points to the state buffer of length numTaps + blockSize - 1
+   @param[in]   blockSize  maximum number of input samples processed per call
+   @param[in]   fracBits   number of fractional bits of the coefficients
+   @return      0 on success, 1 if M is zero or blockSize is not a multiple of M
+*/
+int plp_fir_decimate_init_q16(plp_fir_decimate_instance_q16 *S,
+                              uint32_t numTaps,
+                              uint32_t M,
+                              const int16_t *pCoeffs,
+                              int16_t *pState,
+                              uint32_t blockSize,
+                              uint32_t fracBits) {
+    uint32_t i;
+
+    if (M == 0 || blockSize % M != 0) {
+        return 1;
+    }
+
+    S->M = M;
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+
+    return 0;
+}
+
+/**
+   @} end of FIRDecimate group
+*/
@@ -0,0 +1,67 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_f32.c
+ * Description:  Glue code for the 32-bit floating point FIR filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIR
+   @{
+*/
+
+/**
+   @brief      Glue code for the FIR filter of 32-bit floating point vectors.
+
+   Filters the next blockSize samples of the stream and updates the delay line in S->pState.
+
+   @param[in]   S          points to an instance of the 32-bit floating point FIR filter structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   blockSize  number of samples to process, at most the blockSize given to
+                           plp_fir_init_f32
+   @param[out]  pDst       points to the block of output samples
+   @return      none
+*/
+void plp_fir_f32(const plp_fir_instance_f32 *S,
+                 const float32_t *__restrict__ pSrc,
+                 uint32_t blockSize,
+                 float32_t *__restrict__ pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_fir_f32s_xpulpv2(S, pSrc, blockSize, pDst);
+}
+
+/**
+   @} end of FIR group
+*/
@@ -0,0 +1,82 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fir_interpolate_init_q32.c
+ * Description:  Initialization of the 32-bit fixed point FIR interpolation filter instance
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup FIRInterpolate
+   @{
+*/
+
+/**
+   @brief      Initialization of the 32-bit fixed point FIR interpolation filter instance.
+
+   The delay line is cleared, i.e., the filter starts from zero initial conditions.
+
+   @param[out]  S          points to an instance of the FIR interpolation structure
+   @param[in]   L          interpolation factor
+   @param[in]   numTaps    number of filter coefficients
+   @param[in]   pCoeffs    points to the numTaps coefficients in time-reversed order
+   @param[in]   pState     points to the state buffer of length numTaps / L + blockSize - 1
+   @param[in]   blockSize  maximum number of input samples processed per call
+   @param[in]   fracBits   number of fractional bits of the coefficients
+   @return      0 on success, 1 if L is zero or numTaps is not a multiple of L
+*/
+int plp_fir_interpolate_init_q32(plp_fir_interpolate_instance_q32 *S,
+                                 uint32_t L,
+                                 uint32_t numTaps,
+                                 const int32_t *pCoeffs,
+                                 int32_t *pState,
+                                 uint32_t blockSize,
+                                 uint32_t fracBits) {
+    uint32_t i;
+
+    if (L == 0 || numTaps % L != 0) {
+        return 1;
+    }
+
+    S->L = L;
+    S->phaseLength = numTaps / L;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < S->phaseLength + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+
+    return 0;
+}
+
+/**
+   @} end of FIRInterpolate group
+*/
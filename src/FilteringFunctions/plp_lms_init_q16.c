@@ -0,0 +1,94 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point LMS filter instance
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup LMS Least Mean Square (LMS) Filters
+   This module contains the glue code for the adaptive LMS filters. The kernel codes (kernels) are
+   in the Module LMS Filter Kernels.
+
+   For every sample, the filter computes the output y[n] = sum_k b[k] x[n - k] and the error
+   e[n] = d[n] - y[n] with respect to the reference d[n], and adapts the coefficients,
+   b[k] += mu e[n] x[n - k]. Like for the FIR filters (see plp_fir_init_q16), the coefficients
+   are stored in time-reversed order and the last numTaps - 1 input samples are kept in a delay
+   line, such that consecutive calls continue the same stream.
+
+   The kernels update the coefficients for one sample and compute the output of the next sample
+   in the same pass over the taps, such that the coefficients and the delay line are loaded only
+   once per sample.
+*/
+
+/**
+   @addtogroup LMS
+   @{
+*/
+
+/**
+   @brief      Initialization of the 16-bit fixed point LMS filter instance.
+
+   The delay line is cleared, i.e., the filter starts from zero initial conditions. The
+   coefficients are adapted in place.
+   All values (samples, coefficients and mu) have fracBits fractional bits.
+
+   @param[out]  S          points to an instance of the LMS structure
+   @param[in]   numTaps    number of filter coefficients
+   @param[in]   pCoeffs    points to the numTaps initial coefficients in time-reversed order
+   @param[in]   pState     points to the state buffer of length numTaps + blockSize - 1
+   @param[in]   mu         step size
+   @param[in]   blockSize  maximum number of samples processed per call
+   @param[in]   fracBits   number of fractional bits of all values
+   @return      none
+*/
+void plp_lms_init_q16(plp_lms_instance_q16 *S,
+                      uint32_t numTaps,
+                      int16_t *pCoeffs,
+                      int16_t *pState,
+                      int16_t mu,
+                      uint32_t blockSize,
+                      uint32_t fracBits) {
+    uint32_t i;
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->mu = mu;
+    S->fracBits = fracBits;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of LMS group
+*/
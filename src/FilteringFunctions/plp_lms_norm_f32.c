@@ -0,0 +1,72 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_f32.c
+ * Description:  Glue code for the 32-bit floating point normalized LMS filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @addtogroup LMSNorm
+   @{
+*/
+
+/**
+   @brief      Glue code for the 32-bit floating point normalized LMS filter.
+
+   Filters the next blockSize samples of the stream, and adapts the coefficients in S->pCoeffs
+   after every sample.
+
+   @param[in]   S          points to an instance of the normalized LMS structure
+   @param[in]   pSrc       points to the block of input samples
+   @param[in]   pRef       points to the block of reference (desired) samples
+   @param[in]   blockSize  number of samples to process, at most the blockSize given to
+                           plp_lms_norm_init_f32
+   @param[out]  pOut       points to the block of filter outputs
+   @param[out]  pErr       points to the block of errors, pRef - pOut
+   @return      none
+*/
+void plp_lms_norm_f32(plp_lms_norm_instance_f32 *S,
+                      const float32_t *__restrict__ pSrc,
+                      const float32_t *__restrict__ pRef,
+                      uint32_t blockSize,
+                      float32_t *__restrict__ pOut,
+                      float32_t *__restrict__ pErr) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("F extension is supported only for cluster side\n");
+        return;
+    }
+
+    plp_lms_norm_f32s_xpulpv2(S, pSrc, pRef, blockSize, pOut, pErr);
+}
+
+/**
+   @} end of LMSNorm group
+*/
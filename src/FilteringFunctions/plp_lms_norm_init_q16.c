@@ -0,0 +1,91 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_lms_norm_init_q16.c
+ * Description:  Initialization of the 16-bit fixed point normalized LMS filter instance
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupFilters
+*/
+
+/**
+   @defgroup LMSNorm Normalized Least Mean Square (NLMS) Filters
+   This module contains the glue code for the adaptive normalized LMS filters. The kernel codes
+   (kernels) are in the Module NLMS Filter Kernels.
+
+   The normalized LMS filter works like the LMS filter (see LMS), but the step size is divided by
+   the energy of the samples in the delay line, b[k] += mu e[n] x[n - k] / E[n] with
+   E[n] = sum_k x[n - k]^2. This makes the convergence independent of the input level. The energy
+   is updated incrementally with the sample entering and the sample leaving the delay line.
+*/
+
+/**
+   @addtogroup LMSNorm
+   @{
+*/
+
+/**
+   @brief      Initialization of the 16-bit fixed point normalized LMS filter instance.
+
+   The delay line is cleared, i.e., the filter starts from zero initial conditions. The
+   coefficients are adapted in place.
+   All values (samples, coefficients and mu) have fracBits fractional bits.
+
+   @param[out]  S          points to an instance of the normalized LMS structure
+   @param[in]   numTaps    number of filter coefficients
+   @param[in]   pCoeffs    points to the numTaps initial coefficients in time-reversed order
+   @param[in]   pState     points to the state buffer of length numTaps + blockSize - 1
+   @param[in]   mu         step size
+   @param[in]   blockSize  maximum number of samples processed per call
+   @param[in]   fracBits   number of fractional bits of all values
+   @return      none
+*/
+void plp_lms_norm_init_q16(plp_lms_norm_instance_q16 *S,
+                           uint32_t numTaps,
+                           int16_t *pCoeffs,
+                           int16_t *pState,
+                           int16_t mu,
+                           uint32_t blockSize,
+                           uint32_t fracBits) {
+    uint32_t i;
+
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->mu = mu;
+    S->fracBits = fracBits;
+    S->energy = 0;
+    S->x0 = 0;
+
+    for (i = 0; i < numTaps + blockSize - 1; i++) {
+        pState[i] = 0;
+    }
+}
+
+/**
+   @} end of LMSNorm group
+*/
@@ -0,0 +1,232 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        rtos_hal_host.c
+ * Description:  Host (Linux/pthreads) implementation of the rtos_hal.h interface
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: x86 / ARM / RISC-V Linux hosts
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef RTOS_HOST
+
+#include <pthread.h>
+#include "rtos_hal.h"
+
+/* Every "core" is a thread. The thread running main() is the fabric controller. */
+static __thread int host_core_id = 0;
+static __thread int host_cluster_id = ARCHI_FC_CID;
+
+__thread hal_perf_t *hal_host_perf = NULL;
+
+/* State of the currently forked team. Like on PULP, only one team can be active at a time. */
+static pthread_barrier_t host_team_barrier;
+static int host_team_size = 1;
+
+typedef struct {
+    int core_id;
+    void (*entry)(void *);
+    void *arg;
+} host_team_member_t;
+
+int hal_core_id() {
+    return host_core_id;
+}
+
+int hal_cluster_id() {
+    return host_cluster_id;
+}
+
+uint32_t hal_cl_nb_pe_cores() {
+    return HAL_HOST_NB_PE;
+}
+
+void hal_team_barrier() {
+    if (host_team_size > 1) {
+        pthread_barrier_wait(&host_team_barrier);
+    }
+}
+
+static void *host_team_entry(void *arg) {
+    host_team_member_t *member = (host_team_member_t *)arg;
+    host_core_id = member->core_id;
+    host_cluster_id = 0;
+    member->entry(member->arg);
+    return NULL;
+}
+
+void hal_cl_team_fork(int nb_cores, void (*entry)(void *), void *arg) {
+    pthread_t threads[HAL_HOST_NB_PE];
+    host_team_member_t members[HAL_HOST_NB_PE];
+    int i;
+
+    if (nb_cores <= 0 || nb_cores > HAL_HOST_NB_PE) {
+        nb_cores = HAL_HOST_NB_PE;
+    }
+
+    host_team_size = nb_cores;
+    if (nb_cores > 1) {
+        pthread_barrier_init(&host_team_barrier, NULL, nb_cores);
+    }
+
+    for (i = 1; i < nb_cores; i++) {
+        members[i].core_id = i;
+        members[i].entry = entry;
+        members[i].arg = arg;
+        pthread_create(&threads[i], NULL, host_team_entry, &members[i]);
+    }
+
+    /* the master core takes part in the team as core 0, as on the cluster */
+    int saved_core_id = host_core_id;
+    int saved_cluster_id = host_cluster_id;
+    host_core_id = 0;
+    host_cluster_id = 0;
+    entry(arg);
+    host_core_id = saved_core_id;
+    host_cluster_id = saved_cluster_id;
+
+    for (i = 1; i < nb_cores; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    if (nb_cores > 1) {
+        pthread_barrier_destroy(&host_team_barrier);
+    }
+    host_team_size = 1;
+}
+
+void hal_host_cluster_call(void (*entry)(void *), void *arg) {
+    int saved_core_id = host_core_id;
+    int saved_cluster_id = host_cluster_id;
+    host_core_id = 0;
+    host_cluster_id = 0;
+    entry(arg);
+    host_core_id = saved_core_id;
+    host_cluster_id = saved_cluster_id;
+}
+
+/* L1 is emulated by a first-fit allocator on a static arena of HAL_HOST_L1_SIZE bytes, such that
+   code exceeding the TCDM capacity fails on the host just like it does on the target. The free
+   list is kept sorted by address so that neighbouring chunks can be merged. Every allocation is
+   preceded by a header of HOST_L1_ALIGN bytes holding the number of bytes granted, because a chunk
+   may be handed out with some slack, which free must return as well. */
+
+#define HOST_L1_ALIGN 8
+
+typedef struct host_l1_chunk {
+    uint32_t size;
+    struct host_l1_chunk *next;
+} host_l1_chunk_t;
+
+static uint8_t host_l1_arena[HAL_HOST_L1_SIZE] __attribute__((aligned(HOST_L1_ALIGN)));
+static host_l1_chunk_t *host_l1_free_list = NULL;
+static int host_l1_initialized = 0;
+static pthread_mutex_t host_l1_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint32_t host_l1_round(int size) {
+    uint32_t rounded = (uint32_t)size;
+    if (rounded < sizeof(host_l1_chunk_t)) {
+        rounded = sizeof(host_l1_chunk_t);
+    }
+    return (rounded + HOST_L1_ALIGN - 1) & ~(uint32_t)(HOST_L1_ALIGN - 1);
+}
+
+void *hal_host_l1_malloc(int size) {
+    uint32_t rounded = host_l1_round(size + HOST_L1_ALIGN);
+    host_l1_chunk_t **prev;
+    host_l1_chunk_t *chunk;
+    void *result = NULL;
+
+    pthread_mutex_lock(&host_l1_lock);
+
+    if (!host_l1_initialized) {
+        host_l1_free_list = (host_l1_chunk_t *)host_l1_arena;
+        host_l1_free_list->size = HAL_HOST_L1_SIZE;
+        host_l1_free_list->next = NULL;
+        host_l1_initialized = 1;
+    }
+
+    for (prev = &host_l1_free_list; (chunk = *prev) != NULL; prev = &chunk->next) {
+        if (chunk->size < rounded) {
+            continue;
+        }
+        if (chunk->size - rounded >= sizeof(host_l1_chunk_t)) {
+            /* hand out the tail of the chunk, the head stays in the free list */
+            chunk->size -= rounded;
+            result = (uint8_t *)chunk + chunk->size;
+        } else {
+            *prev = chunk->next;
+            rounded = chunk->size;
+            result = chunk;
+        }
+        /* the header holds the granted size, which becomes the size field of the free chunk */
+        ((host_l1_chunk_t *)result)->size = rounded;
+        result = (uint8_t *)result + HOST_L1_ALIGN;
+        break;
+    }
+
+    pthread_mutex_unlock(&host_l1_lock);
+
+    return result;
+}
+
+void hal_host_l1_free(void *ptr, int size) {
+    host_l1_chunk_t *chunk = (host_l1_chunk_t *)((uint8_t *)ptr - HOST_L1_ALIGN);
+    host_l1_chunk_t **prev;
+    host_l1_chunk_t *next;
+
+    (void)size;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&host_l1_lock);
+
+    for (prev = &host_l1_free_list; *prev != NULL && *prev < chunk; prev = &(*prev)->next)
+        ;
+    next = *prev;
+
+    /* merge with the following chunk */
+    if (next != NULL && (uint8_t *)chunk + chunk->size == (uint8_t *)next) {
+        chunk->size += next->size;
+        next = next->next;
+    }
+    chunk->next = next;
+
+    /* merge with the preceding chunk */
+    if (prev != &host_l1_free_list) {
+        host_l1_chunk_t *before =
+            (host_l1_chunk_t *)((uint8_t *)prev - __builtin_offsetof(host_l1_chunk_t, next));
+        if ((uint8_t *)before + before->size == (uint8_t *)chunk) {
+            before->size += chunk->size;
+            before->next = chunk->next;
+            chunk = NULL;
+        }
+    }
+    if (chunk != NULL) {
+        *prev = chunk;
+    }
+
+    pthread_mutex_unlock(&host_l1_lock);
+}
+
+#endif
@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32p_xpulpv2.c
+ * Description:  parallel Cholesky decomposition of 32-bit floating-point matrices for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholesky
+ */
+
+/**
+  @addtogroup MatCholeskyKernels
+  @{
+ */
+
+/**
+  @brief Parallel Cholesky decomposition of 32-bit floating-point matrices kernel for XPULPV2
+  extension.
+  @param[in]  args  pointer to plp_mat_cholesky_instance_f32 struct initialized by
+                    plp_mat_cholesky_f32_parallel
+  @return     none
+
+  @par Parallelization
+  The diagonal element of each column is computed redundantly by all cores, which avoids a
+  barrier. The elements below the diagonal are independent of each other and distributed in an
+  interleaved fashion over the cores. There is a single team barrier per column. The result
+  (0: Success, 1: Matrix is not positive definite) is written to args->ret.
+ */
+
+void plp_mat_cholesky_f32p_xpulpv2(void *args) {
+
+    plp_mat_cholesky_instance_f32 *a = (plp_mat_cholesky_instance_f32 *)args;
+
+    const float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        float *pRowJ = &pDst[j * N];
+
+        /* diagonal element */
+        float sum = pSrc[j * N + j];
+        for (k = 0; k < j; k++) {
+            sum -= pRowJ[k] * pRowJ[k];
+        }
+
+        if (sum <= 0.0f) {
+            if (core_id == 0) {
+                a->ret = 1;
+            }
+            return;
+        }
+
+        float diag;
+        plp_sqrt_f32(&sum, &diag);
+        float diagInv = 1.0f / diag;
+
+        if (core_id == 0) {
+            pRowJ[j] = diag;
+            for (k = j + 1; k < N; k++) {
+                pRowJ[k] = 0.0f;
+            }
+        }
+
+        /* elements below the diagonal */
+        for (i = j + 1 + core_id; i < N; i += nPE) {
+            float *pRowI = &pDst[i * N];
+            float acc = pSrc[i * N + j];
+            for (k = 0; k < j; k++) {
+                acc -= pRowI[k] * pRowJ[k];
+            }
+            pRowI[j] = acc * diagInv;
+        }
+
+        hal_team_barrier();
+    }
+}
+
+/**
+  @} end of MatCholeskyKernels group
+ */
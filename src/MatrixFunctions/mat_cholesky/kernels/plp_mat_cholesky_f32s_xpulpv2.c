@@ -0,0 +1,113 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32s_xpulpv2.c
+ * Description:  Cholesky decomposition of 32-bit floating-point matrices for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholesky
+ */
+
+/**
+  @defgroup MatCholeskyKernels Cholesky decomposition Kernels
+  This module contains the kernel code for the Cholesky decomposition.
+
+  The Cholesky decomposition factors a symmetric positive definite matrix A into a lower
+  triangular matrix L with positive diagonal, such that
+
+  \f[
+    A = L \cdot L^T
+  \f]
+
+  It needs half of the operations of the LU decomposition and no pivoting. Once A is factorized,
+  the linear system A x = b can be solved for any right-hand side b in O(N^2) operations with
+  forward and backward substitution (see plp_mat_solve_cholesky_f32).
+
+  @par Algorithm
+  The columns of L are computed from left to right (Cholesky-Crout). Only the lower triangle of
+  pSrc is read, and the upper triangle of pDst is set to zero. If a diagonal element is not
+  positive, the matrix is not positive definite, and the decomposition is aborted.
+ */
+
+/**
+  @addtogroup MatCholeskyKernels
+  @{
+ */
+
+/**
+  @brief Cholesky decomposition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc Points to the symmetric positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite
+ */
+
+int plp_mat_cholesky_f32s_xpulpv2(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  float *__restrict__ pDst) {
+
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        float *pRowJ = &pDst[j * N];
+
+        /* diagonal element */
+        float sum = pSrc[j * N + j];
+        for (k = 0; k < j; k++) {
+            sum -= pRowJ[k] * pRowJ[k];
+        }
+
+        if (sum <= 0.0f) {
+            return 1;
+        }
+
+        float diag;
+        plp_sqrt_f32(&sum, &diag);
+        float diagInv = 1.0f / diag;
+
+        pRowJ[j] = diag;
+        for (k = j + 1; k < N; k++) {
+            pRowJ[k] = 0.0f;
+        }
+
+        /* elements below the diagonal */
+        for (i = j + 1; i < N; i++) {
+            float *pRowI = &pDst[i * N];
+            float acc = pSrc[i * N + j];
+            for (k = 0; k < j; k++) {
+                acc -= pRowI[k] * pRowJ[k];
+            }
+            pRowI[j] = acc * diagInv;
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatCholeskyKernels group
+ */
@@ -0,0 +1,112 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_q32s_xpulpv2.c
+ * Description:  Cholesky decomposition of 32-bit fix-point matrices for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatCholesky
+ */
+
+/**
+  @addtogroup MatCholeskyKernels
+  @{
+ */
+
+/* floor of the square root of a 64-bit number, computed bit by bit */
+static uint32_t plp_mat_cholesky_q32_isqrt(uint64_t x) {
+    uint64_t res = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)res;
+}
+
+/**
+  @brief Cholesky decomposition of 32-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in]  pSrc     Points to the symmetric positive definite input matrix
+  @param[in]  N        Width and height of both matrices
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite
+ */
+
+int plp_mat_cholesky_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t fracBits,
+                                  int32_t *__restrict__ pDst) {
+
+    uint32_t i, j, k;
+
+    for (j = 0; j < N; j++) {
+        int32_t *pRowJ = &pDst[j * N];
+
+        /* diagonal element */
+        int64_t sum = (int64_t)pSrc[j * N + j] << fracBits;
+        for (k = 0; k < j; k++) {
+            sum -= (int64_t)pRowJ[k] * pRowJ[k];
+        }
+
+        int32_t diag = sum > 0 ? (int32_t)plp_mat_cholesky_q32_isqrt((uint64_t)sum) : 0;
+
+        if (diag == 0) {
+            return 1;
+        }
+
+        pRowJ[j] = diag;
+        for (k = j + 1; k < N; k++) {
+            pRowJ[k] = 0;
+        }
+
+        /* elements below the diagonal */
+        for (i = j + 1; i < N; i++) {
+            int32_t *pRowI = &pDst[i * N];
+            int64_t acc = (int64_t)pSrc[i * N + j] << fracBits;
+            for (k = 0; k < j; k++) {
+                acc -= (int64_t)pRowI[k] * pRowJ[k];
+            }
+            pRowI[j] = (int32_t)(acc / diag);
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatCholeskyKernels group
+ */
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32.c
+ * Description:  Cholesky decomposition of 32-bit floating-point matrices glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatCholesky Cholesky decomposition
+  This module contains the glue code for the Cholesky decomposition. The kernel codes (kernels)
+  are in the Module Cholesky decomposition Kernels.
+
+  The Cholesky decomposition factors a symmetric positive definite matrix A into a lower
+  triangular matrix L with positive diagonal, such that
+
+  \f[
+    A = L \cdot L^T
+  \f]
+
+  It needs half of the operations of the LU decomposition and no pivoting. Once A is factorized,
+  the linear system A x = b can be solved for any right-hand side b in O(N^2) operations with
+  forward and backward substitution (see plp_mat_solve_cholesky_f32).
+
+  @par Algorithm
+  The columns of L are computed from left to right (Cholesky-Crout). Only the lower triangle of
+  pSrc is read, and the upper triangle of pDst is set to zero. If a diagonal element is not
+  positive, the matrix is not positive definite, and the decomposition is aborted.
+
+  There are functions for 32-bit floating-point and 32-bit fix-point matrices.
+ */
+
+/**
+  @addtogroup MatCholesky
+  @{
+ */
+
+/**
+  @brief Glue code for Cholesky decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the symmetric positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[out] pDst Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+
+  @par This function will use plp_mat_cholesky_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_cholesky_f32(const float *__restrict__ pSrc, uint32_t N, float *__restrict__ pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_cholesky_f32s_xpulpv2(pSrc, N, pDst);
+    }
+}
+
+/**
+  @} end of MatCholesky group
+ */
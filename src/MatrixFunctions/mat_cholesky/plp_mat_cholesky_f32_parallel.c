@@ -0,0 +1,70 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_cholesky_f32_parallel.c
+ * Description:  parallel Cholesky decomposition of 32-bit floating-point matrices glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatCholesky
+  @{
+ */
+
+/**
+  @brief Glue code for parallel Cholesky decomposition of 32-bit floating-point matrices.
+  @param[in]  pSrc Points to the symmetric positive definite input matrix
+  @param[in]  N    Width and height of both matrices
+  @param[in]  nPE  Number of cores to use for computation
+  @param[out] pDst Points to the lower triangular output matrix
+  @return     0: Success, 1: Matrix is not positive definite, 2: operation not supported
+
+  @par This function will use plp_mat_cholesky_f32p_xpulpv2 for its computation.
+ */
+
+int plp_mat_cholesky_f32_parallel(const float *__restrict__ pSrc,
+                                  uint32_t N,
+                                  uint32_t nPE,
+                                  float *__restrict__ pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return 2;
+    } else {
+        plp_mat_cholesky_instance_f32 args = {
+            .pSrc = pSrc, .N = N, .nPE = nPE, .pDst = pDst, .ret = 0
+        };
+        hal_cl_team_fork(nPE, plp_mat_cholesky_f32p_xpulpv2, (void *)&args);
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatCholesky group
+ */
@@ -64,8 +64,11 @@ void plp_mat_fill_I_q16p_xpulpv2(void *args) {
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int i = core_id; i < N; i += nPE) {
-        for (int j = 0; j < N; j++) {
+    plp_mat_tile tile;
+    plp_mat_partition(N, N, 1, nPE, core_id, &tile);
+
+    for (int i = tile.rowStart; i < tile.rowEnd; i++) {
+        for (int j = tile.colStart; j < tile.colEnd; j++) {
             pDst[i * N + j] = (int16_t)(i == j) << fracBits;
         }
     }
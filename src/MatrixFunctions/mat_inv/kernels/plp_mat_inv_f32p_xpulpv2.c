@@ -43,16 +43,140 @@
    @brief Parallel matrix inversion of 32-bit floating-point matrices kernel for XPULPV2 extension.
    @param[in]  args  pointer to plp_mat_inv_instance_f32 struct initialized by
                     plp_mat_inv_f32_parallel
-   @return     0: Success, 1: Matrix is singular
+   @return     none
 
-   @warn Not yet implemented
+   @par Parallelization
+   Gauss-Jordan elimination with partial pivoting on the augmented matrix [pSrc | pDst]. For every
+   pivot column, core 0 searches the row with the largest magnitude. The pivot row exchange and
+   normalization are then split over the columns of the augmented matrix, and the elimination of
+   all other rows is split over the rows. The steps are separated by team barriers. The result
+   (0: Success, 1: Matrix is singular) is written to args->ret.
 */
 
-int plp_mat_inv_f32p_xpulpv2(void *args) {
+void plp_mat_inv_f32p_xpulpv2(void *args) {
 
-    // TODO
+    plp_mat_inv_instance_f32 *a = (plp_mat_inv_instance_f32 *)args;
 
-    return 1;
+    float *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, j, l;
+
+    /* rows of the augmented matrix processed by this core during elimination */
+    uint32_t rowStep = (N + nPE - 1) / nPE;
+    uint32_t rowStart = core_id * rowStep;
+    uint32_t rowEnd = rowStart + rowStep;
+    if (rowStart > N) {
+        rowStart = N;
+    }
+    if (rowEnd > N) {
+        rowEnd = N;
+    }
+
+    /* initialize the destination as identity matrix */
+    for (i = rowStart; i < rowEnd; i++) {
+        for (j = 0; j < N; j++) {
+            pDst[i * N + j] = 0.0f;
+        }
+        pDst[i * N + i] = 1.0f;
+    }
+
+    if (core_id == 0) {
+        a->ret = 0;
+    }
+
+    hal_team_barrier();
+
+    for (l = 0; l < N; l++) {
+
+        /* search the pivot in column l, on or below the diagonal */
+        if (core_id == 0) {
+            uint32_t pivot = l;
+            float maxAbs = 0.0f;
+            for (i = l; i < N; i++) {
+                float val = pSrc[i * N + l];
+                float absVal = val < 0.0f ? -val : val;
+                if (absVal > maxAbs) {
+                    maxAbs = absVal;
+                    pivot = i;
+                }
+            }
+            if (maxAbs == 0.0f) {
+                a->ret = 1;
+            } else {
+                a->pivot = pivot;
+                a->pivotInv = 1.0f / pSrc[pivot * N + l];
+            }
+        }
+
+        hal_team_barrier();
+
+        if (a->ret != 0) {
+            return;
+        }
+
+        /* exchange row l with the pivot row and normalize it. The columns left of l are zero in
+           both rows of pSrc, so only the 2N - l columns of the augmented matrix starting at
+           column l are processed. */
+        uint32_t pivot = a->pivot;
+        float pivotInv = a->pivotInv;
+        uint32_t width = 2 * N - l;
+        uint32_t colStep = (width + nPE - 1) / nPE;
+        uint32_t colStart = core_id * colStep;
+        uint32_t colEnd = colStart + colStep;
+        if (colEnd > width) {
+            colEnd = width;
+        }
+
+        for (j = colStart; j < colEnd; j++) {
+            float *pRowL;
+            float *pRowP;
+            if (j < N - l) {
+                pRowL = &pSrc[l * N + l + j];
+                pRowP = &pSrc[pivot * N + l + j];
+            } else {
+                pRowL = &pDst[l * N + j - (N - l)];
+                pRowP = &pDst[pivot * N + j - (N - l)];
+            }
+            float tmp = *pRowP;
+            *pRowP = *pRowL;
+            *pRowL = tmp * pivotInv;
+        }
+
+        hal_team_barrier();
+
+        /* eliminate column l from all other rows */
+        float *pPivotRowSrc = &pSrc[l * N];
+        float *pPivotRowDst = &pDst[l * N];
+
+        for (i = rowStart; i < rowEnd; i++) {
+            if (i == l) {
+                continue;
+            }
+
+            float *pRowSrc = &pSrc[i * N];
+            float *pRowDst = &pDst[i * N];
+            float factor = pRowSrc[l];
+
+            if (factor == 0.0f) {
+                continue;
+            }
+
+            pRowSrc[l] = 0.0f;
+            for (j = l + 1; j < N; j++) {
+                pRowSrc[j] -= factor * pPivotRowSrc[j];
+            }
+            for (j = 0; j < N; j++) {
+                pRowDst[j] -= factor * pPivotRowDst[j];
+            }
+        }
+
+        hal_team_barrier();
+    }
 }
 
 /**
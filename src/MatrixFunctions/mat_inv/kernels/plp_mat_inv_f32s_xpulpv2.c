@@ -179,13 +179,16 @@ int plp_mat_inv_f32s_xpulpv2(float *__restrict__ pSrc, uint32_t N, float *__rest
         /* Destination pointer modifier */
         k = 1U;
 
+        /* No exchange done yet for this column */
+        flag = 0U;
+
         /* Check if the pivot element is zero */
         if (*pSrcT1 == 0.0f) {
             /* Loop over the number rows present below */
 
             for (i = (l + 1U); i < M; i++) {
                 /* Update the input and destination pointers */
-                pSrcT2 = pSrcT1 + (N * i);
+                pSrcT2 = pSrcT1 + (N * k);
                 pDstT2 = pDstT1 + (N * k);
 
                 /* Check if there is a non zero pivot element to
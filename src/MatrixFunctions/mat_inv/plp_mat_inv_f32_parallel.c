@@ -47,8 +47,7 @@
   @param[out] pDst Points to the output matrix
   @return     0: Success, 1: Matrix is singular, 2: operation not supported
 
-  @warn This function is not yet implemented in parallel, and it will call the
-  single-core implementation!
+  @par This function will use plp_mat_inv_f32p_xpulpv2 for its computation.
  */
 
 int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
@@ -60,8 +59,13 @@ int plp_mat_inv_f32_parallel(float *__restrict__ pSrc,
         printf("parallel and floating-point processing supported only for cluster side\n");
         return 2;
     } else {
-        // TODO, for now, we only call the singlecore implementation, until it is implemented
-        return plp_mat_inv_f32s_xpulpv2(pSrc, N, pDst);
+        plp_mat_inv_instance_f32 args = {
+            .pSrc = pSrc, .N = N, .nPE = nPE, .pDst = pDst, .pivot = 0, .pivotInv = 0.0f, .ret = 0
+        };
+
+        hal_cl_team_fork(nPE, plp_mat_inv_f32p_xpulpv2, (void *)&args);
+
+        return args.ret;
     }
 }
 
@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32s_xpulpv2.c
+ * Description:  LU decomposition of 32-bit floating-point matrices for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @defgroup MatLUKernels LU decomposition Kernels
+  This module contains the kernel code for the LU decomposition.
+
+  The LU decomposition factors a square matrix A into a lower triangular matrix L with unit
+  diagonal and an upper triangular matrix U, such that
+
+  \f[
+    P \cdot A = L \cdot U
+  \f]
+
+  where P is a permutation matrix. Once A is factorized, the linear system A x = b can be solved
+  for any right-hand side b in O(N^2) operations with forward and backward substitution (see
+  plp_mat_solve_lu_f32), instead of computing the inverse in O(N^3).
+
+  @par Algorithm
+  The factorization is computed in-place with Gaussian elimination and partial pivoting: in every
+  step, the row with the largest magnitude in the current column is exchanged with the current
+  row. L (without its unit diagonal) is stored below the diagonal of pSrc and U on and above the
+  diagonal. Row i of P * A is row pPerm[i] of A.
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+  @brief LU decomposition of 32-bit floating-point matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrc  Points to the input matrix, overwritten with L and U
+  @param[in]     N     Width and height of the matrix
+  @param[out]    pPerm Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_lu_f32s_xpulpv2(float *__restrict__ pSrc, uint32_t N, uint32_t *__restrict__ pPerm) {
+
+    uint32_t i, j, k;
+
+    for (i = 0; i < N; i++) {
+        pPerm[i] = i;
+    }
+
+    for (k = 0; k < N; k++) {
+
+        /* search the row with the largest magnitude in column k */
+        uint32_t pivot = k;
+        float maxAbs = 0.0f;
+        for (i = k; i < N; i++) {
+            float val = pSrc[i * N + k];
+            float absVal = val < 0.0f ? -val : val;
+            if (absVal > maxAbs) {
+                maxAbs = absVal;
+                pivot = i;
+            }
+        }
+
+        if (maxAbs == 0.0f) {
+            return 1;
+        }
+
+        float *pRowK = &pSrc[k * N];
+
+        if (pivot != k) {
+            float *pRowP = &pSrc[pivot * N];
+            for (j = 0; j < N; j++) {
+                float tmp = pRowK[j];
+                pRowK[j] = pRowP[j];
+                pRowP[j] = tmp;
+            }
+            uint32_t tmpPerm = pPerm[k];
+            pPerm[k] = pPerm[pivot];
+            pPerm[pivot] = tmpPerm;
+        }
+
+        float pivotInv = 1.0f / pRowK[k];
+
+        /* eliminate column k below the diagonal */
+        for (i = k + 1; i < N; i++) {
+            float *pRowI = &pSrc[i * N];
+            float factor = pRowI[k] * pivotInv;
+            pRowI[k] = factor;
+            for (j = k + 1; j < N; j++) {
+                pRowI[j] -= factor * pRowK[j];
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatLUKernels group
+ */
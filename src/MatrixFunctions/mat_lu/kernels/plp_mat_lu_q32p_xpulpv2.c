@@ -0,0 +1,128 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_q32p_xpulpv2.c
+ * Description:  parallel LU decomposition of 32-bit fix-point matrices for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+  @brief Parallel LU decomposition of 32-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_lu_instance_q32 struct initialized by
+                    plp_mat_lu_q32_parallel
+  @return     none
+
+  @par Parallelization
+  For every column, core 0 searches the pivot and exchanges the rows. Then, the rows below the
+  pivot are distributed in an interleaved fashion over all cores. The result is identical to
+  plp_mat_lu_q32s_xpulpv2 and written to args->ret (0: Success, 1: Matrix is singular).
+ */
+
+void plp_mat_lu_q32p_xpulpv2(void *args) {
+
+    plp_mat_lu_instance_q32 *a = (plp_mat_lu_instance_q32 *)args;
+
+    int32_t *__restrict__ pSrc = a->pSrc;
+    uint32_t N = a->N;
+    uint32_t fracBits = a->fracBits;
+    uint32_t nPE = a->nPE;
+    uint32_t *__restrict__ pPerm = a->pPerm;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, j, k;
+
+    for (k = 0; k < N; k++) {
+
+        if (core_id == 0) {
+            if (k == 0) {
+                for (i = 0; i < N; i++) {
+                    pPerm[i] = i;
+                }
+            }
+
+            /* search the row with the largest magnitude in column k */
+            uint32_t pivot = k;
+            int32_t maxAbs = 0;
+            for (i = k; i < N; i++) {
+                int32_t val = pSrc[i * N + k];
+                int32_t absVal = val < 0 ? -val : val;
+                if (absVal > maxAbs) {
+                    maxAbs = absVal;
+                    pivot = i;
+                }
+            }
+
+            if (maxAbs == 0) {
+                a->ret = 1;
+            } else if (pivot != k) {
+                int32_t *pRowK = &pSrc[k * N];
+                int32_t *pRowP = &pSrc[pivot * N];
+                for (j = 0; j < N; j++) {
+                    int32_t tmp = pRowK[j];
+                    pRowK[j] = pRowP[j];
+                    pRowP[j] = tmp;
+                }
+                uint32_t tmpPerm = pPerm[k];
+                pPerm[k] = pPerm[pivot];
+                pPerm[pivot] = tmpPerm;
+            }
+        }
+
+        hal_team_barrier();
+
+        if (a->ret != 0) {
+            return;
+        }
+
+        int32_t *pRowK = &pSrc[k * N];
+        int32_t pivotVal = pRowK[k];
+
+        /* eliminate column k below the diagonal */
+        for (i = k + 1 + core_id; i < N; i += nPE) {
+            int32_t *pRowI = &pSrc[i * N];
+            int32_t factor = (int32_t)(((int64_t)pRowI[k] << fracBits) / pivotVal);
+            pRowI[k] = factor;
+            for (j = k + 1; j < N; j++) {
+                pRowI[j] -= (int32_t)(((int64_t)factor * pRowK[j]) >> fracBits);
+            }
+        }
+
+        hal_team_barrier();
+    }
+}
+
+/**
+  @} end of MatLUKernels group
+ */
@@ -0,0 +1,110 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_q32s_xpulpv2.c
+ * Description:  LU decomposition of 32-bit fix-point matrices for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatLU
+ */
+
+/**
+  @addtogroup MatLUKernels
+  @{
+ */
+
+/**
+  @brief LU decomposition of 32-bit fix-point matrices kernel for XPULPV2 extension.
+  @param[in,out] pSrc     Points to the input matrix, overwritten with L and U
+  @param[in]     N        Width and height of the matrix
+  @param[in]     fracBits Number of fractional bits
+  @param[out]    pPerm    Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular
+ */
+
+int plp_mat_lu_q32s_xpulpv2(int32_t *__restrict__ pSrc,
+                            uint32_t N,
+                            uint32_t fracBits,
+                            uint32_t *__restrict__ pPerm) {
+
+    uint32_t i, j, k;
+
+    for (i = 0; i < N; i++) {
+        pPerm[i] = i;
+    }
+
+    for (k = 0; k < N; k++) {
+
+        /* search the row with the largest magnitude in column k */
+        uint32_t pivot = k;
+        int32_t maxAbs = 0;
+        for (i = k; i < N; i++) {
+            int32_t val = pSrc[i * N + k];
+            int32_t absVal = val < 0 ? -val : val;
+            if (absVal > maxAbs) {
+                maxAbs = absVal;
+                pivot = i;
+            }
+        }
+
+        if (maxAbs == 0) {
+            return 1;
+        }
+
+        int32_t *pRowK = &pSrc[k * N];
+
+        if (pivot != k) {
+            int32_t *pRowP = &pSrc[pivot * N];
+            for (j = 0; j < N; j++) {
+                int32_t tmp = pRowK[j];
+                pRowK[j] = pRowP[j];
+                pRowP[j] = tmp;
+            }
+            uint32_t tmpPerm = pPerm[k];
+            pPerm[k] = pPerm[pivot];
+            pPerm[pivot] = tmpPerm;
+        }
+
+        int32_t pivotVal = pRowK[k];
+
+        /* eliminate column k below the diagonal */
+        for (i = k + 1; i < N; i++) {
+            int32_t *pRowI = &pSrc[i * N];
+            int32_t factor = (int32_t)(((int64_t)pRowI[k] << fracBits) / pivotVal);
+            pRowI[k] = factor;
+            for (j = k + 1; j < N; j++) {
+                pRowI[j] -= (int32_t)(((int64_t)factor * pRowK[j]) >> fracBits);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+  @} end of MatLUKernels group
+ */
@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_f32.c
+ * Description:  LU decomposition of 32-bit floating-point matrices glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatLU LU decomposition
+  This module contains the glue code for the LU decomposition. The kernel codes (kernels) are in
+  the Module LU decomposition Kernels.
+
+  The LU decomposition factors a square matrix A into a lower triangular matrix L with unit
+  diagonal and an upper triangular matrix U, such that
+
+  \f[
+    P \cdot A = L \cdot U
+  \f]
+
+  where P is a permutation matrix. Once A is factorized, the linear system A x = b can be solved
+  for any right-hand side b in O(N^2) operations with forward and backward substitution (see
+  plp_mat_solve_lu_f32), instead of computing the inverse in O(N^3).
+
+  @par Algorithm
+  The factorization is computed in-place with Gaussian elimination and partial pivoting: in every
+  step, the row with the largest magnitude in the current column is exchanged with the current
+  row. L (without its unit diagonal) is stored below the diagonal of pSrc and U on and above the
+  diagonal. Row i of P * A is row pPerm[i] of A.
+
+  There are functions for 32-bit floating-point and 32-bit fix-point matrices.
+ */
+
+/**
+  @addtogroup MatLU
+  @{
+ */
+
+/**
+  @brief Glue code for LU decomposition of 32-bit floating-point matrices.
+  @param[in,out] pSrc  Points to the input matrix, overwritten with L and U
+  @param[in]     N     Width and height of the matrix
+  @param[out]    pPerm Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par This function will use plp_mat_lu_f32s_xpulpv2 for its computation.
+ */
+
+int plp_mat_lu_f32(float *__restrict__ pSrc, uint32_t N, uint32_t *__restrict__ pPerm) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return 2;
+    } else {
+        return plp_mat_lu_f32s_xpulpv2(pSrc, N, pPerm);
+    }
+}
+
+/**
+  @} end of MatLU group
+ */
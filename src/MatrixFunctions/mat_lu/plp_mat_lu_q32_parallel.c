@@ -0,0 +1,75 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_lu_q32_parallel.c
+ * Description:  parallel LU decomposition of 32-bit fix-point matrices glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatLU
+  @{
+ */
+
+/**
+  @brief Glue code for parallel LU decomposition of 32-bit fix-point matrices.
+  @param[in,out] pSrc     Points to the input matrix, overwritten with L and U
+  @param[in]     N        Width and height of the matrix
+  @param[in]     fracBits Number of fractional bits
+  @param[in]     nPE      Number of cores to use for computation
+  @param[out]    pPerm    Points to the row permutation, of length N
+  @return        0: Success, 1: Matrix is singular, 2: operation not supported
+
+  @par Fix-Point
+  All values are represented in fix-point with fracBits fractional bits (the matrix A is
+  represented as pSrc * 2^-fracBits). The same representation is used for L and U. Products are
+  computed with 64 bits and rounded towards minus infinity.
+ */
+
+int plp_mat_lu_q32_parallel(int32_t *__restrict__ pSrc,
+                            uint32_t N,
+                            uint32_t fracBits,
+                            uint32_t nPE,
+                            uint32_t *__restrict__ pPerm) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return 2;
+    } else {
+        plp_mat_lu_instance_q32 args = {
+            .pSrc = pSrc, .N = N, .fracBits = fracBits, .nPE = nPE, .pPerm = pPerm, .ret = 0
+        };
+        hal_cl_team_fork(nPE, plp_mat_lu_q32p_xpulpv2, (void *)&args);
+        return args.ret;
+    }
+}
+
+/**
+  @} end of MatLU group
+ */
@@ -66,8 +66,11 @@ void plp_mat_mult_f32p_xpulpv2(void *args) {
 
     uint32_t m, n, o;
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 1, nPE, core_id, &tile);
+
+    for (m = tile.rowStart; m < tile.rowEnd; m++) {
+        for (o = tile.colStart; o < tile.colEnd; o++) {
             float sum = 0;
             for (n = 0; n < N; n++) {
                 sum = sum + pSrcA[m * N + n] * pSrcB[n * O + o];
@@ -70,8 +70,11 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
 
     int core_id = hal_core_id();
 
-    for (i = core_id; i < M; i += nPE) {
-        for (k = 0; k < O; k++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 1, nPE, core_id, &tile);
+
+    for (i = tile.rowStart; i < tile.rowEnd; i++) {
+        for (k = tile.colStart; k < tile.colEnd; k++) {
             int16_t sum = 0;
             for (j = 0; j < N; j++) {
                 sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
@@ -95,14 +98,22 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
     uint32_t nPE = arguments->nPE;
     int32_t *__restrict__ pDstC = arguments->pDstC;
 
-    uint32_t i = 0; // loop counter for M
-    uint32_t j = 0; // loop counter for N
-    uint32_t k = 0; // loop counter for O
+    uint32_t i; // loop counter for M
+    uint32_t j; // loop counter for N
+    uint32_t k; // loop counter for O
 
     int core_id = hal_core_id();
 
-    for (k = core_id; k < O / 2; k += nPE) {
-        for (i = 0; i < M / 4; i++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 2, nPE, core_id, &tile);
+
+    // rows and columns of the tile covered by 4x2 blocks
+    uint32_t MEnd = tile.rowStart + ((tile.rowEnd - tile.rowStart) & ~3U);
+    uint32_t OEnd = tile.colStart + ((tile.colEnd - tile.colStart) & ~1U);
+    uint32_t NEnd = N & ~1U; // elements covered by the SIMD dot products
+
+    for (k = tile.colStart; k < OEnd; k += 2) {
+        for (i = tile.rowStart; i < MEnd; i += 4) {
 
             int32_t sum00 = 0;
             int32_t sum01 = 0;
@@ -113,17 +124,15 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
             int32_t sum30 = 0;
             int32_t sum31 = 0;
 
-            // v2s* Bpoint = (v2s*) &(pSrcB[k]);
+            for (j = 0; j < NEnd; j += 2) {
 
-            for (j = 0; j < N / 2; j++) {
+                v2s aVec0 = *((v2s *)&(pSrcA[i * N + j]));
+                v2s aVec1 = *((v2s *)&(pSrcA[(i + 1) * N + j]));
+                v2s aVec2 = *((v2s *)&(pSrcA[(i + 2) * N + j]));
+                v2s aVec3 = *((v2s *)&(pSrcA[(i + 3) * N + j]));
 
-                v2s aVec0 = *((v2s *)&(pSrcA[(i * 4) * N + (j * 2)]));
-                v2s aVec1 = *((v2s *)&(pSrcA[(i * 4 + 1) * N + (j * 2)]));
-                v2s aVec2 = *((v2s *)&(pSrcA[(i * 4 + 2) * N + (j * 2)]));
-                v2s aVec3 = *((v2s *)&(pSrcA[(i * 4 + 3) * N + (j * 2)]));
-
-                v2s bTemp0 = *((v2s *)&(pSrcB[(j * 2) * O + (k * 2)]));
-                v2s bTemp1 = *((v2s *)&(pSrcB[(j * 2 + 1) * O + (k * 2)]));
+                v2s bTemp0 = *((v2s *)&(pSrcB[j * O + k]));
+                v2s bTemp1 = *((v2s *)&(pSrcB[(j + 1) * O + k]));
 
                 v2s bVec0 = __builtin_shuffle(bTemp0, bTemp1, (v2s){ 0, 2 });
                 v2s bVec1 = __builtin_shuffle(bTemp0, bTemp1, (v2s){ 1, 3 });
@@ -138,68 +147,71 @@ void plp_mat_mult_i16p_xpulpv2(void *args) {
                 sum31 = __SUMDOTP2(aVec3, bVec1, sum31);
             }
 
-            pDstC[(i * 4) * O + (k * 2)] = sum00;
-            pDstC[(i * 4) * O + (k * 2 + 1)] = sum01;
-            pDstC[(i * 4 + 1) * O + (k * 2)] = sum10;
-            pDstC[(i * 4 + 1) * O + (k * 2 + 1)] = sum11;
-            pDstC[(i * 4 + 2) * O + (k * 2)] = sum20;
-            pDstC[(i * 4 + 2) * O + (k * 2 + 1)] = sum21;
-            pDstC[(i * 4 + 3) * O + (k * 2)] = sum30;
-            pDstC[(i * 4 + 3) * O + (k * 2 + 1)] = sum31;
+            // last element of the inner dimension, if N is odd
+            if (NEnd != N) {
+                int32_t b0 = pSrcB[NEnd * O + k];
+                int32_t b1 = pSrcB[NEnd * O + k + 1];
+                int32_t a0 = pSrcA[i * N + NEnd];
+                int32_t a1 = pSrcA[(i + 1) * N + NEnd];
+                int32_t a2 = pSrcA[(i + 2) * N + NEnd];
+                int32_t a3 = pSrcA[(i + 3) * N + NEnd];
+
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+                sum20 += a2 * b0;
+                sum21 += a2 * b1;
+                sum30 += a3 * b0;
+                sum31 += a3 * b1;
+            }
+
+            pDstC[i * O + k] = sum00;
+            pDstC[i * O + k + 1] = sum01;
+            pDstC[(i + 1) * O + k] = sum10;
+            pDstC[(i + 1) * O + k + 1] = sum11;
+            pDstC[(i + 2) * O + k] = sum20;
+            pDstC[(i + 2) * O + k + 1] = sum21;
+            pDstC[(i + 3) * O + k] = sum30;
+            pDstC[(i + 3) * O + k + 1] = sum31;
         }
-    }
 
-    // clean up code
-    i = i * 4;
-    j = j * 2;
-    k = k * 2;
-    // check if every index is nicely finished
-    if (i == M && j == N && k >= O) {
-
-    } else {
-        uint32_t iEnd = i;
-        uint32_t jEnd = j;
-        uint32_t kEnd = k >= O ? O : k;
-
-        // clean up for j
-        if (jEnd != N) {
-            for (k = core_id * 2; k < kEnd; k += nPE * 2) {
-                for (int step = 0; step < 2; step++) {
-                    for (i = 0; i < iEnd; i++) {
-                        int32_t sum = 0;
-                        for (j = jEnd; j < N; j++) {
-                            sum += sum + pSrcA[i * N + j] * pSrcB[j * O + k + step];
-                        }
-                        pDstC[i * O + k + step] += sum;
-                    }
-                }
+        // remaining rows of the tile, computed as 1x2 blocks
+        for (i = MEnd; i < tile.rowEnd; i++) {
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+
+            for (j = 0; j < NEnd; j += 2) {
+
+                v2s aVec0 = *((v2s *)&(pSrcA[i * N + j]));
+
+                v2s bTemp0 = *((v2s *)&(pSrcB[j * O + k]));
+                v2s bTemp1 = *((v2s *)&(pSrcB[(j + 1) * O + k]));
+
+                sum00 = __SUMDOTP2(aVec0, __builtin_shuffle(bTemp0, bTemp1, (v2s){ 0, 2 }), sum00);
+                sum01 = __SUMDOTP2(aVec0, __builtin_shuffle(bTemp0, bTemp1, (v2s){ 1, 3 }), sum01);
             }
-        }
 
-        // clean up for i
-        if (iEnd != M) {
-            for (k = core_id * 2; k < kEnd; k += nPE * 2) {
-                for (int step = 0; step < 2; step++) {
-                    for (i = iEnd; i < M; i++) {
-                        int32_t sum = 0;
-                        for (j = 0; j < N; j++) {
-                            sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k + step];
-                        }
-                        pDstC[i * O + k + step] = sum;
-                    }
-                }
+            if (NEnd != N) {
+                int32_t a0 = pSrcA[i * N + NEnd];
+                sum00 += a0 * pSrcB[NEnd * O + k];
+                sum01 += a0 * pSrcB[NEnd * O + k + 1];
             }
+
+            pDstC[i * O + k] = sum00;
+            pDstC[i * O + k + 1] = sum01;
         }
+    }
 
-        // clean up for k
-        for (k = kEnd; k < O; k++) {
-            for (i = 0; i < M; i++) {
-                int32_t sum = 0;
-                for (j = 0; j < N; j++) {
-                    sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                }
-                pDstC[i * O + k] = sum;
+    // last column, if O is odd
+    for (i = tile.rowStart; i < tile.rowEnd; i++) {
+        for (k = OEnd; k < tile.colEnd; k++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
             }
+            pDstC[i * O + k] = sum;
         }
     }
 
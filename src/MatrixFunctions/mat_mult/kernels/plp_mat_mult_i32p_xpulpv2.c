@@ -65,12 +65,12 @@ void plp_mat_mult_i32p_xpulpv2(void *args) {
     uint32_t k; // loop counter
 
     int core_id = hal_core_id();
-    int step = (M - 1 + nPE) / nPE;
-    uint32_t START = step * core_id;
-    uint32_t END = (core_id != hal_cl_nb_pe_cores() - 1) ? START + step : M;
-    // printf("core id: %i, start: %i, end: %i\n", core_id, START, END);
-    for (i = START; i < END; i++) {
-        for (k = 0; k < O; k++) {
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 1, nPE, core_id, &tile);
+
+    for (i = tile.rowStart; i < tile.rowEnd; i++) {
+        for (k = tile.colStart; k < tile.colEnd; k++) {
             int32_t sum = 0;
             for (j = 0; j < N; j++) {
                 sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
@@ -94,16 +94,21 @@ void plp_mat_mult_i32p_xpulpv2(void *args) {
     uint32_t nPE = arguments->nPE;
     int32_t *__restrict__ pDstC = arguments->pDstC;
 
-    uint32_t i = 0; // loop counter for M
-    uint32_t j = 0; // loop counter for N
-    uint32_t k = 0; // loop counter for O
+    uint32_t i; // loop counter for M
+    uint32_t j; // loop counter for N
+    uint32_t k; // loop counter for O
 
     int core_id = hal_core_id();
 
-    // printf("core id: %i, start: %i, end: %i\n", core_id, START, END);
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 2, nPE, core_id, &tile);
 
-    for (k = core_id; k < O / 2; k += nPE) {
-        for (i = 0; i < M / 2; i++) {
+    // rows and columns of the tile covered by 2x2 blocks
+    uint32_t MEnd = tile.rowStart + ((tile.rowEnd - tile.rowStart) & ~1U);
+    uint32_t OEnd = tile.colStart + ((tile.colEnd - tile.colStart) & ~1U);
+
+    for (k = tile.colStart; k < OEnd; k += 2) {
+        for (i = tile.rowStart; i < MEnd; i += 2) {
 
             int32_t sum00 = 0;
             int32_t sum01 = 0;
@@ -111,11 +116,11 @@ void plp_mat_mult_i32p_xpulpv2(void *args) {
             int32_t sum11 = 0;
 
             for (j = 0; j < N; j++) {
-                int32_t AVal0 = pSrcA[i * 2 * N + (j)];
-                int32_t AVal1 = pSrcA[i * 2 * N + N + (j)];
+                int32_t AVal0 = pSrcA[i * N + j];
+                int32_t AVal1 = pSrcA[(i + 1) * N + j];
 
-                int32_t BVal0 = pSrcB[j * O + (k * 2)];
-                int32_t BVal1 = pSrcB[j * O + (k * 2 + 1)];
+                int32_t BVal0 = pSrcB[j * O + k];
+                int32_t BVal1 = pSrcB[j * O + k + 1];
 
                 sum00 = sum00 + AVal0 * BVal0;
                 sum01 = sum01 + AVal0 * BVal1;
@@ -123,60 +128,36 @@ void plp_mat_mult_i32p_xpulpv2(void *args) {
                 sum11 = sum11 + AVal1 * BVal1;
             }
 
-            pDstC[(i * 2) * O + k * 2] = sum00;
-            pDstC[(i * 2) * O + k * 2 + 1] = sum01;
-            pDstC[(i * 2 + 1) * O + k * 2] = sum10;
-            pDstC[(i * 2 + 1) * O + k * 2 + 1] = sum11;
+            pDstC[i * O + k] = sum00;
+            pDstC[i * O + k + 1] = sum01;
+            pDstC[(i + 1) * O + k] = sum10;
+            pDstC[(i + 1) * O + k + 1] = sum11;
         }
-    }
 
-    // clean up code
-    i = i * 2;
-    j = j;
-    k = k * 2;
-    // check if every index is nicely finished
-    if (i == M && j == N && k >= O) {
-
-    } else {
-        uint32_t iEnd = i;
-        uint32_t jEnd = j;
-        uint32_t kEnd = k >= O ? O : k;
-
-        // clean up for j
-        if (jEnd != N) {
-            for (i = 0; i < iEnd; i++) {
-                for (k = 0; k < kEnd; k += nPE) {
-                    int32_t sum = 0;
-                    for (j = jEnd; j < N; j++) {
-                        sum += sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                    }
-                    pDstC[i * O + k] += sum;
-                }
-            }
-        }
+        // last row, if the tile has an odd number of rows
+        if (MEnd != tile.rowEnd) {
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
 
-        // clean up for i
-        if (iEnd != M) {
-            for (k = core_id; k < kEnd; k += nPE) {
-                for (i = iEnd; i < M; i++) {
-                    int32_t sum = 0;
-                    for (j = 0; j < N; j++) {
-                        sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                    }
-                    pDstC[i * O + k] = sum;
-                }
+            for (j = 0; j < N; j++) {
+                int32_t AVal0 = pSrcA[MEnd * N + j];
+                sum00 = sum00 + AVal0 * pSrcB[j * O + k];
+                sum01 = sum01 + AVal0 * pSrcB[j * O + k + 1];
             }
+
+            pDstC[MEnd * O + k] = sum00;
+            pDstC[MEnd * O + k + 1] = sum01;
         }
+    }
 
-        // clean up for k
-        for (k = kEnd; k < O; k += nPE) {
-            for (i = 0; i < M; i++) {
-                int32_t sum = 0;
-                for (j = 0; j < N; j++) {
-                    sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                }
-                pDstC[i * O + k] = sum;
+    // last column, if O is odd
+    for (i = tile.rowStart; i < tile.rowEnd; i++) {
+        for (k = OEnd; k < tile.colEnd; k++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
             }
+            pDstC[i * O + k] = sum;
         }
     }
 
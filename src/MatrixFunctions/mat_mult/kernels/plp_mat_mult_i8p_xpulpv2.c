@@ -46,8 +46,12 @@
    @return     none
 
    @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+   The output is computed in blocks of 2x4 elements. For every block, four rows of B are loaded
+   and transposed with shuffles, such that each 32 bit vector holds four consecutive elements of
+   one column of B. Each of the two 4-element vectors of A is then reused for four __SUMDOTP4
+   with 32 bit accumulator, which performs four MACs each. The output is split among the cores
+   with plp_mat_partition, in multiples of 4 columns. The remaining rows, columns and elements of
+   the inner dimension, which do not fill a complete block, are computed with scalar instructions.
 */
 
 // define BASIC_VERSION // if used don't forget to also use the undefine at end of file
@@ -65,12 +69,17 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
     uint32_t nPE = arguments->nPE;
     int32_t *__restrict__ pDstC = arguments->pDstC;
 
+    uint32_t core_id = hal_core_id();
+
     uint32_t i; // loop counter
     uint32_t j; // loop counter
     uint32_t k; // loop counter
 
-    for (i = 0; i < M; i++) {
-        for (k = 0; k < O; k++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 1, nPE, core_id, &tile);
+
+    for (i = tile.rowStart; i < tile.rowEnd; i++) {
+        for (k = tile.colStart; k < tile.colEnd; k++) {
             int32_t sum = 0;
             for (j = 0; j < N; j++) {
                 sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
@@ -100,14 +109,26 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
     uint32_t nPE = arguments->nPE;
     int32_t *__restrict__ pDstC = arguments->pDstC;
 
-    uint32_t i = 0; // loop counter for M
-    uint32_t j = 0; // loop counter for N
-    uint32_t k = 0; // loop counter for O
-
     uint32_t core_id = hal_core_id();
 
-    for (k = core_id; k < O / 4; k += nPE) {
-        for (i = 0; i < M / 2; i++) {
+    uint32_t i; // loop counter for M
+    uint32_t j; // loop counter for N
+    uint32_t k; // loop counter for O
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 4, nPE, core_id, &tile);
+
+    // rows and columns of the tile covered by 2x4 blocks
+    uint32_t MEnd = tile.rowStart + ((tile.rowEnd - tile.rowStart) & ~1U);
+    uint32_t OEnd = tile.colStart + ((tile.colEnd - tile.colStart) & ~3U);
+    uint32_t NEnd = N & ~3U; // elements covered by the SIMD dot products
+
+    for (k = tile.colStart; k < OEnd; k += 4) {
+        for (i = tile.rowStart; i < MEnd; i += 2) {
+
+            const int8_t *pA0 = &pSrcA[i * N];
+            const int8_t *pA1 = &pSrcA[(i + 1) * N];
+            const int8_t *pB = &pSrcB[k];
 
             int32_t sum00 = 0;
             int32_t sum01 = 0;
@@ -118,27 +139,26 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
             int32_t sum12 = 0;
             int32_t sum13 = 0;
 
-            // v2s* Bpoint = (v2s*) &(pSrcB[k]);
+            for (j = 0; j < NEnd; j += 4) {
 
-            for (j = 0; j < N / 4; j++) {
+                v4s aVec0 = *((v4s *)&pA0[j]);
+                v4s aVec1 = *((v4s *)&pA1[j]);
 
-                v4s aVec0 = *((v4s *)&(pSrcA[(i * 2) * N + (j * 4)]));
-                v4s aVec1 = *((v4s *)&(pSrcA[(i * 2 + 1) * N + (j * 4)]));
-
-                v4s temp0 = *((v4s *)&(pSrcB[(j * 4) * O + (k * 4)]));
-                v4s temp1 = *((v4s *)&(pSrcB[(j * 4 + 1) * O + (k * 4)]));
-                v4s temp2 = *((v4s *)&(pSrcB[(j * 4 + 2) * O + (k * 4)]));
-                v4s temp3 = *((v4s *)&(pSrcB[(j * 4 + 3) * O + (k * 4)]));
+                v4s temp0 = *((v4s *)&pB[0]);
+                v4s temp1 = *((v4s *)&pB[O]);
+                v4s temp2 = *((v4s *)&pB[2 * O]);
+                v4s temp3 = *((v4s *)&pB[3 * O]);
+                pB += 4 * O;
 
                 v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // 0,1,4,5
                 v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // 8,9,12,13
                 v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // 2,3,6,7
-                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // 3,7,11,15
+                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // 10,11,14,15
 
-                v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2);
-                v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3);
-                v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2);
-                v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3);
+                v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // 0,4,8,12
+                v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // 1,5,9,13
+                v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // 2,6,10,14
+                v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // 3,7,11,15
 
                 sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
                 sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
@@ -150,68 +170,92 @@ void plp_mat_mult_i8p_xpulpv2(void *args) {
                 sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
             }
 
-            pDstC[(i * 2) * O + (k * 4)] = sum00;
-            pDstC[(i * 2) * O + (k * 4 + 1)] = sum01;
-            pDstC[(i * 2) * O + (k * 4 + 2)] = sum02;
-            pDstC[(i * 2) * O + (k * 4 + 3)] = sum03;
-            pDstC[(i * 2 + 1) * O + (k * 4)] = sum10;
-            pDstC[(i * 2 + 1) * O + (k * 4 + 1)] = sum11;
-            pDstC[(i * 2 + 1) * O + (k * 4 + 2)] = sum12;
-            pDstC[(i * 2 + 1) * O + (k * 4 + 3)] = sum13;
+            // remaining elements of the inner dimension
+            for (j = NEnd; j < N; j++) {
+                int32_t a0 = pA0[j];
+                int32_t a1 = pA1[j];
+                int32_t b0 = pB[0];
+                int32_t b1 = pB[1];
+                int32_t b2 = pB[2];
+                int32_t b3 = pB[3];
+                pB += O;
+
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum02 += a0 * b2;
+                sum03 += a0 * b3;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+                sum12 += a1 * b2;
+                sum13 += a1 * b3;
+            }
+
+            pDstC[i * O + k] = sum00;
+            pDstC[i * O + k + 1] = sum01;
+            pDstC[i * O + k + 2] = sum02;
+            pDstC[i * O + k + 3] = sum03;
+            pDstC[(i + 1) * O + k] = sum10;
+            pDstC[(i + 1) * O + k + 1] = sum11;
+            pDstC[(i + 1) * O + k + 2] = sum12;
+            pDstC[(i + 1) * O + k + 3] = sum13;
         }
-    }
 
-    // clean up code
-    i = i * 2;
-    j = j * 4;
-    k = k * 4;
-    // check if every index is nicely finished
-    if (i == M && j == N && k >= O) {
-
-    } else {
-        uint32_t iEnd = i;
-        uint32_t jEnd = j;
-        uint32_t kEnd = k >= O ? O : k;
-
-        // clean up for j
-        if (jEnd != N) {
-            for (k = core_id * 4; k < kEnd; k += nPE * 4) {
-                for (int step = 0; step < 4; step++) {
-                    for (i = 0; i < iEnd; i++) {
-                        int32_t sum = 0;
-                        for (j = jEnd; j < N; j++) {
-                            sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k + step];
-                        }
-                        pDstC[i * O + k + step] += sum;
-                    }
-                }
+        // last row, if the tile has an odd number of rows
+        if (MEnd != tile.rowEnd) {
+
+            const int8_t *pA0 = &pSrcA[MEnd * N];
+            const int8_t *pB = &pSrcB[k];
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum02 = 0;
+            int32_t sum03 = 0;
+
+            for (j = 0; j < NEnd; j += 4) {
+
+                v4s aVec0 = *((v4s *)&pA0[j]);
+
+                v4s temp0 = *((v4s *)&pB[0]);
+                v4s temp1 = *((v4s *)&pB[O]);
+                v4s temp2 = *((v4s *)&pB[2 * O]);
+                v4s temp3 = *((v4s *)&pB[3 * O]);
+                pB += 4 * O;
+
+                v4s temp4 = __builtin_shuffle(temp0, temp1, mask0);
+                v4s temp5 = __builtin_shuffle(temp2, temp3, mask0);
+                v4s temp6 = __builtin_shuffle(temp0, temp1, mask1);
+                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1);
+
+                sum00 = __SUMDOTP4(aVec0, __builtin_shuffle(temp4, temp5, mask2), sum00);
+                sum01 = __SUMDOTP4(aVec0, __builtin_shuffle(temp4, temp5, mask3), sum01);
+                sum02 = __SUMDOTP4(aVec0, __builtin_shuffle(temp6, temp7, mask2), sum02);
+                sum03 = __SUMDOTP4(aVec0, __builtin_shuffle(temp6, temp7, mask3), sum03);
             }
-        }
 
-        // clean up for i
-        if (iEnd != M) {
-            for (k = core_id * 4; k < kEnd; k += nPE * 4) {
-                for (int step = 0; step < 4; step++) {
-                    for (i = iEnd; i < M; i++) {
-                        int32_t sum = 0;
-                        for (j = 0; j < N; j++) {
-                            sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k + step];
-                        }
-                        pDstC[i * O + k + step] = sum;
-                    }
-                }
+            for (j = NEnd; j < N; j++) {
+                int32_t a0 = pA0[j];
+                sum00 += a0 * pB[0];
+                sum01 += a0 * pB[1];
+                sum02 += a0 * pB[2];
+                sum03 += a0 * pB[3];
+                pB += O;
             }
+
+            pDstC[MEnd * O + k] = sum00;
+            pDstC[MEnd * O + k + 1] = sum01;
+            pDstC[MEnd * O + k + 2] = sum02;
+            pDstC[MEnd * O + k + 3] = sum03;
         }
+    }
 
-        // clean up for k
-        for (k = kEnd; k < O; k++) {
-            for (i = 0; i < M; i++) {
-                int32_t sum = 0;
-                for (j = 0; j < N; j++) {
-                    sum = sum + pSrcA[i * N + j] * pSrcB[j * O + k];
-                }
-                pDstC[i * O + k] = sum;
+    // remaining columns, if O is not a multiple of 4
+    for (i = tile.rowStart; i < tile.rowEnd; i++) {
+        for (k = OEnd; k < tile.colEnd; k++) {
+            int32_t sum = 0;
+            for (j = 0; j < N; j++) {
+                sum += pSrcA[i * N + j] * pSrcB[j * O + k];
             }
+            pDstC[i * O + k] = sum;
         }
     }
 
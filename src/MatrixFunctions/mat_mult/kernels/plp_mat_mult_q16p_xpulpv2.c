@@ -77,8 +77,11 @@ void plp_mat_mult_q16p_xpulpv2(void *args) {
     uint32_t n; // loop counter
     uint32_t o; // loop counter
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 1, nPE, core_id, &tile);
+
+    for (m = tile.rowStart; m < tile.rowEnd; m++) {
+        for (o = tile.colStart; o < tile.colEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 int32_t valA = (int32_t)pSrcA[m * N + n];
@@ -0,0 +1,216 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tiled_i16p_xpulpv2.c
+ * Description:  parallel 16-bit integer tiled matrix multiplication for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatMultTiled
+ */
+
+/**
+  @addtogroup MatMultTiledKernels
+  @{
+ */
+
+/**
+   @brief Start the transfer of the A and B tiles of step t into the L1 buffer buf.
+   @param[in]  a    pointer to the instance struct
+   @param[in]  t    index of the step
+   @param[in]  buf  buffer to be filled (0 or 1)
+   @return     none
+*/
+static void
+plp_mat_mult_tiled_i16_load(plp_mat_mult_tiled_instance_i16 *a, uint32_t t, uint32_t buf) {
+
+    uint32_t nTilesN = (a->N + a->tileN - 1) / a->tileN;
+    uint32_t nTilesO = (a->O + a->tileO - 1) / a->tileO;
+
+    uint32_t m0 = (t / nTilesN / nTilesO) * a->tileM;
+    uint32_t o0 = ((t / nTilesN) % nTilesO) * a->tileO;
+    uint32_t n0 = (t % nTilesN) * a->tileN;
+    uint32_t curM = (a->M - m0 < a->tileM) ? a->M - m0 : a->tileM;
+    uint32_t curN = (a->N - n0 < a->tileN) ? a->N - n0 : a->tileN;
+    uint32_t curO = (a->O - o0 < a->tileO) ? a->O - o0 : a->tileO;
+
+    int16_t *pLocA = a->pBufA + buf * a->tileM * a->tileN;
+    int16_t *pLocB = a->pBufB + buf * a->tileN * a->tileO;
+
+    // the tiles are stored densely in L1, rows which are contiguous in L2 are merged into a
+    // single transfer
+    int merge = 0;
+
+    if (curN == a->N) {
+        hal_cl_dma_cmd((uintptr_t)(a->pSrcA + m0 * a->N), (uintptr_t)pLocA,
+                       sizeof(int16_t) * curM * curN, HAL_CL_DMA_DIR_EXT2LOC, merge,
+                       &a->dmaLoad[buf]);
+        merge = 1;
+    } else {
+        for (uint32_t m = 0; m < curM; m++) {
+            hal_cl_dma_cmd((uintptr_t)(a->pSrcA + (m0 + m) * a->N + n0),
+                           (uintptr_t)(pLocA + m * curN), sizeof(int16_t) * curN,
+                           HAL_CL_DMA_DIR_EXT2LOC, merge, &a->dmaLoad[buf]);
+            merge = 1;
+        }
+    }
+
+    if (curO == a->O) {
+        hal_cl_dma_cmd((uintptr_t)(a->pSrcB + n0 * a->O), (uintptr_t)pLocB,
+                       sizeof(int16_t) * curN * curO, HAL_CL_DMA_DIR_EXT2LOC, merge,
+                       &a->dmaLoad[buf]);
+    } else {
+        for (uint32_t n = 0; n < curN; n++) {
+            hal_cl_dma_cmd((uintptr_t)(a->pSrcB + (n0 + n) * a->O + o0),
+                           (uintptr_t)(pLocB + n * curO), sizeof(int16_t) * curO,
+                           HAL_CL_DMA_DIR_EXT2LOC, merge, &a->dmaLoad[buf]);
+        }
+    }
+}
+
+/**
+   @brief Parallel tiled matrix multiplication of 16-bit integer matrices kernel for XPULPV2
+          extension.
+   @param[in]  args  pointer to plp_mat_mult_tiled_instance_i16 struct initialized by
+                     plp_mat_mult_tiled_i16_parallel
+   @return     none
+
+   @par Double buffering
+   The product is computed in steps, one for every combination of a tile of A (tileM x tileN) and
+   of B (tileN x tileO). The tiles of C (tileM x tileO) stay in L1 until all tiles along N are
+   accumulated. Core 0 drives the DMA: while all cores compute step t on one pair of A and B
+   buffers, the tiles of step t + 1 are transferred into the other pair. Likewise, there are two
+   buffers for C, such that a finished tile is written back to L2 while the next one is computed.
+   Within a step, the tile of C is split among the cores with plp_mat_partition.
+*/
+void plp_mat_mult_tiled_i16p_xpulpv2(void *args) {
+
+    plp_mat_mult_tiled_instance_i16 *a = (plp_mat_mult_tiled_instance_i16 *)args;
+
+    uint32_t M = a->M;
+    uint32_t N = a->N;
+    uint32_t O = a->O;
+    uint32_t tileM = a->tileM;
+    uint32_t tileN = a->tileN;
+    uint32_t tileO = a->tileO;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDstC = a->pDstC;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t nTilesN = (N + tileN - 1) / tileN;
+    uint32_t nTilesO = (O + tileO - 1) / tileO;
+    uint32_t nTilesM = (M + tileM - 1) / tileM;
+    uint32_t nSteps = nTilesM * nTilesO * nTilesN;
+
+    uint32_t t; // step counter, N is the innermost dimension
+    uint32_t i, j, k;
+
+    if (core_id == 0) {
+        plp_mat_mult_tiled_i16_load(a, 0, 0);
+    }
+
+    for (t = 0; t < nSteps; t++) {
+
+        uint32_t buf = t & 1;
+        uint32_t tileC = t / nTilesN; // index of the output tile
+        uint32_t bufC = tileC & 1;
+        uint32_t tn = t % nTilesN;
+
+        uint32_t m0 = (tileC / nTilesO) * tileM;
+        uint32_t o0 = (tileC % nTilesO) * tileO;
+        uint32_t n0 = tn * tileN;
+        uint32_t curM = (M - m0 < tileM) ? M - m0 : tileM;
+        uint32_t curN = (N - n0 < tileN) ? N - n0 : tileN;
+        uint32_t curO = (O - o0 < tileO) ? O - o0 : tileO;
+
+        if (core_id == 0) {
+            hal_cl_dma_cmd_wait(&a->dmaLoad[buf]);
+            // the C buffer is reused, its previous content must be in L2
+            if (tn == 0 && tileC >= 2) {
+                hal_cl_dma_cmd_wait(&a->dmaStore[bufC]);
+            }
+        }
+
+        // the tiles of step t are in L1 and all cores are done with step t - 1
+        hal_team_barrier();
+
+        if (core_id == 0 && t + 1 < nSteps) {
+            plp_mat_mult_tiled_i16_load(a, t + 1, buf ^ 1);
+        }
+
+        const int16_t *pA = a->pBufA + buf * tileM * tileN;
+        const int16_t *pB = a->pBufB + buf * tileN * tileO;
+        int32_t *pC = a->pBufC + bufC * tileM * tileO;
+
+        plp_mat_tile tile;
+        plp_mat_partition(curM, curO, 1, nPE, core_id, &tile);
+
+        for (i = tile.rowStart; i < tile.rowEnd; i++) {
+            for (j = tile.colStart; j < tile.colEnd; j++) {
+                int32_t sum = (tn == 0) ? 0 : pC[i * curO + j];
+                for (k = 0; k < curN; k++) {
+                    sum += (int32_t)pA[i * curN + k] * (int32_t)pB[k * curO + j];
+                }
+                pC[i * curO + j] = sum;
+            }
+        }
+
+        // write the finished tile of C back to L2
+        if (tn == nTilesN - 1) {
+            hal_team_barrier();
+            if (core_id == 0) {
+                if (curO == O) {
+                    hal_cl_dma_cmd((uintptr_t)(pDstC + m0 * O), (uintptr_t)pC,
+                                   sizeof(int32_t) * curM * curO, HAL_CL_DMA_DIR_LOC2EXT, 0,
+                                   &a->dmaStore[bufC]);
+                } else {
+                    for (i = 0; i < curM; i++) {
+                        hal_cl_dma_cmd((uintptr_t)(pDstC + (m0 + i) * O + o0),
+                                       (uintptr_t)(pC + i * curO), sizeof(int32_t) * curO,
+                                       HAL_CL_DMA_DIR_LOC2EXT, i != 0, &a->dmaStore[bufC]);
+                    }
+                }
+            }
+        }
+    }
+
+    if (core_id == 0) {
+        uint32_t nTilesC = nTilesM * nTilesO;
+        if (nTilesC >= 2) {
+            hal_cl_dma_cmd_wait(&a->dmaStore[nTilesC & 1]);
+        }
+        if (nTilesC >= 1) {
+            hal_cl_dma_cmd_wait(&a->dmaStore[(nTilesC - 1) & 1]);
+        }
+    }
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of MatMultTiledKernels group
+*/
@@ -0,0 +1,123 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_mult_tiled_i8_parallel.c
+ * Description:  parallel 8-bit integer matrix multiplication with operands in L2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatMultTiled
+  @{
+ */
+
+/**
+  @brief Glue code for parallel matrix multiplication of 8-bit integer matrices in L2.
+  @param[in]  pSrcA     points to the first input matrix, in L2
+  @param[in]  pSrcB     points to the second input matrix, in L2
+  @param[in]  M         height of the first input matrix
+  @param[in]  N         width of the first input matrix and hight of the second
+  @param[in]  O         width of the second input matrix
+  @param[in]  nPE       Number of cores to use
+  @param[out] pDstC     points to the output matrix, in L2
+  @return     none
+
+  @par Tile sizes
+  The tiles are at most 32x128 for A, 128x32 for B and 32x32 for C. If the double buffers
+  do not fit into the free L1 memory, the largest tile dimension is halved until they do.
+ */
+
+void plp_mat_mult_tiled_i8_parallel(const int8_t *__restrict__ pSrcA,
+                                    const int8_t *__restrict__ pSrcB,
+                                    uint32_t M,
+                                    uint32_t N,
+                                    uint32_t O,
+                                    uint32_t nPE,
+                                    int32_t *__restrict__ pDstC) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    } else {
+        if (M == 0 || N == 0 || O == 0) {
+            return;
+        }
+
+        uint32_t tileM = (M < 32) ? M : 32;
+        uint32_t tileN = (N < 128) ? N : 128;
+        uint32_t tileO = (O < 32) ? O : 32;
+
+        uint32_t sizeC, sizeA, sizeB;
+        int32_t *pBuf;
+
+        while (1) {
+            sizeC = 2 * sizeof(int32_t) * tileM * tileO;
+            sizeA = 2 * sizeof(int8_t) * tileM * tileN;
+            sizeB = 2 * sizeof(int8_t) * tileN * tileO;
+            pBuf = hal_cl_l1_malloc(sizeC + sizeA + sizeB);
+            if (pBuf != NULL) {
+                break;
+            }
+            if (tileM == 1 && tileN == 1 && tileO == 1) {
+                printf("Error: insufficient L1 memory!\n");
+                return;
+            }
+            if (tileN >= tileM && tileN >= tileO) {
+                tileN = (tileN + 1) >> 1;
+            } else if (tileM >= tileO) {
+                tileM = (tileM + 1) >> 1;
+            } else {
+                tileO = (tileO + 1) >> 1;
+            }
+        }
+
+        plp_mat_mult_tiled_instance_i8 args = {
+            .pSrcA = pSrcA,
+            .pSrcB = pSrcB,
+            .M = M,
+            .N = N,
+            .O = O,
+            .tileM = tileM,
+            .tileN = tileN,
+            .tileO = tileO,
+            .nPE = nPE,
+            .pBufA = (int8_t *)((uint8_t *)pBuf + sizeC),
+            .pBufB = (int8_t *)((uint8_t *)pBuf + sizeC + sizeA),
+            .pBufC = pBuf,
+            .pDstC = pDstC
+        };
+        hal_cl_team_fork(nPE, plp_mat_mult_tiled_i8p_xpulpv2, (void *)&args);
+
+        hal_cl_l1_free(pBuf, sizeC + sizeA + sizeB);
+    }
+}
+
+/**
+  @} end of MatMultTiled group
+ */
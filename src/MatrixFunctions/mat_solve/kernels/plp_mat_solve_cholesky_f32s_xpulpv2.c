@@ -0,0 +1,87 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_cholesky_f32s_xpulpv2.c
+ * Description:  32-bit floating-point Cholesky linear system solver for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Linear system solver with Cholesky decomposition of 32-bit floating-point matrices kernel
+  for XPULPV2 extension.
+  @param[in]  pL       Points to the Cholesky decomposition of A
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+ */
+
+void plp_mat_solve_cholesky_f32s_xpulpv2(const float *__restrict__ pL,
+                                         uint32_t N,
+                                         const float *__restrict__ pB,
+                                         uint32_t K,
+                                         float *__restrict__ pDst) {
+
+    uint32_t i, j, c;
+
+    /* forward substitution with L */
+    for (i = 0; i < N; i++) {
+        const float *pRowL = &pL[i * N];
+        float diagInv = 1.0f / pRowL[i];
+        for (c = 0; c < K; c++) {
+            float acc = pB[i * K + c];
+            for (j = 0; j < i; j++) {
+                acc -= pRowL[j] * pDst[j * K + c];
+            }
+            pDst[i * K + c] = acc * diagInv;
+        }
+    }
+
+    /* backward substitution with L^T, the column i of L is the row i of L^T */
+    for (i = N; i > 0; i--) {
+        float diagInv = 1.0f / pL[(i - 1) * N + i - 1];
+        for (c = 0; c < K; c++) {
+            float acc = pDst[(i - 1) * K + c];
+            for (j = i; j < N; j++) {
+                acc -= pL[j * N + i - 1] * pDst[j * K + c];
+            }
+            pDst[(i - 1) * K + c] = acc * diagInv;
+        }
+    }
+}
+
+/**
+  @} end of MatSolveKernels group
+ */
@@ -0,0 +1,146 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_cholesky_q32p_xpulpv2.c
+ * Description:  parallel 32-bit fix-point Cholesky linear system solver for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Parallel linear system solver with Cholesky decomposition of 32-bit fix-point matrices
+  kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_solve_cholesky_instance_q32 struct initialized by
+                    plp_mat_solve_cholesky_q32_parallel
+  @return     none
+
+  @par Parallelization
+  The substitutions are computed column by column: once the solution of row j is known, it is
+  eliminated from all remaining rows, which are distributed in an interleaved fashion over the
+  cores (row i belongs to core i % nPE). The owner of the next row finalizes it in the same step,
+  such that only one team barrier per row is needed. This parallelizes a single right-hand side as
+  well. Since the products are rounded one by one, the result can differ slightly
+  from plp_mat_solve_cholesky_q32s_xpulpv2.
+ */
+
+void plp_mat_solve_cholesky_q32p_xpulpv2(void *args) {
+
+    plp_mat_solve_cholesky_instance_q32 *a = (plp_mat_solve_cholesky_instance_q32 *)args;
+
+    const int32_t *__restrict__ pL = a->pL;
+    uint32_t N = a->N;
+    const int32_t *__restrict__ pB = a->pB;
+    uint32_t K = a->K;
+    uint32_t fracBits = a->fracBits;
+    uint32_t nPE = a->nPE;
+    int32_t *__restrict__ pDst = a->pDst;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, j, c;
+
+    if (N == 0) {
+        return;
+    }
+
+    /* copy the right-hand sides of the own rows */
+    for (i = core_id; i < N; i += nPE) {
+        const int32_t *pRowB = &pB[i * K];
+        int32_t *pRowY = &pDst[i * K];
+        for (c = 0; c < K; c++) {
+            pRowY[c] = pRowB[c];
+        }
+        if (i == 0) {
+            int32_t diag = pL[0];
+            for (c = 0; c < K; c++) {
+                pRowY[c] = (int32_t)(((int64_t)pRowY[c] << fracBits) / diag);
+            }
+        }
+    }
+
+    hal_team_barrier();
+
+    /* forward substitution with L */
+    for (j = 0; j + 1 < N; j++) {
+        const int32_t *pRowX = &pDst[j * K];
+        for (i = j + 1 + (core_id + nPE - (j + 1) % nPE) % nPE; i < N; i += nPE) {
+            int32_t *pRowY = &pDst[i * K];
+            int32_t l = pL[i * N + j];
+            for (c = 0; c < K; c++) {
+                pRowY[c] -= (int32_t)(((int64_t)l * pRowX[c]) >> fracBits);
+            }
+            if (i == j + 1) {
+                int32_t diag = pL[i * N + i];
+                for (c = 0; c < K; c++) {
+                    pRowY[c] = (int32_t)(((int64_t)pRowY[c] << fracBits) / diag);
+                }
+            }
+        }
+
+        hal_team_barrier();
+    }
+
+    /* backward substitution with L^T */
+    if ((N - 1) % nPE == core_id) {
+        int32_t *pRowY = &pDst[(N - 1) * K];
+        int32_t diag = pL[(N - 1) * N + (N - 1)];
+        for (c = 0; c < K; c++) {
+            pRowY[c] = (int32_t)(((int64_t)pRowY[c] << fracBits) / diag);
+        }
+    }
+
+    hal_team_barrier();
+
+    for (j = N - 1; j > 0; j--) {
+        const int32_t *pRowX = &pDst[j * K];
+        for (i = core_id; i < j; i += nPE) {
+            int32_t *pRowY = &pDst[i * K];
+            int32_t u = pL[j * N + i];
+            for (c = 0; c < K; c++) {
+                pRowY[c] -= (int32_t)(((int64_t)u * pRowX[c]) >> fracBits);
+            }
+            if (i == j - 1) {
+                int32_t diag = pL[i * N + i];
+                for (c = 0; c < K; c++) {
+                    pRowY[c] = (int32_t)(((int64_t)pRowY[c] << fracBits) / diag);
+                }
+            }
+        }
+
+        hal_team_barrier();
+    }
+}
+
+/**
+  @} end of MatSolveKernels group
+ */
@@ -0,0 +1,89 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_cholesky_q32s_xpulpv2.c
+ * Description:  32-bit fix-point Cholesky linear system solver for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Linear system solver with Cholesky decomposition of 32-bit fix-point matrices kernel for
+  XPULPV2 extension.
+  @param[in]  pL       Points to the Cholesky decomposition of A
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+ */
+
+void plp_mat_solve_cholesky_q32s_xpulpv2(const int32_t *__restrict__ pL,
+                                         uint32_t N,
+                                         const int32_t *__restrict__ pB,
+                                         uint32_t K,
+                                         uint32_t fracBits,
+                                         int32_t *__restrict__ pDst) {
+
+    uint32_t i, j, c;
+
+    /* forward substitution with L */
+    for (i = 0; i < N; i++) {
+        const int32_t *pRowL = &pL[i * N];
+        int32_t diag = pRowL[i];
+        for (c = 0; c < K; c++) {
+            int64_t acc = (int64_t)pB[i * K + c] << fracBits;
+            for (j = 0; j < i; j++) {
+                acc -= (int64_t)pRowL[j] * pDst[j * K + c];
+            }
+            pDst[i * K + c] = (int32_t)(acc / diag);
+        }
+    }
+
+    /* backward substitution with L^T, the column i of L is the row i of L^T */
+    for (i = N; i > 0; i--) {
+        int32_t diag = pL[(i - 1) * N + i - 1];
+        for (c = 0; c < K; c++) {
+            int64_t acc = (int64_t)pDst[(i - 1) * K + c] << fracBits;
+            for (j = i; j < N; j++) {
+                acc -= (int64_t)pL[j * N + i - 1] * pDst[j * K + c];
+            }
+            pDst[(i - 1) * K + c] = (int32_t)(acc / diag);
+        }
+    }
+}
+
+/**
+  @} end of MatSolveKernels group
+ */
@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lu_f32p_xpulpv2.c
+ * Description:  parallel 32-bit floating-point LU linear system solver for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Parallel linear system solver with LU decomposition of 32-bit floating-point matrices
+  kernel for XPULPV2 extension.
+  @param[in]  args  pointer to plp_mat_solve_lu_instance_f32 struct initialized by
+                    plp_mat_solve_lu_f32_parallel
+  @return     none
+
+  @par Parallelization
+  The substitutions are computed column by column: once the solution of row j is known, it is
+  eliminated from all remaining rows, which are distributed in an interleaved fashion over the
+  cores (row i belongs to core i % nPE). The owner of the next row finalizes it in the same step,
+  such that only one team barrier per row is needed. This parallelizes a single right-hand side as
+  well.
+ */
+
+void plp_mat_solve_lu_f32p_xpulpv2(void *args) {
+
+    plp_mat_solve_lu_instance_f32 *a = (plp_mat_solve_lu_instance_f32 *)args;
+
+    const float *__restrict__ pLU = a->pLU;
+    const uint32_t *__restrict__ pPerm = a->pPerm;
+    uint32_t N = a->N;
+    const float *__restrict__ pB = a->pB;
+    uint32_t K = a->K;
+    uint32_t nPE = a->nPE;
+    float *__restrict__ pDst = a->pDst;
+
+    uint32_t core_id = hal_core_id();
+
+    uint32_t i, j, c;
+
+    if (N == 0) {
+        return;
+    }
+
+    /* copy the right-hand sides of the own rows */
+    for (i = core_id; i < N; i += nPE) {
+        const float *pRowB = &pB[pPerm[i] * K];
+        float *pRowY = &pDst[i * K];
+        for (c = 0; c < K; c++) {
+            pRowY[c] = pRowB[c];
+        }
+    }
+
+    hal_team_barrier();
+
+    /* forward substitution with the unit lower triangular matrix L */
+    for (j = 0; j + 1 < N; j++) {
+        const float *pRowX = &pDst[j * K];
+        for (i = j + 1 + (core_id + nPE - (j + 1) % nPE) % nPE; i < N; i += nPE) {
+            float *pRowY = &pDst[i * K];
+            float l = pLU[i * N + j];
+            for (c = 0; c < K; c++) {
+                pRowY[c] -= l * pRowX[c];
+            }
+        }
+
+        hal_team_barrier();
+    }
+
+    /* backward substitution with the upper triangular matrix U */
+    if ((N - 1) % nPE == core_id) {
+        float *pRowY = &pDst[(N - 1) * K];
+        float diagInv = 1.0f / pLU[(N - 1) * N + (N - 1)];
+        for (c = 0; c < K; c++) {
+            pRowY[c] *= diagInv;
+        }
+    }
+
+    hal_team_barrier();
+
+    for (j = N - 1; j > 0; j--) {
+        const float *pRowX = &pDst[j * K];
+        for (i = core_id; i < j; i += nPE) {
+            float *pRowY = &pDst[i * K];
+            float u = pLU[i * N + j];
+            for (c = 0; c < K; c++) {
+                pRowY[c] -= u * pRowX[c];
+            }
+            if (i == j - 1) {
+                float diagInv = 1.0f / pLU[i * N + i];
+                for (c = 0; c < K; c++) {
+                    pRowY[c] *= diagInv;
+                }
+            }
+        }
+
+        hal_team_barrier();
+    }
+}
+
+/**
+  @} end of MatSolveKernels group
+ */
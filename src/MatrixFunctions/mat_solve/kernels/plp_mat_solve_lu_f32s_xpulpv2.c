@@ -0,0 +1,105 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lu_f32s_xpulpv2.c
+ * Description:  32-bit floating-point LU linear system solver for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @defgroup MatSolveKernels linear system solver Kernels
+  This module contains the kernel code for solving linear systems.
+
+  These functions solve the linear system A X = B for a square matrix A of shape NxN and K
+  right-hand sides B of shape NxK, given the LU decomposition (plp_mat_lu_f32) or the Cholesky
+  decomposition (plp_mat_cholesky_f32) of A. The solution costs O(N^2 K) operations with forward
+  and backward substitution, such that a factorization can be reused for many right-hand sides.
+
+  @par Algorithm
+  With P A = L U, first L Y = P B is solved by forward substitution, and then U X = Y by backward
+  substitution. With A = L L^T, L Y = B and L^T X = Y are solved in the same way. The
+  intermediate result Y is stored in pDst, which must not overlap with pB.
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Linear system solver with LU decomposition of 32-bit floating-point matrices kernel for
+  XPULPV2 extension.
+  @param[in]  pLU      Points to the LU decomposition of A
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+ */
+
+void plp_mat_solve_lu_f32s_xpulpv2(const float *__restrict__ pLU,
+                                   const uint32_t *__restrict__ pPerm,
+                                   uint32_t N,
+                                   const float *__restrict__ pB,
+                                   uint32_t K,
+                                   float *__restrict__ pDst) {
+
+    uint32_t i, j, c;
+
+    /* forward substitution with the unit lower triangular matrix L */
+    for (i = 0; i < N; i++) {
+        const float *pRowL = &pLU[i * N];
+        const float *pRowB = &pB[pPerm[i] * K];
+        for (c = 0; c < K; c++) {
+            float acc = pRowB[c];
+            for (j = 0; j < i; j++) {
+                acc -= pRowL[j] * pDst[j * K + c];
+            }
+            pDst[i * K + c] = acc;
+        }
+    }
+
+    /* backward substitution with the upper triangular matrix U */
+    for (i = N; i > 0; i--) {
+        const float *pRowU = &pLU[(i - 1) * N];
+        float diagInv = 1.0f / pRowU[i - 1];
+        for (c = 0; c < K; c++) {
+            float acc = pDst[(i - 1) * K + c];
+            for (j = i; j < N; j++) {
+                acc -= pRowU[j] * pDst[j * K + c];
+            }
+            pDst[(i - 1) * K + c] = acc * diagInv;
+        }
+    }
+}
+
+/**
+  @} end of MatSolveKernels group
+ */
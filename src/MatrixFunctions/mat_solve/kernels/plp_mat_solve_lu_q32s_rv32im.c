@@ -0,0 +1,92 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lu_q32s_rv32im.c
+ * Description:  32-bit fix-point LU linear system solver for RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup MatSolve
+ */
+
+/**
+  @addtogroup MatSolveKernels
+  @{
+ */
+
+/**
+  @brief Linear system solver with LU decomposition of 32-bit fix-point matrices kernel for RV32IM
+  extension.
+  @param[in]  pLU      Points to the LU decomposition of A
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+ */
+
+void plp_mat_solve_lu_q32s_rv32im(const int32_t *__restrict__ pLU,
+                                  const uint32_t *__restrict__ pPerm,
+                                  uint32_t N,
+                                  const int32_t *__restrict__ pB,
+                                  uint32_t K,
+                                  uint32_t fracBits,
+                                  int32_t *__restrict__ pDst) {
+
+    uint32_t i, j, c;
+
+    /* forward substitution with the unit lower triangular matrix L */
+    for (i = 0; i < N; i++) {
+        const int32_t *pRowL = &pLU[i * N];
+        const int32_t *pRowB = &pB[pPerm[i] * K];
+        for (c = 0; c < K; c++) {
+            int64_t acc = (int64_t)pRowB[c] << fracBits;
+            for (j = 0; j < i; j++) {
+                acc -= (int64_t)pRowL[j] * pDst[j * K + c];
+            }
+            pDst[i * K + c] = (int32_t)(acc >> fracBits);
+        }
+    }
+
+    /* backward substitution with the upper triangular matrix U */
+    for (i = N; i > 0; i--) {
+        const int32_t *pRowU = &pLU[(i - 1) * N];
+        int32_t diag = pRowU[i - 1];
+        for (c = 0; c < K; c++) {
+            int64_t acc = (int64_t)pDst[(i - 1) * K + c] << fracBits;
+            for (j = i; j < N; j++) {
+                acc -= (int64_t)pRowU[j] * pDst[j * K + c];
+            }
+            pDst[(i - 1) * K + c] = (int32_t)(acc / diag);
+        }
+    }
+}
+
+/**
+  @} end of MatSolveKernels group
+ */
@@ -0,0 +1,80 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_cholesky_f32_parallel.c
+ * Description:  parallel 32-bit floating-point Cholesky linear system solver glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for parallel linear system solver with Cholesky decomposition of 32-bit
+  floating-point matrices.
+  @param[in]  pL       Points to the Cholesky decomposition of A, computed by
+                       plp_mat_cholesky_f32
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  nPE      Number of cores to use for computation
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+
+  @par This function will use plp_mat_solve_cholesky_f32p_xpulpv2 for its computation.
+ */
+
+void plp_mat_solve_cholesky_f32_parallel(const float *__restrict__ pL,
+                                         uint32_t N,
+                                         const float *__restrict__ pB,
+                                         uint32_t K,
+                                         uint32_t nPE,
+                                         float *__restrict__ pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel and floating-point processing supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_solve_cholesky_instance_f32 args = {
+            .pL = pL,
+            .N = N,
+            .pB = pB,
+            .K = K,
+            .nPE = nPE,
+            .pDst = pDst,
+        };
+        hal_cl_team_fork(nPE, plp_mat_solve_cholesky_f32p_xpulpv2, (void *)&args);
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
@@ -0,0 +1,88 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lu_f32.c
+ * Description:  32-bit floating-point LU linear system solver glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatSolve linear system solver
+  This module contains the glue code for solving linear systems. The kernel codes (kernels) are in
+  the Module linear system solver Kernels.
+
+  These functions solve the linear system A X = B for a square matrix A of shape NxN and K
+  right-hand sides B of shape NxK, given the LU decomposition (plp_mat_lu_f32) or the Cholesky
+  decomposition (plp_mat_cholesky_f32) of A. The solution costs O(N^2 K) operations with forward
+  and backward substitution, such that a factorization can be reused for many right-hand sides.
+
+  @par Algorithm
+  With P A = L U, first L Y = P B is solved by forward substitution, and then U X = Y by backward
+  substitution. With A = L L^T, L Y = B and L^T X = Y are solved in the same way. The
+  intermediate result Y is stored in pDst, which must not overlap with pB.
+
+  There are functions for 32-bit floating-point and 32-bit fix-point matrices.
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for linear system solver with LU decomposition of 32-bit floating-point matrices.
+  @param[in]  pLU      Points to the LU decomposition of A, computed by plp_mat_lu_f32
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+
+  @par This function will use plp_mat_solve_lu_f32s_xpulpv2 for its computation.
+ */
+
+void plp_mat_solve_lu_f32(const float *__restrict__ pLU,
+                          const uint32_t *__restrict__ pPerm,
+                          uint32_t N,
+                          const float *__restrict__ pB,
+                          uint32_t K,
+                          float *__restrict__ pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("Floating point is supported only for cluster side\n");
+        return;
+    } else {
+        plp_mat_solve_lu_f32s_xpulpv2(pLU, pPerm, N, pB, K, pDst);
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
@@ -0,0 +1,73 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_mat_solve_lu_q32.c
+ * Description:  32-bit fix-point LU linear system solver glue code
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatSolve
+  @{
+ */
+
+/**
+  @brief Glue code for linear system solver with LU decomposition of 32-bit fix-point matrices.
+  @param[in]  pLU      Points to the LU decomposition of A, computed by plp_mat_lu_q32
+  @param[in]  pPerm    Points to the row permutation of the LU decomposition
+  @param[in]  N        Width and height of A
+  @param[in]  pB       Points to the right-hand sides of shape NxK
+  @param[in]  K        Number of right-hand sides
+  @param[in]  fracBits Number of fractional bits
+  @param[out] pDst     Points to the solution X of shape NxK
+  @return     none
+
+  @par Fix-Point
+  All values are represented in fix-point with fracBits fractional bits, using the same
+  representation as the decomposition. The dot products are accumulated with 64 bits.
+ */
+
+void plp_mat_solve_lu_q32(const int32_t *__restrict__ pLU,
+                          const uint32_t *__restrict__ pPerm,
+                          uint32_t N,
+                          const int32_t *__restrict__ pB,
+                          uint32_t K,
+                          uint32_t fracBits,
+                          int32_t *__restrict__ pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_mat_solve_lu_q32s_rv32im(pLU, pPerm, N, pB, K, fracBits, pDst);
+    } else {
+        plp_mat_solve_lu_q32s_xpulpv2(pLU, pPerm, N, pB, K, fracBits, pDst);
+    }
+}
+
+/**
+  @} end of MatSolve group
+ */
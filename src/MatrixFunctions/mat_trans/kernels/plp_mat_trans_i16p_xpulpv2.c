@@ -65,8 +65,11 @@ void plp_mat_trans_i16p_xpulpv2(void *args) {
 #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, N, 1, nPE, core_id, &tile);
+
+    for (int m = tile.rowStart; m < tile.rowEnd; m++) {
+        for (int n = tile.colStart; n < tile.colEnd; n++) {
             pDst[n * M + m] = pSrc[m * N + n];
         }
     }
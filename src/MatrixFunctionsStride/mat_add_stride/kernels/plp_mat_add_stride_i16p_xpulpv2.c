@@ -71,28 +71,35 @@ void plp_mat_add_stride_i16p_xpulpv2(void *args) {
 
     uint32_t m, n; // loop counters
 
-    for (m = core_id; m < M; m += nPE) {
-        for (n = 0; n < N; n++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, N, 1, nPE, core_id, &tile);
+
+    for (m = tile.rowStart; m < tile.rowEnd; m++) {
+        for (n = tile.colStart; n < tile.colEnd; n++) {
             pDst[m * strideY + n] = pSrcA[m * strideA + n] + pSrcB[m * strideB + n];
         }
     }
 
 #else
 
+    plp_mat_tile tile;
+    plp_mat_partition(M, N, 4, nPE, core_id, &tile);
+    uint32_t width = tile.colEnd - tile.colStart; // number of columns of the tile
+
     uint32_t m, n; // loop counters
 
-    unsigned int n_iter = N >> 2;
-    unsigned int n_rem = N & 0x3;
+    unsigned int n_iter = width >> 2;
+    unsigned int n_rem = width & 0x3;
 
-    pSrcA += strideA * core_id;
-    pSrcB += strideB * core_id;
-    pDst += strideY * core_id;
+    pSrcA += strideA * tile.rowStart + tile.colStart;
+    pSrcB += strideB * tile.rowStart + tile.colStart;
+    pDst += strideY * tile.rowStart + tile.colStart;
 
-    unsigned int step_a = strideA * nPE - N;
-    unsigned int step_b = strideB * nPE - N;
-    unsigned int step_y = strideY * nPE - N;
+    unsigned int step_a = strideA - width;
+    unsigned int step_b = strideB - width;
+    unsigned int step_y = strideY - width;
 
-    for (m = core_id; m < M; m += nPE) {
+    for (m = tile.rowStart; m < tile.rowEnd; m++) {
         for (n = 0; n < n_iter; n++) {
             v2s a1 = *((v2s *)pSrcA);
             v2s b1 = *((v2s *)pSrcB);
@@ -63,27 +63,34 @@ void plp_mat_copy_stride_i32p_xpulpv2(void *args) {
 //#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
-    for (int m = core_id; m < M; m += nPE) {
-        for (int n = 0; n < N; n++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, N, 1, nPE, core_id, &tile);
+
+    for (int m = tile.rowStart; m < tile.rowEnd; m++) {
+        for (int n = tile.colStart; n < tile.colEnd; n++) {
             pDst[m * strideDst + n] = pSrc[m * strideSrc + n];
         }
     }
 
 #else
 
+    plp_mat_tile tile;
+    plp_mat_partition(M, N, 2, nPE, core_id, &tile);
+    uint32_t width = tile.colEnd - tile.colStart; // number of columns of the tile
+
     unsigned int m;
     unsigned int n;
 
-    pSrc += strideSrc * core_id;
-    pDst += strideDst * core_id;
+    pSrc += strideSrc * tile.rowStart + tile.colStart;
+    pDst += strideDst * tile.rowStart + tile.colStart;
 
-    unsigned int src_offset = (strideSrc * nPE) - N;
-    unsigned int dst_offset = (strideDst * nPE) - N;
+    unsigned int src_offset = strideSrc - width;
+    unsigned int dst_offset = strideDst - width;
 
-    unsigned int n_iter = N >> 1;
-    unsigned int n_rem = N & 0x00000001;
+    unsigned int n_iter = width >> 1;
+    unsigned int n_rem = width & 0x00000001;
 
-    for (m = core_id; m < M; m += nPE) {
+    for (m = tile.rowStart; m < tile.rowEnd; m++) {
         for (n = 0; n < n_iter; n++) {
             *pDst++ = *pSrc++;
             *pDst++ = *pSrc++;
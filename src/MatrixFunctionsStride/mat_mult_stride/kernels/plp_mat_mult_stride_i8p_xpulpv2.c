@@ -47,10 +47,19 @@
    @return     none
 
    @par Exploiting SIMD instructions
-   The 8 bit values are packed four each into 32 bit vectors and then the four dot products are
-   performed on 32 bit vectors, with 32 bit accumulator.
+   The output is computed in blocks of 2x4 elements. For every block, four rows of B are loaded
+   and transposed with shuffles, such that each 32 bit vector holds four consecutive elements of
+   one column of B. Each of the two 4-element vectors of A is then reused for four __SUMDOTP4
+   with 32 bit accumulator. The output is split among the cores with plp_mat_partition, in
+   multiples of 4 columns. The remaining rows, columns and elements of the inner dimension are
+   computed with scalar instructions.
 */
 
+HAL_CL_L1 static v4s mask0 = { 0, 1, 4, 5 };
+HAL_CL_L1 static v4s mask1 = { 2, 3, 6, 7 };
+HAL_CL_L1 static v4s mask2 = { 0, 2, 4, 6 };
+HAL_CL_L1 static v4s mask3 = { 1, 3, 5, 7 };
+
 void plp_mat_mult_stride_i8p_xpulpv2(void *args) {
 
     int core_id = hal_core_id();
@@ -68,13 +77,16 @@ void plp_mat_mult_stride_i8p_xpulpv2(void *args) {
     uint32_t nPE = a->nPE;
     int32_t *__restrict__ pDstC = a->pDstC;
 
-#define BASIC_VERSION // if used don't forget to also use the undefine at end of file
+// #define BASIC_VERSION // if used don't forget to also use the undefine at end of file
 #ifdef BASIC_VERSION
 
     uint32_t m, n, o;
 
-    for (m = core_id; m < M; m += nPE) {
-        for (o = 0; o < O; o++) {
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 1, nPE, core_id, &tile);
+
+    for (m = tile.rowStart; m < tile.rowEnd; m++) {
+        for (o = tile.colStart; o < tile.colEnd; o++) {
             int32_t sum = 0;
             for (n = 0; n < N; n++) {
                 int32_t valA = (int32_t)pSrcA[m * strideA + n];
@@ -87,7 +99,105 @@ void plp_mat_mult_stride_i8p_xpulpv2(void *args) {
 
 #else
 
-    // TODO: Hackathon
+    uint32_t m, n, o;
+
+    plp_mat_tile tile;
+    plp_mat_partition(M, O, 4, nPE, core_id, &tile);
+
+    uint32_t NEnd = N & ~3U; // elements covered by the SIMD dot products
+    uint32_t OEnd = tile.colStart + ((tile.colEnd - tile.colStart) & ~3U); // covered by 2x4 blocks
+
+    for (o = tile.colStart; o < OEnd; o += 4) {
+        for (m = tile.rowStart; m < tile.rowEnd; m += 2) {
+
+            // for an odd number of rows, the last block has a single row, which is computed twice
+            uint32_t m1 = (m + 1 < tile.rowEnd) ? m + 1 : m;
+
+            const int8_t *pA0 = &pSrcA[m * strideA];
+            const int8_t *pA1 = &pSrcA[m1 * strideA];
+            const int8_t *pB = &pSrcB[o];
+
+            int32_t sum00 = 0;
+            int32_t sum01 = 0;
+            int32_t sum02 = 0;
+            int32_t sum03 = 0;
+            int32_t sum10 = 0;
+            int32_t sum11 = 0;
+            int32_t sum12 = 0;
+            int32_t sum13 = 0;
+
+            for (n = 0; n < NEnd; n += 4) {
+
+                v4s aVec0 = *((v4s *)&pA0[n]);
+                v4s aVec1 = *((v4s *)&pA1[n]);
+
+                v4s temp0 = *((v4s *)&pB[0]);
+                v4s temp1 = *((v4s *)&pB[strideB]);
+                v4s temp2 = *((v4s *)&pB[2 * strideB]);
+                v4s temp3 = *((v4s *)&pB[3 * strideB]);
+                pB += 4 * strideB;
+
+                v4s temp4 = __builtin_shuffle(temp0, temp1, mask0); // 0,1,4,5
+                v4s temp5 = __builtin_shuffle(temp2, temp3, mask0); // 8,9,12,13
+                v4s temp6 = __builtin_shuffle(temp0, temp1, mask1); // 2,3,6,7
+                v4s temp7 = __builtin_shuffle(temp2, temp3, mask1); // 10,11,14,15
+
+                v4s bVec0 = __builtin_shuffle(temp4, temp5, mask2); // 0,4,8,12
+                v4s bVec1 = __builtin_shuffle(temp4, temp5, mask3); // 1,5,9,13
+                v4s bVec2 = __builtin_shuffle(temp6, temp7, mask2); // 2,6,10,14
+                v4s bVec3 = __builtin_shuffle(temp6, temp7, mask3); // 3,7,11,15
+
+                sum00 = __SUMDOTP4(aVec0, bVec0, sum00);
+                sum01 = __SUMDOTP4(aVec0, bVec1, sum01);
+                sum02 = __SUMDOTP4(aVec0, bVec2, sum02);
+                sum03 = __SUMDOTP4(aVec0, bVec3, sum03);
+                sum10 = __SUMDOTP4(aVec1, bVec0, sum10);
+                sum11 = __SUMDOTP4(aVec1, bVec1, sum11);
+                sum12 = __SUMDOTP4(aVec1, bVec2, sum12);
+                sum13 = __SUMDOTP4(aVec1, bVec3, sum13);
+            }
+
+            // remaining elements of the inner dimension
+            for (n = NEnd; n < N; n++) {
+                int32_t a0 = pA0[n];
+                int32_t a1 = pA1[n];
+                int32_t b0 = pB[0];
+                int32_t b1 = pB[1];
+                int32_t b2 = pB[2];
+                int32_t b3 = pB[3];
+                pB += strideB;
+
+                sum00 += a0 * b0;
+                sum01 += a0 * b1;
+                sum02 += a0 * b2;
+                sum03 += a0 * b3;
+                sum10 += a1 * b0;
+                sum11 += a1 * b1;
+                sum12 += a1 * b2;
+                sum13 += a1 * b3;
+            }
+
+            pDstC[m * strideC + o] = sum00;
+            pDstC[m * strideC + o + 1] = sum01;
+            pDstC[m * strideC + o + 2] = sum02;
+            pDstC[m * strideC + o + 3] = sum03;
+            pDstC[m1 * strideC + o] = sum10;
+            pDstC[m1 * strideC + o + 1] = sum11;
+            pDstC[m1 * strideC + o + 2] = sum12;
+            pDstC[m1 * strideC + o + 3] = sum13;
+        }
+    }
+
+    // remaining columns, if O is not a multiple of 4
+    for (m = tile.rowStart; m < tile.rowEnd; m++) {
+        for (o = OEnd; o < tile.colEnd; o++) {
+            int32_t sum = 0;
+            for (n = 0; n < N; n++) {
+                sum += (int32_t)pSrcA[m * strideA + n] * (int32_t)pSrcB[n * strideB + o];
+            }
+            pDstC[m * strideC + o] = sum;
+        }
+    }
 
 #endif
 #undef BASIC_VERSION
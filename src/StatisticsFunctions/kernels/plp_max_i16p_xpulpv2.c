@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_i16p_xpulpv2.c
+ * Description:  Parallel max kernel of a 16-bit integer vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup max
+*/
+
+/**
+   @addtogroup maxKernels
+   @{
+*/
+
+/**
+   @brief      Parallel max value of a 16-bit integer vector for XPULPV2 extension.
+   @param[in]  args  pointer to plp_stats_instance_i16 struct initialized by
+                     plp_max_i16_parallel
+   @return     none
+
+   @par
+   The samples are split into contiguous blocks of a multiple of 2 samples, one per core, and
+   every core writes the max value of its block to S->resBuffer[core_id].
+*/
+void plp_max_i16p_xpulpv2(void *args) {
+
+    plp_stats_instance_i16 *S = (plp_stats_instance_i16 *)args;
+
+    uint32_t core_id = hal_core_id();
+    uint32_t blkLen = ((S->blockSize + 2 * S->nPE - 1) / (2 * S->nPE)) * 2;
+    uint32_t start = MIN(core_id * blkLen, S->blockSize);
+    uint32_t stop = MIN(start + blkLen, S->blockSize);
+
+    int16_t max;
+
+    if (stop > start) {
+        plp_max_i16s_xpulpv2(S->pSrc + start, stop - start, &max);
+    } else {
+        max = S->pSrc[0]; // a core without samples must not change the result
+    }
+
+    S->resBuffer[core_id] = max;
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of maxKernels group
+*/
@@ -0,0 +1,76 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_min_i8p_xpulpv2.c
+ * Description:  Parallel min kernel of a 8-bit integer vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup min
+*/
+
+/**
+   @addtogroup minKernels
+   @{
+*/
+
+/**
+   @brief      Parallel min value of a 8-bit integer vector for XPULPV2 extension.
+   @param[in]  args  pointer to plp_stats_instance_i8 struct initialized by
+                     plp_min_i8_parallel
+   @return     none
+
+   @par
+   The samples are split into contiguous blocks of a multiple of 4 samples, one per core, and
+   every core writes the min value of its block to S->resBuffer[core_id].
+*/
+void plp_min_i8p_xpulpv2(void *args) {
+
+    plp_stats_instance_i8 *S = (plp_stats_instance_i8 *)args;
+
+    uint32_t core_id = hal_core_id();
+    uint32_t blkLen = ((S->blockSize + 4 * S->nPE - 1) / (4 * S->nPE)) * 4;
+    uint32_t start = MIN(core_id * blkLen, S->blockSize);
+    uint32_t stop = MIN(start + blkLen, S->blockSize);
+
+    int8_t min;
+
+    if (stop > start) {
+        plp_min_i8s_xpulpv2(S->pSrc + start, stop - start, &min);
+    } else {
+        min = S->pSrc[0]; // a core without samples must not change the result
+    }
+
+    S->resBuffer[core_id] = min;
+
+    hal_team_barrier();
+}
+
+/**
+   @} end of minKernels group
+*/
@@ -84,7 +84,10 @@ void plp_power_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
     for (blkCnt = 0; blkCnt < (blockSize >> 2); blkCnt++) {
       x1 = *((v4s*)pSrc);
       pSrc += 4;
-      sum = __builtin_pulp_sdotsp4(x1,x1,sum) >> fracBits;
+      sum += ((x1[0] * x1[0]) >> fracBits);
+      sum += ((x1[1] * x1[1]) >> fracBits);
+      sum += ((x1[2] * x1[2]) >> fracBits);
+      sum += ((x1[3] * x1[3]) >> fracBits);
     }
 
     for (int i=0;i<blockSize % 4;i++) {
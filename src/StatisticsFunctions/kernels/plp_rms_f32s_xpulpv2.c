@@ -73,6 +73,9 @@ void plp_rms_f32s_xpulpv2(const float *__restrict__ pSrc,
                           uint32_t blockSize,
                           float *__restrict__ pRes) {
 
-    plp_power_f32(pSrc, blockSize, pRes);
-    *pRes = (*pRes) / blockSize;
+    float power;
+
+    plp_power_f32(pSrc, blockSize, &power);
+    power = power / blockSize;
+    plp_sqrt_f32(&power, pRes);
 }
@@ -80,5 +80,6 @@ void plp_rms_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
         accu += ((temp * temp) >> fracBits);
     }
 
-    *pRes = accu / blockSize;
+    accu = plp_sqrt_core_q32(accu / blockSize, fracBits);
+    *pRes = (accu > 0x7FFF) ? 0x7FFF : accu;
 }
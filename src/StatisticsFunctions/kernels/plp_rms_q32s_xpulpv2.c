@@ -74,6 +74,8 @@ void plp_rms_q32s_xpulpv2(const int32_t *__restrict__ pSrc,
                           uint32_t fracBits,
                           int32_t *__restrict__ pRes) {
 
-    plp_power_q32(pSrc, blockSize, fracBits, pRes);
-    *pRes = (*pRes) / blockSize;
+    int32_t power;
+
+    plp_power_q32(pSrc, blockSize, fracBits, &power);
+    *pRes = plp_sqrt_core_q32(power / blockSize, fracBits);
 }
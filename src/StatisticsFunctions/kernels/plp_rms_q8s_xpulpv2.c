@@ -81,5 +81,6 @@ void plp_rms_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
         accu += ((temp * temp) >> fracBits);
     }
 
-    *pRes = accu / blockSize;
+    accu = plp_sqrt_core_q32(accu / blockSize, fracBits);
+    *pRes = (accu > 0x7F) ? 0x7F : accu;
 }
@@ -28,7 +28,6 @@
  */
 
 #include "plp_math.h"
-#include <float.h>
 
 /**
   @ingroup var
@@ -49,19 +48,18 @@
    @param[in]     blockSize  number of samples in input vector
    @param[out]    pRes    variance value returned here
    @return        none
+
+   @par
+   The input is read once, see plp_var_partial_f32s_xpulpv2.
 */
 
 void plp_var_f32s_xpulpv2(const float *__restrict__ pSrc,
                           uint32_t blockSize,
                           float *__restrict__ pRes) {
 
-    float square_of_mean;
-    float square_of_values;
-
-    plp_mean_f32(pSrc, blockSize, &square_of_mean);
-    square_of_mean *= square_of_mean;
+    plp_var_partial_f32 partial;
 
-    plp_power_f32(pSrc, blockSize, &square_of_values);
+    plp_var_partial_f32s_xpulpv2(pSrc, blockSize, &partial);
 
-    *pRes = (square_of_values / blockSize - square_of_mean);
+    *pRes = partial.m2 / blockSize;
 }
@@ -0,0 +1,127 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_var_partial_f32s_xpulpv2.c
+ * Description:  Partial variance statistics of a 32-bit float vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup var
+*/
+
+/**
+   @addtogroup varKernels
+   @{
+*/
+
+/**
+   @brief         Partial variance statistics of a 32-bit float vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes       partial statistics returned here
+   @return        none
+
+   @par
+   Instead of E[x^2] - E[x]^2, the mean and the sum of the squared deviations from the mean (M2)
+   are computed with the shifted-data algorithm, i.e. from the sums of the deviations d = x - x[0]
+   and of their squares, in a single pass over the input. This removes the cancellation due to an
+   offset of the signal, but not the one of a signal which drifts far from x[0]: M2 is then again
+   the difference of two large sums, sum(d^2) - sum(d)^2 / blockSize.
+*/
+
+void plp_var_partial_f32s_xpulpv2(const float32_t *__restrict__ pSrc,
+                                  uint32_t blockSize,
+                                  plp_var_partial_f32 *__restrict__ pRes) {
+
+    uint32_t blkCnt; /* Loop counter */
+    float32_t ref, d, mean;
+    float32_t sum = 0.0f, sumSq = 0.0f;
+
+    pRes->count = blockSize;
+
+    if (blockSize == 0) {
+        pRes->mean = 0.0f;
+        pRes->m2 = 0.0f;
+        return;
+    }
+
+    /* The deviations from the first sample are accumulated, such that an offset of the signal does
+     * not cancel in sumSq - sum * sum / blockSize */
+    ref = pSrc[0];
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    float32_t d1;
+    float32_t sum1 = 0.0f, sumSq1 = 0.0f;
+
+    /* Loop unrolling: Compute 2 samples at a time with independent accumulators */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        d = *pSrc++ - ref;
+        d1 = *pSrc++ - ref;
+        sum += d;
+        sumSq += d * d;
+        sum1 += d1;
+        sumSq1 += d1 * d1;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    sum += sum1;
+    sumSq += sumSq1;
+
+    /* Loop unrolling: Compute remaining samples */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        d = *pSrc++ - ref;
+        sum += d;
+        sumSq += d * d;
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    mean = sum / (float32_t)blockSize;
+    pRes->mean = ref + mean;
+    pRes->m2 = sumSq - sum * mean;
+    if (pRes->m2 < 0.0f) {
+        pRes->m2 = 0.0f;
+    }
+}
+
+/**
+   @} end of varKernels group
+*/
@@ -0,0 +1,122 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_var_partial_q32s_rv32im.c
+ * Description:  Partial variance statistics of a 32-bit fixed point vector on RV32IM
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup var
+*/
+
+/**
+   @addtogroup varKernels
+   @{
+*/
+
+/**
+   @brief         Partial variance statistics of a 32-bit fixed point vector for RV32IM extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     ref        reference sample, which is subtracted from all samples
+   @param[out]    pRes       partial statistics returned here
+   @return        none
+
+   @par
+   The sum of the deviations from ref is an exact 64-bit integer, and the sum of their squares an
+   exact 96-bit integer, which counts the carries out of the lower 64 bits in sumSqHi. Choosing a
+   sample as ref keeps the sums small for signals with an offset.
+*/
+
+void plp_var_partial_q32s_rv32im(const int32_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 int32_t ref,
+                                 plp_var_partial_q *__restrict__ pRes) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int64_t d;
+    uint32_t absD;
+    uint64_t sq;
+    int64_t sum = 0;
+    uint64_t sumSq = 0;
+    uint32_t sumSqHi = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    int64_t d1;
+    uint32_t absD1;
+
+    /* Loop unrolling: Compute 2 samples at a time */
+    blkCnt = blockSize >> 1U;
+
+    while (blkCnt > 0U) {
+        d = (int64_t)*pSrc++ - ref;
+        d1 = (int64_t)*pSrc++ - ref;
+        absD = (uint32_t)((d < 0) ? -d : d);
+        absD1 = (uint32_t)((d1 < 0) ? -d1 : d1);
+        sum += d + d1;
+        sq = (uint64_t)absD * absD;
+        sumSq += sq;
+        sumSqHi += (sumSq < sq);
+        sq = (uint64_t)absD1 * absD1;
+        sumSq += sq;
+        sumSqHi += (sumSq < sq);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    /* Loop unrolling: Compute remaining samples */
+    blkCnt = blockSize % 0x2U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        d = (int64_t)*pSrc++ - ref;
+        absD = (uint32_t)((d < 0) ? -d : d);
+        sum += d;
+        sq = (uint64_t)absD * absD;
+        sumSq += sq;
+        sumSqHi += (sumSq < sq);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    pRes->count = blockSize;
+    pRes->sum = sum;
+    pRes->sumSq = sumSq;
+    pRes->sumSqHi = sumSqHi;
+}
+
+/**
+   @} end of varKernels group
+*/
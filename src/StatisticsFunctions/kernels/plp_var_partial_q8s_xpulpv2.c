@@ -0,0 +1,119 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_var_partial_q8s_xpulpv2.c
+ * Description:  Partial variance statistics of a 8-bit fixed point vector on XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+   @ingroup var
+*/
+
+/**
+   @addtogroup varKernels
+   @{
+*/
+
+/**
+   @brief         Partial variance statistics of a 8-bit fixed point vector for XPULPV2 extension.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[out]    pRes       partial statistics returned here
+   @return        none
+
+   @par
+   The sum of the samples and the sum of their squares are exact 64-bit integers.
+*/
+
+void plp_var_partial_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
+                                 uint32_t blockSize,
+                                 plp_var_partial_q *__restrict__ pRes) {
+
+    uint32_t blkCnt; /* Loop counter */
+    int32_t x;
+    int64_t sum = 0;
+    uint64_t sumSq = 0;
+
+#if defined(PLP_MATH_LOOPUNROLL)
+
+    uint32_t chunk, i;
+    int32_t sum32, sumSq32;
+    v4s x4;
+    v4s ones = { 1, 1, 1, 1 };
+
+    /* Loop unrolling: Compute 4 samples at a time with SIMD instructions. The 32-bit accumulators
+     * hold at most 2^14 iterations (2^30 for the squares) and are then added to the 64-bit sums */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U) {
+        chunk = MIN(blkCnt, 16384U);
+        sum32 = 0;
+        sumSq32 = 0;
+
+        for (i = 0; i < chunk; i++) {
+            x4 = *((v4s *)pSrc);
+            pSrc += 4;
+            sum32 = __SUMDOTP4(x4, ones, sum32);
+            sumSq32 = __SUMDOTP4(x4, x4, sumSq32);
+        }
+
+        sum += sum32;
+        sumSq += (uint32_t)sumSq32;
+
+        /* Decrement loop counter */
+        blkCnt -= chunk;
+    }
+
+    /* Loop unrolling: Compute remaining samples */
+    blkCnt = blockSize % 0x4U;
+
+#else // PLP_MATH_LOOPUNROLL
+
+    /* Initialize blkCnt with number of samples */
+    blkCnt = blockSize;
+
+#endif // PLP_MATH_LOOPUNROLL
+
+    while (blkCnt > 0U) {
+        x = *pSrc++;
+        sum += x;
+        sumSq += (uint32_t)(x * x);
+
+        /* Decrement loop counter */
+        blkCnt--;
+    }
+
+    pRes->count = blockSize;
+    pRes->sum = sum;
+    pRes->sumSq = sumSq;
+    pRes->sumSqHi = 0;
+}
+
+/**
+   @} end of varKernels group
+*/
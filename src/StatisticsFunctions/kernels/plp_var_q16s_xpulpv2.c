@@ -46,8 +46,12 @@
    @brief         Variance of a 16-bit fixed point vector for XPULPV2 extension.
    @param[in]     pSrc       points to the input vector
    @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   number of fractional bits of the input and output
    @param[out]    pRes    variance returned here
    @return        none
+
+   @par
+   The input is read once, see plp_var_partial_q16s_xpulpv2.
 */
 
 void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
@@ -55,15 +59,11 @@ void plp_var_q16s_xpulpv2(const int16_t *__restrict__ pSrc,
                           uint32_t fracBits,
                           int16_t *__restrict__ pRes) {
 
-    int32_t square_of_mean;
-    int32_t square_of_values;
-
-    int16_t mean;
-
-    plp_mean_i16(pSrc, blockSize, &mean);
-    square_of_mean = (mean * mean) >> fracBits;
+    plp_var_partial_q partial;
+    uint64_t var;
 
-    plp_power_q16(pSrc, blockSize, fracBits, &square_of_values);
+    plp_var_partial_q16s_xpulpv2(pSrc, blockSize, &partial);
 
-    *pRes = (square_of_values / blockSize - square_of_mean);
+    var = plp_var_result_q(&partial, fracBits);
+    *pRes = (var > 0x7FFF) ? 0x7FFF : (int16_t)var;
 }
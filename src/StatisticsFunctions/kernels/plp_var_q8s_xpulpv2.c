@@ -47,8 +47,12 @@
    @brief         Variance of a 8-bit fixed point vector for XPULPV2 extension.
    @param[in]     pSrc       points to the input vector
    @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   number of fractional bits of the input and output
    @param[out]    pRes    variance returned here
    @return        none
+
+   @par
+   The input is read once, see plp_var_partial_q8s_xpulpv2.
 */
 
 void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
@@ -56,15 +60,11 @@ void plp_var_q8s_xpulpv2(const int8_t *__restrict__ pSrc,
                          uint32_t fracBits,
                          int8_t *__restrict__ pRes) {
 
-    int32_t square_of_mean;
-    int32_t square_of_values;
-
-    int8_t mean;
-
-    plp_mean_i8(pSrc, blockSize, &mean);
-    square_of_mean = (mean * mean) >> fracBits;
+    plp_var_partial_q partial;
+    uint64_t var;
 
-    plp_power_q8(pSrc, blockSize, fracBits, &square_of_values);
+    plp_var_partial_q8s_xpulpv2(pSrc, blockSize, &partial);
 
-    *pRes = (square_of_values / blockSize - square_of_mean);
+    var = plp_var_result_q(&partial, fracBits);
+    *pRes = (var > 0x7F) ? 0x7F : (int8_t)var;
 }
@@ -0,0 +1,86 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_max_i16_parallel.c
+ * Description:  Parallel max value of a 16-bit integer vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup max
+   @{
+*/
+
+/**
+   @brief         Glue code for parallel max value of a 16-bit integer vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     nPE        number of parallel processing units
+   @param[out]    pRes       max value returned here
+   @return        none
+
+   @par
+   Every core reduces a contiguous block of samples to its max value, and the partial results are
+   combined on the calling core.
+*/
+
+void plp_max_i16_parallel(const int16_t *__restrict__ pSrc,
+                          uint32_t blockSize,
+                          uint32_t nPE,
+                          int16_t *__restrict__ pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    int32_t resBuffer[nPE];
+    plp_stats_instance_i16 S;
+
+    S.pSrc = pSrc;
+    S.blockSize = blockSize;
+    S.fracBits = 0;
+    S.nPE = nPE;
+    S.resBuffer = resBuffer;
+
+    hal_cl_team_fork(nPE, plp_max_i16p_xpulpv2, (void *)&S);
+
+    int32_t max = resBuffer[0];
+    for (uint32_t i = 1; i < nPE; i++) {
+        if (resBuffer[i] > max) {
+            max = resBuffer[i];
+        }
+    }
+
+    *pRes = (int16_t)max;
+}
+
+/**
+  @} end of max group
+ */
@@ -35,6 +35,11 @@
 
 /**
    @defgroup var Var
+
+   Variance of a vector, computed in a single pass over the input. Every block of samples is
+   reduced to partial statistics (the number of samples, the mean and the sum of the squared
+   deviations from the mean for floats, and the exact sums of the deviations from a reference
+   sample and of their squares for fixed point), which the parallel versions merge across cores.
 */
 
 /**
@@ -0,0 +1,85 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_var_q8_parallel.c
+ * Description:  Parallel variance of a 8-bit fixed point vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+   @ingroup groupStats
+*/
+
+/**
+   @addtogroup var
+   @{
+*/
+
+/**
+   @brief         Glue code for parallel variance of a 8-bit fixed point vector.
+   @param[in]     pSrc       points to the input vector
+   @param[in]     blockSize  number of samples in input vector
+   @param[in]     fracBits   number of fractional bits of the input and output
+   @param[in]     nPE        number of parallel processing units
+   @param[out]    pRes       variance returned here
+   @return        none
+
+   @par
+   Every core computes the partial statistics of a contiguous block, which are merged
+   by adding the exact sums.
+*/
+
+void plp_var_q8_parallel(const int8_t *__restrict__ pSrc,
+                         uint32_t blockSize,
+                         uint32_t fracBits,
+                         uint32_t nPE,
+                         int8_t *__restrict__ pRes) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        printf("parallel processing supported only for cluster side\n");
+        return;
+    }
+
+    plp_var_partial_q partial[nPE];
+    plp_var_instance_q8 S;
+
+    S.pSrc = pSrc;
+    S.blockSize = blockSize;
+    S.nPE = nPE;
+    S.pPartial = partial;
+
+    hal_cl_team_fork(nPE, plp_var_q8p_xpulpv2, (void *)&S);
+
+    for (uint32_t i = 1; i < nPE; i++) {
+        plp_var_merge_q(&partial[0], &partial[i]);
+    }
+
+    uint64_t var = plp_var_result_q(&partial[0], fracBits);
+    *pRes = (var > 0x7F) ? 0x7F : (int8_t)var;
+}
+
+/**
+  @} end of var group
+ */
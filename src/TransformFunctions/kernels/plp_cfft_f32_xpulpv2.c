@@ -94,8 +94,10 @@ static void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *
   buffer must contain at least (2*FFTLen) float32 values, corresponding to
   FFTLen complex values in the form (real part, complex part).
   Input and output can refer to the same memory location (in-place computation).
-  The best algorithm is executed based on the val FFTLen.
+  The best algorithm is executed based on the val FFTLen (see plp_cfft_f32_radix), any power of
+  two from 4 points is supported.
   Supported algorithms: radix-2, radix-4, radix-8
+  Other lengths are supported by the mixed-radix FFT (see plp_cfft_mixed_f32).
 */
 
 /**
@@ -103,6 +105,32 @@ static void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *
   @{
  */
 
+/**
+   @brief  Radix of the floating-point FFT kernel used for a given length: radix-8 if log2(N) is
+           a multiple of 3, radix-4 if it is even and radix-2 otherwise. The radix-r kernels need
+           at least r^2 points, smaller lengths fall back to the next smaller radix.
+   @param[in]   N       length of the FFT
+   @return      8, 4 or 2, or 0 if N is not a power of two larger than 2
+*/
+uint32_t plp_cfft_f32_radix(uint32_t N) {
+    uint32_t log2N = 0;
+
+    if (N < 4 || (N & (N - 1)) != 0) {
+        return 0;
+    }
+    while ((1U << log2N) < N) {
+        log2N++;
+    }
+
+    if (log2N % 3 == 0 && N >= 64) {
+        return 8;
+    } else if (log2N % 2 == 0 && N >= 16) {
+        return 4;
+    } else {
+        return 2;
+    }
+}
+
 /**
    @brief  Floating-point FFT on complex input data for XPULPV2 extension.
    @param[in]   S       points to an instance of the floating-point FFT structure
@@ -113,19 +141,14 @@ static void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *
 void plp_cfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
                           const float32_t *pSrc,
                           float32_t *pDst) {
-    switch(S->FFTLength) {
-      case 64:
-      case 512:
+    switch(plp_cfft_f32_radix(S->FFTLength)) {
+      case 8:
           plp_cfft_radix8_f32_xpulpv2(S, pSrc, pDst);
           break;
-      case 16:
-      case 256:
-      case 1024:
+      case 4:
           plp_cfft_radix4_f32_xpulpv2(S, pSrc, pDst);
           break;
-      case 32:
-      case 128:
-      case 2048:
+      case 2:
           plp_cfft_radix2_f32_xpulpv2(S, pSrc, pDst);
           break;
     }
@@ -429,19 +452,14 @@ static void plp_cfft_radix8_f32_xpulpv2(const plp_fft_instance_f32 *S,
    @return      none
 */
 void plp_cfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
-    switch(arg->S->FFTLength) {
-      case 64:
-      case 512:
+    switch(plp_cfft_f32_radix(arg->S->FFTLength)) {
+      case 8:
           plp_cfft_radix8_f32_xpulpv2_parallel(arg);
           break;
-      case 16:
-      case 256:
-      case 1024:
+      case 4:
           plp_cfft_radix4_f32_xpulpv2_parallel(arg);
           break;
-      case 32:
-      case 128:
-      case 2048:
+      case 2:
           plp_cfft_radix2_f32_xpulpv2_parallel(arg);
           break;
     }
@@ -451,7 +469,7 @@ void plp_cfft_radix2_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
 
     int k, j, stage, step, d, index;
 
-    plp_fft_instance_f32 *S = arg->S;
+    const plp_fft_instance_f32 *S = arg->S;
     const float32_t *pSrc = arg->pSrc;
     const uint32_t nPE = arg->nPE;
     float32_t *pDst = arg->pDst;
@@ -578,7 +596,7 @@ void plp_cfft_radix4_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
 
     int k, j, stage, step, d, index;
 
-    plp_fft_instance_f32 *S = arg->S;
+    const plp_fft_instance_f32 *S = arg->S;
     const float32_t *pSrc = arg->pSrc;
     const uint32_t nPE = arg->nPE;
     float32_t *pDst = arg->pDst;
@@ -710,7 +728,7 @@ void plp_cfft_radix4_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
 
 void plp_cfft_radix8_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
   int k, j, stage, step, d, index;
-  plp_fft_instance_f32 *S = arg->S;
+  const plp_fft_instance_f32 *S = arg->S;
   const float32_t *pSrc = arg->pSrc;
   const uint32_t nPE = arg->nPE;
   float32_t *pDst = arg->pDst;
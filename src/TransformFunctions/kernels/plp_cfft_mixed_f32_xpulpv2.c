@@ -0,0 +1,394 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_f32_xpulpv2.c
+ * Description:  Floating-point mixed-radix FFT on complex input data for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores with "F" support (wolfe, vega)
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIXED_SIN_PI_3 0.866025404f  // sin(2*pi/3)
+#define MIXED_COS_2PI_5 0.309016994f // cos(2*pi/5)
+#define MIXED_COS_4PI_5 -0.809016994f
+#define MIXED_SIN_2PI_5 0.951056516f
+#define MIXED_SIN_4PI_5 0.587785252f
+#define MIXED_SQRT1_2 0.707106781f
+
+typedef void (*plp_cfft_mixed_dft_f32)(const Complex_type_f32 *in,
+                                       uint32_t stride,
+                                       Complex_type_f32 *out);
+
+static inline Complex_type_f32 plp_cfft_mixed_mul(Complex_type_f32 a, Complex_type_f32 b) {
+    Complex_type_f32 r;
+    r.re = a.re * b.re - a.im * b.im;
+    r.im = a.re * b.im + a.im * b.re;
+    return r;
+}
+
+/* Short DFTs (forward direction, W_p = e^{-j 2 pi / p}) on the inputs in[j * stride] */
+
+static inline void plp_cfft_mixed_dft2(const Complex_type_f32 *in,
+                                       uint32_t stride,
+                                       Complex_type_f32 *out) {
+    Complex_type_f32 a0 = in[0];
+    Complex_type_f32 a1 = in[stride];
+    out[0].re = a0.re + a1.re;
+    out[0].im = a0.im + a1.im;
+    out[1].re = a0.re - a1.re;
+    out[1].im = a0.im - a1.im;
+}
+
+static inline void plp_cfft_mixed_dft3(const Complex_type_f32 *in,
+                                       uint32_t stride,
+                                       Complex_type_f32 *out) {
+    Complex_type_f32 a0 = in[0];
+    Complex_type_f32 a1 = in[stride];
+    Complex_type_f32 a2 = in[2 * stride];
+    float32_t sre = a1.re + a2.re;
+    float32_t sim = a1.im + a2.im;
+    float32_t mre = a0.re - 0.5f * sre;
+    float32_t mim = a0.im - 0.5f * sim;
+    float32_t dre = MIXED_SIN_PI_3 * (a1.re - a2.re);
+    float32_t dim = MIXED_SIN_PI_3 * (a1.im - a2.im);
+    out[0].re = a0.re + sre;
+    out[0].im = a0.im + sim;
+    out[1].re = mre + dim;
+    out[1].im = mim - dre;
+    out[2].re = mre - dim;
+    out[2].im = mim + dre;
+}
+
+static inline void plp_cfft_mixed_dft4(const Complex_type_f32 *in,
+                                       uint32_t stride,
+                                       Complex_type_f32 *out) {
+    Complex_type_f32 a0 = in[0];
+    Complex_type_f32 a1 = in[stride];
+    Complex_type_f32 a2 = in[2 * stride];
+    Complex_type_f32 a3 = in[3 * stride];
+    float32_t s02re = a0.re + a2.re;
+    float32_t s02im = a0.im + a2.im;
+    float32_t d02re = a0.re - a2.re;
+    float32_t d02im = a0.im - a2.im;
+    float32_t s13re = a1.re + a3.re;
+    float32_t s13im = a1.im + a3.im;
+    float32_t d13re = a1.re - a3.re;
+    float32_t d13im = a1.im - a3.im;
+    out[0].re = s02re + s13re;
+    out[0].im = s02im + s13im;
+    out[1].re = d02re + d13im;
+    out[1].im = d02im - d13re;
+    out[2].re = s02re - s13re;
+    out[2].im = s02im - s13im;
+    out[3].re = d02re - d13im;
+    out[3].im = d02im + d13re;
+}
+
+static inline void plp_cfft_mixed_dft5(const Complex_type_f32 *in,
+                                       uint32_t stride,
+                                       Complex_type_f32 *out) {
+    Complex_type_f32 a0 = in[0];
+    Complex_type_f32 a1 = in[stride];
+    Complex_type_f32 a2 = in[2 * stride];
+    Complex_type_f32 a3 = in[3 * stride];
+    Complex_type_f32 a4 = in[4 * stride];
+    float32_t s14re = a1.re + a4.re;
+    float32_t s14im = a1.im + a4.im;
+    float32_t s23re = a2.re + a3.re;
+    float32_t s23im = a2.im + a3.im;
+    float32_t d14re = a1.re - a4.re;
+    float32_t d14im = a1.im - a4.im;
+    float32_t d23re = a2.re - a3.re;
+    float32_t d23im = a2.im - a3.im;
+    float32_t m1re = a0.re + MIXED_COS_2PI_5 * s14re + MIXED_COS_4PI_5 * s23re;
+    float32_t m1im = a0.im + MIXED_COS_2PI_5 * s14im + MIXED_COS_4PI_5 * s23im;
+    float32_t m2re = a0.re + MIXED_COS_4PI_5 * s14re + MIXED_COS_2PI_5 * s23re;
+    float32_t m2im = a0.im + MIXED_COS_4PI_5 * s14im + MIXED_COS_2PI_5 * s23im;
+    float32_t n1re = MIXED_SIN_2PI_5 * d14re + MIXED_SIN_4PI_5 * d23re;
+    float32_t n1im = MIXED_SIN_2PI_5 * d14im + MIXED_SIN_4PI_5 * d23im;
+    float32_t n2re = MIXED_SIN_4PI_5 * d14re - MIXED_SIN_2PI_5 * d23re;
+    float32_t n2im = MIXED_SIN_4PI_5 * d14im - MIXED_SIN_2PI_5 * d23im;
+    out[0].re = a0.re + s14re + s23re;
+    out[0].im = a0.im + s14im + s23im;
+    out[1].re = m1re + n1im;
+    out[1].im = m1im - n1re;
+    out[4].re = m1re - n1im;
+    out[4].im = m1im + n1re;
+    out[2].re = m2re + n2im;
+    out[2].im = m2im - n2re;
+    out[3].re = m2re - n2im;
+    out[3].im = m2im + n2re;
+}
+
+static inline void plp_cfft_mixed_dft8(const Complex_type_f32 *in,
+                                       uint32_t stride,
+                                       Complex_type_f32 *out) {
+    Complex_type_f32 e[4];
+    Complex_type_f32 o[4];
+    Complex_type_f32 t1, t2, t3;
+
+    // radix-2 decimation in time: two 4-point DFTs on the even and odd inputs
+    plp_cfft_mixed_dft4(in, 2 * stride, e);
+    plp_cfft_mixed_dft4(in + stride, 2 * stride, o);
+
+    // o[r] * W_8^r
+    t1.re = MIXED_SQRT1_2 * (o[1].re + o[1].im);
+    t1.im = MIXED_SQRT1_2 * (o[1].im - o[1].re);
+    t2.re = o[2].im;
+    t2.im = -o[2].re;
+    t3.re = MIXED_SQRT1_2 * (o[3].im - o[3].re);
+    t3.im = -MIXED_SQRT1_2 * (o[3].re + o[3].im);
+
+    out[0].re = e[0].re + o[0].re;
+    out[0].im = e[0].im + o[0].im;
+    out[4].re = e[0].re - o[0].re;
+    out[4].im = e[0].im - o[0].im;
+    out[1].re = e[1].re + t1.re;
+    out[1].im = e[1].im + t1.im;
+    out[5].re = e[1].re - t1.re;
+    out[5].im = e[1].im - t1.im;
+    out[2].re = e[2].re + t2.re;
+    out[2].im = e[2].im + t2.im;
+    out[6].re = e[2].re - t2.re;
+    out[6].im = e[2].im - t2.im;
+    out[3].re = e[3].re + t3.re;
+    out[3].im = e[3].im + t3.im;
+    out[7].re = e[3].re - t3.re;
+    out[7].im = e[3].im - t3.im;
+}
+
+/*
+ * One Stockham autosort stage of radix p on a sub-sequence of length n = p * m with stride s
+ * (n * s = N): for every k < m and q < s, the inputs x[q + s * (k + j * m)], j = 0 .. p-1, are
+ * transformed by a p-point DFT, the r-th result is multiplied by W_N^(r * k * s) and stored to
+ * y[q + s * (p * k + r)]. Only the butterflies with kStart <= k < kEnd and qStart <= q < qEnd are
+ * computed, such that the stage can be split among the cores along either dimension.
+ */
+static inline void plp_cfft_mixed_stage_f32(const uint32_t p,
+                                            plp_cfft_mixed_dft_f32 dft,
+                                            const Complex_type_f32 *x,
+                                            Complex_type_f32 *y,
+                                            uint32_t m,
+                                            uint32_t s,
+                                            const Complex_type_f32 *pTwiddle,
+                                            uint32_t kStart,
+                                            uint32_t kEnd,
+                                            uint32_t qStart,
+                                            uint32_t qEnd) {
+    Complex_type_f32 w[8];
+    Complex_type_f32 b[8];
+    uint32_t k, q, r;
+
+    for (k = kStart; k < kEnd; k++) {
+        const Complex_type_f32 *in = &x[k * s];
+        Complex_type_f32 *out = &y[p * k * s];
+
+        if (k == 0) {
+            // all twiddle factors are 1
+            for (q = qStart; q < qEnd; q++) {
+                dft(&in[q], m * s, b);
+                for (r = 0; r < p; r++) {
+                    out[q + r * s] = b[r];
+                }
+            }
+        } else {
+            for (r = 1; r < p; r++) {
+                w[r] = pTwiddle[r * k * s];
+            }
+            for (q = qStart; q < qEnd; q++) {
+                dft(&in[q], m * s, b);
+                out[q] = b[0];
+                for (r = 1; r < p; r++) {
+                    out[q + r * s] = plp_cfft_mixed_mul(b[r], w[r]);
+                }
+            }
+        }
+    }
+}
+
+static void plp_cfft_mixed_radix_stage_f32(uint32_t radix,
+                                           const Complex_type_f32 *x,
+                                           Complex_type_f32 *y,
+                                           uint32_t m,
+                                           uint32_t s,
+                                           const Complex_type_f32 *pTwiddle,
+                                           uint32_t kStart,
+                                           uint32_t kEnd,
+                                           uint32_t qStart,
+                                           uint32_t qEnd) {
+    switch (radix) {
+    case 2:
+        plp_cfft_mixed_stage_f32(2, plp_cfft_mixed_dft2, x, y, m, s, pTwiddle, kStart, kEnd,
+                                 qStart, qEnd);
+        break;
+    case 3:
+        plp_cfft_mixed_stage_f32(3, plp_cfft_mixed_dft3, x, y, m, s, pTwiddle, kStart, kEnd,
+                                 qStart, qEnd);
+        break;
+    case 4:
+        plp_cfft_mixed_stage_f32(4, plp_cfft_mixed_dft4, x, y, m, s, pTwiddle, kStart, kEnd,
+                                 qStart, qEnd);
+        break;
+    case 5:
+        plp_cfft_mixed_stage_f32(5, plp_cfft_mixed_dft5, x, y, m, s, pTwiddle, kStart, kEnd,
+                                 qStart, qEnd);
+        break;
+    case 8:
+        plp_cfft_mixed_stage_f32(8, plp_cfft_mixed_dft8, x, y, m, s, pTwiddle, kStart, kEnd,
+                                 qStart, qEnd);
+        break;
+    }
+}
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @defgroup complexMixedFFTKernels Mixed-radix FFT kernels on complex input values
+  These kernels calculate the FFT transform on complex input data of any length N = 2^a 3^b 5^c,
+  following the radix decomposition stored in the plan (see plp_cfft_mixed_plan_init_f32).
+  The stages are computed with the Stockham autosort scheme, which needs no bit reversal but
+  alternates between the output and the scratch buffer of the plan. Input and output can refer to
+  the same memory location; in this case, the input is first copied to the scratch buffer if the
+  number of stages is odd.
+*/
+
+/**
+  @addtogroup complexMixedFFTKernels
+  @{
+ */
+
+/**
+   @brief  Floating-point mixed-radix FFT on complex input data for XPULPV2 extension.
+   @param[in]   S       points to the plan of the mixed-radix FFT
+   @param[in]   pSrc    points to the input buffer (complex data)
+   @param[out]  pDst    points to the output buffer (complex data)
+   @return      none
+*/
+void plp_cfft_mixed_f32_xpulpv2(const plp_cfft_mixed_plan_f32 *S,
+                                const float32_t *pSrc,
+                                float32_t *pDst) {
+
+    uint32_t N = S->FFTLength;
+    uint32_t nStages = S->nStages;
+    const Complex_type_f32 *x = (const Complex_type_f32 *)pSrc;
+    Complex_type_f32 *y;
+    uint32_t i, stage, m, s;
+
+    // the last stage has to write to pDst, the buffers alternate backwards from there
+    if (pSrc == pDst && (nStages & 0x1U || nStages == 0)) {
+        for (i = 0; i < N; i++) {
+            S->pScratch[i] = x[i];
+        }
+        x = S->pScratch;
+    }
+
+    if (nStages == 0) {
+        ((Complex_type_f32 *)pDst)[0] = x[0];
+        return;
+    }
+
+    m = N;
+    s = 1;
+    for (stage = 0; stage < nStages; stage++) {
+        uint32_t radix = S->radix[stage];
+        m = m / radix;
+        y = ((nStages - 1 - stage) & 0x1U) ? S->pScratch : (Complex_type_f32 *)pDst;
+
+        plp_cfft_mixed_radix_stage_f32(radix, x, y, m, s, S->pTwiddle, 0, m, 0, s);
+
+        x = y;
+        s = s * radix;
+    }
+}
+
+/**
+   @brief  Floating-point mixed-radix FFT on complex input data for XPULPV2 extension
+           (parallel version).
+   @param[in]   args    points to an instance of the parallel mixed-radix FFT structure
+   @return      none
+*/
+void plp_cfft_mixed_f32_xpulpv2_parallel(void *args) {
+
+    plp_cfft_mixed_instance_f32_parallel *arg = (plp_cfft_mixed_instance_f32_parallel *)args;
+    const plp_cfft_mixed_plan_f32 *S = arg->S;
+    uint32_t nPE = arg->nPE;
+    uint32_t core_id = hal_core_id();
+    uint32_t N = S->FFTLength;
+    uint32_t nStages = S->nStages;
+    const Complex_type_f32 *x = (const Complex_type_f32 *)arg->pSrc;
+    Complex_type_f32 *y;
+    uint32_t i, stage, m, s, chunk;
+
+    if (arg->pSrc == arg->pDst && (nStages & 0x1U || nStages == 0)) {
+        for (i = core_id; i < N; i += nPE) {
+            S->pScratch[i] = x[i];
+        }
+        x = S->pScratch;
+        hal_team_barrier();
+    }
+
+    if (nStages == 0) {
+        if (core_id == 0) {
+            ((Complex_type_f32 *)arg->pDst)[0] = x[0];
+        }
+        return;
+    }
+
+    m = N;
+    s = 1;
+    for (stage = 0; stage < nStages; stage++) {
+        uint32_t radix = S->radix[stage];
+        m = m / radix;
+        y = ((nStages - 1 - stage) & 0x1U) ? S->pScratch : (Complex_type_f32 *)arg->pDst;
+
+        // split the butterflies along k in the first stages and along q in the last ones
+        if (m >= nPE) {
+            chunk = (m + nPE - 1) / nPE;
+            uint32_t kStart = core_id * chunk;
+            uint32_t kEnd = kStart + chunk > m ? m : kStart + chunk;
+            if (kStart < kEnd) {
+                plp_cfft_mixed_radix_stage_f32(radix, x, y, m, s, S->pTwiddle, kStart, kEnd, 0,
+                                               s);
+            }
+        } else {
+            chunk = (s + nPE - 1) / nPE;
+            uint32_t qStart = core_id * chunk;
+            uint32_t qEnd = qStart + chunk > s ? s : qStart + chunk;
+            if (qStart < qEnd) {
+                plp_cfft_mixed_radix_stage_f32(radix, x, y, m, s, S->pTwiddle, 0, m, qStart,
+                                               qEnd);
+            }
+        }
+
+        hal_team_barrier();
+
+        x = y;
+        s = s * radix;
+    }
+}
+
+/**
+   @} end of complexMixedFFTKernels group
+*/
@@ -0,0 +1,378 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed point Fast Fourier Transform on Complex Input Data
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+#define multAcc_32x32_keep32_R(a, x, y) \
+    a = (int32_t)(((((int64_t)a) << 32) + ((int64_t)x * y) + 0x80000000LL) >> 32)
+
+#define multSub_32x32_keep32_R(a, x, y) \
+    a = (int32_t)(((((int64_t)a) << 32) - ((int64_t)x * y) + 0x80000000LL) >> 32)
+
+#define mult_32x32_keep32_R(a, x, y) a = (int32_t)(((int64_t)x * y + 0x80000000LL) >> 32)
+
+#define mult_32x32_keep32(x, y) ((int32_t)(((int64_t)(x) * (y)) >> 32))
+
+static void plp_cfft_radix4by2_q32p(int32_t *pSrc,
+                                    uint32_t fftLen,
+                                    const int32_t *pCoef,
+                                    int core_id,
+                                    uint32_t nPE);
+
+static void plp_radix4_butterfly_q32p(int32_t *pSrc,
+                                      uint32_t fftLen,
+                                      const int32_t *pCoef,
+                                      uint32_t twidCoefModifier,
+                                      int core_id,
+                                      uint32_t nPE);
+
+/**
+ * @brief      Parallel quantized 32 bit complex fast fourier transform for XPULPV2
+ *
+ * Every radix-4 stage is split among the cores, followed by a barrier. The scaling of each stage
+ * is the same as in plp_cfft_q32s_xpulpv2 (first stage 4 guard bits, every further stage a shift
+ * by 2), such that the result is bit-exact to the single-core implementation.
+ *
+ * @param[in]   args    points to the plp_cfft_instance_q32_parallel
+ */
+
+void plp_cfft_q32p_xpulpv2(void *args) {
+    int core_id = hal_core_id();
+    plp_cfft_instance_q32_parallel *a = (plp_cfft_instance_q32_parallel *)args;
+
+    uint32_t L = a->S->fftLen;
+
+    if (a->ifftFlag == 0) {
+        switch (L) {
+        case 16:
+        case 64:
+        case 256:
+        case 1024:
+        case 4096:
+            plp_radix4_butterfly_q32p(a->p1, L, a->S->pTwiddle, 1, core_id, a->nPE);
+            break;
+        case 32:
+        case 128:
+        case 512:
+        case 2048:
+            plp_cfft_radix4by2_q32p(a->p1, L, a->S->pTwiddle, core_id, a->nPE);
+            break;
+        }
+    }
+    hal_team_barrier();
+
+    if (a->bitReverseFlag)
+        plp_bitreversal_32p_xpulpv2((uint32_t *)a->p1, a->S->bitRevLength,
+                                    (const uint16_t *)a->S->pBitRevTable, a->nPE);
+}
+
+static void plp_cfft_radix4by2_q32p(int32_t *pSrc,
+                                    uint32_t fftLen,
+                                    const int32_t *pCoef,
+                                    int core_id,
+                                    uint32_t nPE) {
+    uint32_t i, l;
+    uint32_t n2, step;
+    int32_t xt, yt, cosVal, sinVal;
+    int32_t p0, p1;
+
+    n2 = fftLen >> 1U;
+    step = (n2 + nPE - 1) / nPE;
+
+    for (i = core_id * step; i < MIN(n2, core_id * step + step); i++) {
+        cosVal = pCoef[2 * i];
+        sinVal = pCoef[2 * i + 1];
+
+        l = i + n2;
+
+        xt = (pSrc[2 * i] >> 2U) - (pSrc[2 * l] >> 2U);
+        pSrc[2 * i] = (pSrc[2 * i] >> 2U) + (pSrc[2 * l] >> 2U);
+
+        yt = (pSrc[2 * i + 1] >> 2U) - (pSrc[2 * l + 1] >> 2U);
+        pSrc[2 * i + 1] = (pSrc[2 * l + 1] >> 2U) + (pSrc[2 * i + 1] >> 2U);
+
+        mult_32x32_keep32_R(p0, xt, cosVal);
+        mult_32x32_keep32_R(p1, yt, cosVal);
+        multAcc_32x32_keep32_R(p0, yt, sinVal);
+        multSub_32x32_keep32_R(p1, xt, sinVal);
+
+        pSrc[2 * l] = p0 << 1;
+        pSrc[2 * l + 1] = p1 << 1;
+    }
+
+    hal_team_barrier();
+
+    if (nPE > 1) {
+        /* both columns are independent, each of them is computed by one half of the cores */
+        if (core_id < nPE / 2) {
+            // first col
+            plp_radix4_butterfly_q32p(pSrc, n2, pCoef, 2U, core_id, nPE / 2);
+        } else {
+            // second col
+            plp_radix4_butterfly_q32p(pSrc + fftLen, n2, pCoef, 2U, core_id - nPE / 2,
+                                      nPE - nPE / 2);
+        }
+    } else {
+        // first col
+        plp_radix4_butterfly_q32p(pSrc, n2, pCoef, 2U, core_id, nPE);
+        // second col
+        plp_radix4_butterfly_q32p(pSrc + fftLen, n2, pCoef, 2U, core_id, nPE);
+    }
+
+    hal_team_barrier();
+
+    for (i = core_id * step; i < MIN(n2, core_id * step + step); i++) {
+        pSrc[4 * i + 0] <<= 1U;
+        pSrc[4 * i + 1] <<= 1U;
+        pSrc[4 * i + 2] <<= 1U;
+        pSrc[4 * i + 3] <<= 1U;
+    }
+}
+
+/**
+ * @brief  Core function for the parallel Q31 CFFT butterfly process.
+ *
+ * All cores of the team must call this function with the same fftLen, since it contains a barrier
+ * after every stage except the last one.
+ *
+ * @param[in, out] *pSrc            points to the in-place buffer of Q31 data type.
+ * @param[in]      fftLen           length of the FFT.
+ * @param[in]      *pCoef           points to twiddle coefficient buffer.
+ * @param[in]      twidCoefModifier twiddle coefficient modifier that supports different size FFTs
+ * with the same twiddle factor table.
+ * @param[in]      core_id          index of the core within the cores sharing this FFT
+ * @param[in]      nPE              number of cores sharing this FFT
+ * @return none.
+ */
+
+static void plp_radix4_butterfly_q32p(int32_t *pSrc,
+                                      uint32_t fftLen,
+                                      const int32_t *pCoef,
+                                      uint32_t twidCoefModifier,
+                                      int core_id,
+                                      uint32_t nPE) {
+    uint32_t n1, n2, ia1, ia2, ia3, i0, i1, i2, i3, j, k;
+    uint32_t g, groups, start, end, gStart, gEnd, step;
+    int32_t t1, t2, r1, r2, s1, s2, co1, co2, co3, si1, si2, si3;
+
+    int32_t xa, xb, xc, xd;
+    int32_t ya, yb, yc, yd;
+
+    int32_t *ptr1;
+
+    /* first stage, the butterflies i0 = 0 .. fftLen/4 - 1 are split among the cores */
+    n2 = fftLen >> 2U;
+    step = (n2 + nPE - 1) / nPE;
+
+    for (i0 = core_id * step; i0 < MIN(n2, core_id * step + step); i0++) {
+        i1 = i0 + n2;
+        i2 = i1 + n2;
+        i3 = i2 + n2;
+
+        /* input is in 1.31(q31) format and provide 4 guard bits for the input */
+        r1 = (pSrc[(2U * i0)] >> 4U) + (pSrc[(2U * i2)] >> 4U);
+        r2 = (pSrc[(2U * i0)] >> 4U) - (pSrc[(2U * i2)] >> 4U);
+        t1 = (pSrc[(2U * i1)] >> 4U) + (pSrc[(2U * i3)] >> 4U);
+        s1 = (pSrc[(2U * i0) + 1U] >> 4U) + (pSrc[(2U * i2) + 1U] >> 4U);
+        s2 = (pSrc[(2U * i0) + 1U] >> 4U) - (pSrc[(2U * i2) + 1U] >> 4U);
+
+        /* xa' = xa + xb + xc + xd */
+        pSrc[2U * i0] = (r1 + t1);
+        r1 = r1 - t1;
+        t2 = (pSrc[(2U * i1) + 1U] >> 4U) + (pSrc[(2U * i3) + 1U] >> 4U);
+
+        /* ya' = ya + yb + yc + yd */
+        pSrc[(2U * i0) + 1U] = (s1 + t2);
+        s1 = s1 - t2;
+
+        t1 = (pSrc[(2U * i1) + 1U] >> 4U) - (pSrc[(2U * i3) + 1U] >> 4U);
+        t2 = (pSrc[(2U * i1)] >> 4U) - (pSrc[(2U * i3)] >> 4U);
+
+        ia1 = i0 * twidCoefModifier;
+        ia2 = 2U * ia1;
+        co2 = pCoef[(ia2 * 2U)];
+        si2 = pCoef[(ia2 * 2U) + 1U];
+
+        /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+        pSrc[2U * i1] = (mult_32x32_keep32(r1, co2) + mult_32x32_keep32(s1, si2)) << 1U;
+        /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+        pSrc[(2U * i1) + 1U] = (mult_32x32_keep32(s1, co2) - mult_32x32_keep32(r1, si2)) << 1U;
+
+        r1 = r2 + t1;
+        r2 = r2 - t1;
+        s1 = s2 - t2;
+        s2 = s2 + t2;
+
+        co1 = pCoef[(ia1 * 2U)];
+        si1 = pCoef[(ia1 * 2U) + 1U];
+
+        /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+        pSrc[2U * i2] = (mult_32x32_keep32(r1, co1) + mult_32x32_keep32(s1, si1)) << 1U;
+        /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+        pSrc[(2U * i2) + 1U] = (mult_32x32_keep32(s1, co1) - mult_32x32_keep32(r1, si1)) << 1U;
+
+        ia3 = 3U * ia1;
+        co3 = pCoef[(ia3 * 2U)];
+        si3 = pCoef[(ia3 * 2U) + 1U];
+
+        /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+        pSrc[2U * i3] = (mult_32x32_keep32(r2, co3) + mult_32x32_keep32(s2, si3)) << 1U;
+        /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+        pSrc[(2U * i3) + 1U] = (mult_32x32_keep32(s2, co3) - mult_32x32_keep32(r2, si3)) << 1U;
+    }
+
+    hal_team_barrier();
+
+    /* middle stages, each of them provides two down scaling of the input */
+    twidCoefModifier <<= 2U;
+
+    for (k = fftLen / 4U; k > 4U; k >>= 2U) {
+        n1 = n2;
+        n2 >>= 2U;
+
+        /* The fftLen/4 butterflies of this stage are enumerated as b = j * groups + g, with the
+           twiddle index j < n2 and the group g < groups, and split into contiguous chunks. Hence,
+           every core loads each twiddle factor at most once, and all cores stay busy also in the
+           late stages with n2 < nPE. */
+        groups = fftLen / n1;
+        step = (fftLen / 4U + nPE - 1) / nPE;
+        start = core_id * step;
+        end = MIN(fftLen / 4U, start + step);
+
+        for (j = start / groups; j * groups < end; j++) {
+            ia1 = j * twidCoefModifier;
+            ia2 = ia1 + ia1;
+            ia3 = ia2 + ia1;
+            co1 = pCoef[(ia1 * 2U)];
+            si1 = pCoef[(ia1 * 2U) + 1U];
+            co2 = pCoef[(ia2 * 2U)];
+            si2 = pCoef[(ia2 * 2U) + 1U];
+            co3 = pCoef[(ia3 * 2U)];
+            si3 = pCoef[(ia3 * 2U) + 1U];
+
+            gStart = (j * groups < start) ? start - j * groups : 0;
+            gEnd = MIN(groups, end - j * groups);
+
+            for (g = gStart; g < gEnd; g++) {
+                i0 = j + g * n1;
+                i1 = i0 + n2;
+                i2 = i1 + n2;
+                i3 = i2 + n2;
+
+                r1 = pSrc[2U * i0] + pSrc[2U * i2];
+                r2 = pSrc[2U * i0] - pSrc[2U * i2];
+                s1 = pSrc[(2U * i0) + 1U] + pSrc[(2U * i2) + 1U];
+                s2 = pSrc[(2U * i0) + 1U] - pSrc[(2U * i2) + 1U];
+                t1 = pSrc[2U * i1] + pSrc[2U * i3];
+
+                /* xa' = xa + xb + xc + xd */
+                pSrc[2U * i0] = (r1 + t1) >> 2U;
+                r1 = r1 - t1;
+
+                t2 = pSrc[(2U * i1) + 1U] + pSrc[(2U * i3) + 1U];
+                /* ya' = ya + yb + yc + yd */
+                pSrc[(2U * i0) + 1U] = (s1 + t2) >> 2U;
+                s1 = s1 - t2;
+
+                t1 = pSrc[(2U * i1) + 1U] - pSrc[(2U * i3) + 1U];
+                t2 = pSrc[2U * i1] - pSrc[2U * i3];
+
+                /* xc' = (xa-xb+xc-xd)co2 + (ya-yb+yc-yd)(si2) */
+                pSrc[2U * i1] = (mult_32x32_keep32(r1, co2) + mult_32x32_keep32(s1, si2)) >> 1U;
+                /* yc' = (ya-yb+yc-yd)co2 - (xa-xb+xc-xd)(si2) */
+                pSrc[(2U * i1) + 1U] =
+                    (mult_32x32_keep32(s1, co2) - mult_32x32_keep32(r1, si2)) >> 1U;
+
+                r1 = r2 + t1;
+                r2 = r2 - t1;
+                s1 = s2 - t2;
+                s2 = s2 + t2;
+
+                /* xb' = (xa+yb-xc-yd)co1 + (ya-xb-yc+xd)(si1) */
+                pSrc[2U * i2] = (mult_32x32_keep32(r1, co1) + mult_32x32_keep32(s1, si1)) >> 1U;
+                /* yb' = (ya-xb-yc+xd)co1 - (xa+yb-xc-yd)(si1) */
+                pSrc[(2U * i2) + 1U] =
+                    (mult_32x32_keep32(s1, co1) - mult_32x32_keep32(r1, si1)) >> 1U;
+
+                /* xd' = (xa-yb-xc+yd)co3 + (ya+xb-yc-xd)(si3) */
+                pSrc[2U * i3] = (mult_32x32_keep32(r2, co3) + mult_32x32_keep32(s2, si3)) >> 1U;
+                /* yd' = (ya+xb-yc-xd)co3 - (xa-yb-xc+yd)(si3) */
+                pSrc[(2U * i3) + 1U] =
+                    (mult_32x32_keep32(s2, co3) - mult_32x32_keep32(r2, si3)) >> 1U;
+            }
+        }
+        twidCoefModifier <<= 2U;
+
+        hal_team_barrier();
+    }
+
+    /* last stage, the fftLen/4 groups of four consecutive samples are split among the cores */
+    n2 = fftLen >> 2U;
+    step = (n2 + nPE - 1) / nPE;
+
+    for (j = core_id * step; j < MIN(n2, core_id * step + step); j++) {
+        ptr1 = &pSrc[8U * j];
+
+        xa = ptr1[0];
+        ya = ptr1[1];
+        xb = ptr1[2];
+        yb = ptr1[3];
+        xc = ptr1[4];
+        yc = ptr1[5];
+        xd = ptr1[6];
+        yd = ptr1[7];
+
+        /* xa' = xa + xb + xc + xd */
+        ptr1[0] = xa + xb + xc + xd;
+        ptr1[1] = ya + yb + yc + yd;
+        /* xc' = xa - xb + xc - xd */
+        ptr1[2] = xa - xb + xc - xd;
+        ptr1[3] = ya - yb + yc - yd;
+        /* xb' = xa + yb - xc - yd */
+        ptr1[4] = xa + yb - xc - yd;
+        ptr1[5] = ya - xb - yc + xd;
+        /* xd' = xa - yb - xc + yd */
+        ptr1[6] = xa - yb - xc + yd;
+        ptr1[7] = ya + xb - yc - xd;
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -30,27 +30,47 @@
 
 #include "plp_math.h"
 
-/* HELPER FUNCTIONS */
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
 
+/* HELPER FUNCTIONS */
 int bit_rev_radix2(int index, int log2FFTLen);
 static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B);
-static inline Complex_type_f32 complex_mul_real(float32_t A, Complex_type_f32 B);
-static inline void process_butterfly_real_radix2(const float32_t *input,
-                                                 Complex_type_f32 *output,
-                                                 int twiddle_index,
-                                                 int distance,
-                                                 Complex_type_f32 *twiddle_ptr);
 static inline void process_butterfly_radix2(Complex_type_f32 *input,
                                             int twiddle_index,
                                             int index,
                                             int distance,
                                             Complex_type_f32 *twiddle_ptr);
-static inline void process_butterfly_last_radix2_partial(Complex_type_f32 *input,
-                                                         Complex_type_f32 *output,
-                                                         int outindex);
+static inline void process_butterfly_radix2_copy(const Complex_type_f32 *input,
+                                                 Complex_type_f32 *output,
+                                                 int twiddle_index,
+                                                 int index,
+                                                 int distance,
+                                                 Complex_type_f32 *twiddle_ptr);
 static inline void process_butterfly_last_radix2_full(Complex_type_f32 *input,
                                                       Complex_type_f32 *output,
                                                       int outindex);
+static inline int bit_rev_index(const plp_fft_instance_f32 *S, int index, int log2M);
+static inline void reorder_pair(Complex_type_f32 *data, int j, int index, int conjugate);
+static inline void process_split_real(Complex_type_f32 *data,
+                                      int k,
+                                      int M,
+                                      const Complex_type_f32 *twiddle_ptr);
+static inline void process_merge_real(const Complex_type_f32 *input,
+                                      Complex_type_f32 *output,
+                                      int k,
+                                      int M,
+                                      const Complex_type_f32 *twiddle_ptr,
+                                      float32_t scale);
+static void cfft_half_radix2(const plp_fft_instance_f32 *S,
+                             const Complex_type_f32 *input,
+                             Complex_type_f32 *output,
+                             int conjugate);
+static void cfft_half_radix2_parallel(const plp_fft_instance_f32 *S,
+                                      const Complex_type_f32 *input,
+                                      Complex_type_f32 *output,
+                                      int conjugate,
+                                      int core_id,
+                                      uint32_t nPE);
 
 /**
   @ingroup fft
@@ -58,12 +78,28 @@ static inline void process_butterfly_last_radix2_full(Complex_type_f32 *input,
 
 /**
   @defgroup realFFTKernels FFT kernels on real input values
-  These kernels calculate the FFT transform on real input data.
-  If the dimension of input is FFTLen float32 numbers, the output buffer must contain
-  at least (2*FFTLen) float32 values (used for intermediate computations).
-  Due to the symmetry of real FFT only the first (FFTLen + 2) values of the result
-  are computed in the last stage, corresponding to (FFTLen / 2 + 1) complex values.
-  Supported algorithms: radix-2
+  These kernels calculate the FFT transform on real input data of length N (power of two, N >= 4).
+  The N real values are interpreted as N/2 complex values z[n] = x[2n] + j x[2n+1], transformed with
+  a radix-2 complex FFT of length N/2, and the spectrum of the real signal is recovered by a final
+  split pass using the symmetry of the real FFT:
+  \f$X[k] = \frac{1}{2}(Z[k] + Z^*[N/2-k]) - \frac{j}{2} W_N^k (Z[k] - Z^*[N/2-k])\f$.
+  Compared to the transform of length N, this halves the number of butterflies and the size of
+  the working buffer.
+
+  The inverse transform runs the same steps backwards: a merge pass builds
+  \f$Z[k] = \frac{1}{2}(X[k] + X^*[N/2-k]) + \frac{j}{2} W_N^{-k} (X[k] - X^*[N/2-k])\f$
+  from the N/2 + 1 bins, and the inverse complex FFT of length N/2 returns the N real values
+  interleaved as z[n]. The inverse complex FFT is computed with the forward one on the conjugated
+  data, the conjugation of its result is merged into the reordering.
+
+  The instance provides the N/2 twiddle factors \f$W_N^k\f$, from which the complex FFT of length
+  N/2 uses every second one. If the bit reversal LUT of length N is given, its even entries are
+  used to reorder the result of the complex FFT, otherwise the indices are computed.
+
+  The output buffer of the forward transform must contain at least (N + 2) float32 values. Due to
+  the symmetry of real FFT only the first (N / 2 + 1) complex values are computed, in natural
+  order. The bitReverseFlag of the instance is ignored, the split pass requires the output of the
+  complex FFT in natural order.
 */
 
 /**
@@ -82,301 +118,260 @@ void plp_rfft_f32_xpulpv2(const plp_fft_instance_f32 *S,
                           const float32_t *__restrict__ pSrc,
                           float32_t *__restrict__ pDst) {
 
-    int k, j, stage, step, d, index;
+    int k;
 
     Complex_type_f32 temp;
-    int dist = S->FFTLength >> 1;
-    int nbutterfly = S->FFTLength >> 1;
-    int butt = 2; // number of butterflies in the same group
+    int M = S->FFTLength >> 1; // length of the complex FFT
 
-    const float32_t *_in_ptr_real;
-    Complex_type_f32 *_in_ptr;
-    Complex_type_f32 *_out_ptr;
-    Complex_type_f32 *_tw_ptr;
+    Complex_type_f32 *_in_ptr = (Complex_type_f32 *)pDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
 
-    // FIRST STAGE, input is real
-    stage = 1;
-
-    _in_ptr_real = pSrc;
-    _in_ptr = (Complex_type_f32 *)pDst;
-    _tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
-
-    for (j = 0; j < nbutterfly; j++) {
-        process_butterfly_real_radix2(_in_ptr_real, _in_ptr, j, dist, _tw_ptr);
-        _in_ptr_real++;
-        _in_ptr++;
-    } // j
-
-    stage = stage + 1;
-    dist = dist >> 1;
-
-    // STAGES 2 -> n-1
-    while (dist > 1) {
-        step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)pDst;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, d * butt, j * step, dist, _tw_ptr);
-                _in_ptr++;
-            } // d
-        } // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
-    }
+    cfft_half_radix2(S, (const Complex_type_f32 *)pSrc, _in_ptr, 0);
 
-    // LAST STAGE
-    _in_ptr = (Complex_type_f32 *)pDst;
-    index = 0;
-    process_butterfly_last_radix2_full(_in_ptr, (Complex_type_f32 *)pDst, index);
-    _in_ptr += 2;
-    index   += 2;
-    for (j = 1; j < (S->FFTLength >> 1); j++) {
-        process_butterfly_last_radix2_partial(_in_ptr, (Complex_type_f32 *)pDst, index);
-        _in_ptr += 2;
-        index += 2;
-    } // j
+    // SPLIT, computes the bins k and M - k together
+    temp = _in_ptr[0];
+    _in_ptr[0].re = temp.re + temp.im;
+    _in_ptr[0].im = 0.0f;
+    _in_ptr[M].re = temp.re - temp.im;
+    _in_ptr[M].im = 0.0f;
 
-    // ORDER VALUES
-    if (S->bitReverseFlag) {
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 0; j < S->FFTLength; j += 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
+    for (k = 1; k <= (M >> 1); k++) {
+        process_split_real(_in_ptr, k, M, _tw_ptr);
     }
 }
 
 /**
    @brief  Floating-point FFT on real input data for XPULPV2 extension.
+
+   Every stage of the complex FFT, the reordering and the split pass are divided into contiguous
+   chunks among the cores, separated by barriers.
+
    @param[in]   arg      points to an instance of the floating-point FFT structure
    @return      none
 */
 void plp_rfft_f32_xpulpv2_parallel(plp_fft_instance_f32_parallel *arg) {
 
-    int k, j, stage, step, d, index;
+    int k, step;
 
-    plp_fft_instance_f32 *S = arg->S;
-    const float32_t *pSrc = arg->pSrc;
+    const plp_fft_instance_f32 *S = arg->S;
     const uint32_t nPE = arg->nPE;
-    float32_t *pDst = arg->pDst;
 
     Complex_type_f32 temp;
-    int dist = S->FFTLength >> 1;
-    int nbutterfly = S->FFTLength >> 1;
-    int butt = 2; // number of butterflies in the same group
+    int M = S->FFTLength >> 1; // length of the complex FFT
 
-    const float32_t *_in_ptr_real;
-    Complex_type_f32 *_in_ptr;
-    Complex_type_f32 *_out_ptr;
-    Complex_type_f32 *_tw_ptr;
+    Complex_type_f32 *_in_ptr = (Complex_type_f32 *)arg->pDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
 
     int core_id = hal_core_id();
 
-    // FIRST STAGE, input is real, stage=1
-    stage = 1;
-    _in_ptr_real = &pSrc[core_id];
-    _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
-    _tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+    cfft_half_radix2_parallel(S, (const Complex_type_f32 *)arg->pSrc, _in_ptr, 0, core_id, nPE);
 
-    for (j = 0; j < nbutterfly / nPE; j++) {
-        process_butterfly_real_radix2(_in_ptr_real, _in_ptr, j * nPE + core_id, dist, _tw_ptr);
-        _in_ptr_real += nPE;
-        _in_ptr += nPE;
-    } // j
+    hal_team_barrier();
 
-    stage = stage + 1;
-    dist = dist >> 1;
+    // SPLIT, computes the bins k and M - k together
+    if (core_id == 0) {
+        temp = _in_ptr[0];
+        _in_ptr[0].re = temp.re + temp.im;
+        _in_ptr[0].im = 0.0f;
+        _in_ptr[M].re = temp.re - temp.im;
+        _in_ptr[M].im = 0.0f;
+    }
 
-    // STAGES 2 -> n-1
-    while (dist > nPE / 2) {
-        hal_team_barrier();
-        step = dist << 1;
-        for (j = 0; j < butt; j++) {
-            _in_ptr = (Complex_type_f32 *)&pDst[2 * core_id];
-            for (d = 0; d < dist / nPE; d++) {
-                process_butterfly_radix2(_in_ptr, (d * nPE + core_id) * butt, j * step, dist,
-                                         _tw_ptr);
-                _in_ptr += nPE;
-            } // d
-        } // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
+    step = ((M >> 1) + nPE - 1) / nPE;
+    for (k = 1 + core_id * step; k <= MIN(M >> 1, core_id * step + step); k++) {
+        process_split_real(_in_ptr, k, M, _tw_ptr);
     }
+}
 
-    while (dist > 1) {
-        hal_team_barrier();
-        step = dist << 1;
-        for (j = 0; j < butt / nPE; j++) {
-            _in_ptr = _in_ptr = (Complex_type_f32 *)pDst;
-            ;
-            for (d = 0; d < dist; d++) {
-                process_butterfly_radix2(_in_ptr, butt * d, (j * nPE + core_id) * step, dist,
-                                         _tw_ptr);
-                _in_ptr++;
-            } // d
-        }     // j
-        stage = stage + 1;
-        dist = dist >> 1;
-        butt = butt << 1;
+/**
+   @brief  Floating-point inverse FFT producing real output data for XPULPV2 extension.
+   @param[in]   S       points to an instance of the floating-point FFT structure
+   @param[in]   pSrc    points to the input buffer (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer (N real values), may be equal to pSrc
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2(const plp_fft_instance_f32 *S,
+                           const float32_t *pSrc,
+                           float32_t *pDst) {
+
+    int k;
+
+    int M = S->FFTLength >> 1; // length of the complex FFT
+    float32_t scale = 0.5f / M;
+
+    const Complex_type_f32 *_in_ptr_src = (const Complex_type_f32 *)pSrc;
+    Complex_type_f32 *_in_ptr = (Complex_type_f32 *)pDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+
+    // MERGE, computes Z*[k] and Z*[M - k] together, including the scaling by 1/M
+    for (k = 0; k <= (M >> 1); k++) {
+        process_merge_real(_in_ptr_src, _in_ptr, k, M, _tw_ptr, scale);
     }
 
-    hal_team_barrier();
+    cfft_half_radix2(S, _in_ptr, _in_ptr, 1);
+}
+
+/**
+   @brief  Floating-point inverse FFT producing real output data for XPULPV2 extension.
+
+   The merge pass, every stage of the complex FFT and the reordering are divided into contiguous
+   chunks among the cores, separated by barriers.
+
+   @param[in]   args     points to an instance of the floating-point FFT structure
+   @return      none
+*/
+void plp_rifft_f32_xpulpv2_parallel(void *args) {
+
+    plp_fft_instance_f32_parallel *arg = (plp_fft_instance_f32_parallel *)args;
+    int k, step;
+
+    const plp_fft_instance_f32 *S = arg->S;
+    const uint32_t nPE = arg->nPE;
 
-    // LAST STAGE
-    _in_ptr = (Complex_type_f32 *)&pDst[4 * core_id];
-    index = 2 * core_id;
-    if(core_id ==0 ) {
-      process_butterfly_last_radix2_full(_in_ptr, (Complex_type_f32 *)pDst, index);
-      _in_ptr += 2 * nPE;
-      index += 2 * nPE;
-      j = 1;
+    int M = S->FFTLength >> 1; // length of the complex FFT
+    float32_t scale = 0.5f / M;
+
+    const Complex_type_f32 *_in_ptr_src = (const Complex_type_f32 *)arg->pSrc;
+    Complex_type_f32 *_in_ptr = (Complex_type_f32 *)arg->pDst;
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+
+    int core_id = hal_core_id();
+
+    // MERGE, computes Z*[k] and Z*[M - k] together, including the scaling by 1/M
+    if (core_id == 0) {
+        process_merge_real(_in_ptr_src, _in_ptr, 0, M, _tw_ptr, scale);
     }
-    else
-      j = 0;
 
-    for (j = 0; j < S->FFTLength / (2 * nPE); j++) {
-        process_butterfly_last_radix2_partial(_in_ptr, (Complex_type_f32 *)pDst, index);
-        _in_ptr += 2 * nPE;
-        index += 2 * nPE;
-    } // j
+    step = ((M >> 1) + nPE - 1) / nPE;
+    for (k = 1 + core_id * step; k <= MIN(M >> 1, core_id * step + step); k++) {
+        process_merge_real(_in_ptr_src, _in_ptr, k, M, _tw_ptr, scale);
+    }
 
     hal_team_barrier();
 
-    // ORDER VALUES
-    if (S->bitReverseFlag) {
-
-        int index1, index2, index3, index4;
-        _out_ptr = (Complex_type_f32 *)pDst;
-        for (j = 4 * core_id; j < S->FFTLength; j += nPE * 4) {
-            if (S->pBitReverseLUT) {
-                unsigned int index12 = *((unsigned int *)(&S->pBitReverseLUT[j]));
-                unsigned int index34 = *((unsigned int *)(&S->pBitReverseLUT[j + 2]));
-                index1 = index12 & 0x0000FFFF;
-                index2 = index12 >> 16;
-                index3 = index34 & 0x0000FFFF;
-                index4 = index34 >> 16;
-            } else {
-                int log2FFTLen = log2(S->FFTLength);
-                index1 = bit_rev_radix2(j, log2FFTLen);
-                index2 = bit_rev_radix2(j + 1, log2FFTLen);
-                index3 = bit_rev_radix2(j + 2, log2FFTLen);
-                index4 = bit_rev_radix2(j + 3, log2FFTLen);
-            }
-            if (index1 > j) {
-                temp = _out_ptr[j];
-                _out_ptr[j] = _out_ptr[index1];
-                _out_ptr[index1] = temp;
-            }
-            if (index2 > j + 1) {
-                temp = _out_ptr[j + 1];
-                _out_ptr[j + 1] = _out_ptr[index2];
-                _out_ptr[index2] = temp;
-            }
-            if (index3 > j + 2) {
-                temp = _out_ptr[j + 2];
-                _out_ptr[j + 2] = _out_ptr[index3];
-                _out_ptr[index3] = temp;
-            }
-            if (index4 > j + 3) {
-                temp = _out_ptr[j + 3];
-                _out_ptr[j + 3] = _out_ptr[index4];
-                _out_ptr[index4] = temp;
-            }
-        }
-        hal_team_barrier();
-    }
+    cfft_half_radix2_parallel(S, _in_ptr, _in_ptr, 1, core_id, nPE);
 }
 
 /**
    @} end of realFFTKernels group
 */
 
-int bit_rev_radix2(int index, int log2FFTLen) {
+/* Radix-2 complex FFT of length M = N/2 with the twiddle factors of length N. The first stage
+   reads from input, which may be equal to output. The result is reordered in output, and
+   conjugated if conjugate is set. */
+static void cfft_half_radix2(const plp_fft_instance_f32 *S,
+                             const Complex_type_f32 *input,
+                             Complex_type_f32 *output,
+                             int conjugate) {
+
+    int j, d;
 
-    unsigned int revNum = 0;
-    unsigned i;
+    int M = S->FFTLength >> 1;
+    int log2M = log2(M);
+    int dist = M >> 1;
+    int twiddle_step = 2; // the complex FFT of length M uses every second twiddle factor
+
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
+
+    // FIRST STAGE, from the input to the output buffer
+    for (d = 0; d < dist; d++) {
+        process_butterfly_radix2_copy(input, output, d * twiddle_step, d, dist, _tw_ptr);
+    } // d
+
+    dist = dist >> 1;
+    twiddle_step = twiddle_step << 1;
+
+    // STAGES 2 -> n-1
+    while (dist > 1) {
+        for (j = 0; j < M; j += 2 * dist) {
+            for (d = 0; d < dist; d++) {
+                process_butterfly_radix2(output, d * twiddle_step, j + d, dist, _tw_ptr);
+            } // d
+        }     // j
+        dist = dist >> 1;
+        twiddle_step = twiddle_step << 1;
+    }
 
-    for (i = 0; i < log2FFTLen; i++) {
-        unsigned int temp = (index & (1 << i));
-        if (temp != 0)
-            revNum |= (1 << ((log2FFTLen - 1) - i));
+    // LAST STAGE, twiddle factors are all 1
+    if (M > 2) {
+        for (j = 0; j < M; j += 2) {
+            process_butterfly_last_radix2_full(&output[j], output, j);
+        } // j
     }
 
-    return revNum;
+    // ORDER VALUES
+    for (j = 0; j < M; j++) {
+        reorder_pair(output, j, bit_rev_index(S, j, log2M), conjugate);
+    }
 }
 
-static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
+/* Same as cfft_half_radix2 on the share of the core core_id. The caller synchronizes before the
+   first stage and after the reordering. */
+static void cfft_half_radix2_parallel(const plp_fft_instance_f32 *S,
+                                      const Complex_type_f32 *input,
+                                      Complex_type_f32 *output,
+                                      int conjugate,
+                                      int core_id,
+                                      uint32_t nPE) {
 
-    Complex_type_f32 result;
-    result.re = A.re * B.re - A.im * B.im;
-    result.im = A.re * B.im + A.im * B.re;
-    return result;
-}
+    int j, d, b, start, end, step;
 
-static inline Complex_type_f32 complex_mul_real(float32_t A, Complex_type_f32 B) {
+    int M = S->FFTLength >> 1;
+    int log2M = log2(M);
+    int dist = M >> 1;
+    int twiddle_step = 2; // the complex FFT of length M uses every second twiddle factor
 
-    Complex_type_f32 result;
-    result.re = A * B.re;
-    result.im = A * B.im;
-    return result;
-}
+    Complex_type_f32 *_tw_ptr = (Complex_type_f32 *)S->pTwiddleFactors;
 
-static inline void process_butterfly_real_radix2(const float32_t *input,
-                                                 Complex_type_f32 *output,
-                                                 int twiddle_index,
-                                                 int distance,
-                                                 Complex_type_f32 *twiddle_ptr) {
+    // every stage consists of M/2 butterflies
+    step = ((M >> 1) + nPE - 1) / nPE;
+    start = core_id * step;
+    end = MIN(M >> 1, start + step);
 
-    int index = 0;
-    float32_t d0 = input[index];
-    float32_t d1 = input[index + distance];
+    // FIRST STAGE, from the input to the output buffer
+    for (d = start; d < end; d++) {
+        process_butterfly_radix2_copy(input, output, d * twiddle_step, d, dist, _tw_ptr);
+    } // d
 
-    Complex_type_f32 r0, r1;
+    dist = dist >> 1;
+    twiddle_step = twiddle_step << 1;
 
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im, since c1 is real = c1.re*c2.re
-    r0.re = d0 + d1;
-    r0.im = 0.0f;
-    r1.re = d0 - d1;
+    // STAGES 2 -> n-1, butterfly b is the butterfly b % dist of group b / dist
+    while (dist > 1) {
+        hal_team_barrier();
+        for (b = start; b < end; b++) {
+            d = b & (dist - 1);
+            j = (b - d) << 1;
+            process_butterfly_radix2(output, d * twiddle_step, j + d, dist, _tw_ptr);
+        } // b
+        dist = dist >> 1;
+        twiddle_step = twiddle_step << 1;
+    }
 
-    Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
+    hal_team_barrier();
 
-    output[index] = r0;
-    output[index + distance] = complex_mul_real(r1.re, tw0);
+    // LAST STAGE, twiddle factors are all 1
+    if (M > 2) {
+        for (b = start; b < end; b++) {
+            process_butterfly_last_radix2_full(&output[2 * b], output, 2 * b);
+        } // b
+
+        hal_team_barrier();
+    }
+
+    // ORDER VALUES, every pair is swapped by the core owning the lower index
+    step = (M + nPE - 1) / nPE;
+    for (j = core_id * step; j < MIN(M, core_id * step + step); j++) {
+        reorder_pair(output, j, bit_rev_index(S, j, log2M), conjugate);
+    }
+}
+
+static inline Complex_type_f32 complex_mul(Complex_type_f32 A, Complex_type_f32 B) {
+
+    Complex_type_f32 result;
+    result.re = A.re * B.re - A.im * B.im;
+    result.im = A.re * B.im + A.im * B.re;
+    return result;
 }
 
 static inline void process_butterfly_radix2(Complex_type_f32 *input,
@@ -406,25 +401,29 @@ static inline void process_butterfly_radix2(Complex_type_f32 *input,
     input[index + distance] = complex_mul(tw0, r1);
 }
 
-static inline void process_butterfly_last_radix2_partial(Complex_type_f32 *input,
-                                                         Complex_type_f32 *output,
-                                                         int outindex) {
+static inline void process_butterfly_radix2_copy(const Complex_type_f32 *input,
+                                                 Complex_type_f32 *output,
+                                                 int twiddle_index,
+                                                 int index,
+                                                 int distance,
+                                                 Complex_type_f32 *twiddle_ptr) {
 
-    int index = 0;
     Complex_type_f32 r0, r1;
+
     float32_t d0 = input[index].re;
-    float32_t d1 = input[index + 1].re;
+    float32_t d1 = input[index + distance].re;
     float32_t e0 = input[index].im;
-    float32_t e1 = input[index + 1].im;
+    float32_t e1 = input[index + distance].im;
 
-    // Re(c1*c2) = c1.re*c2.re - c1.im*c2.im
     r0.re = d0 + d1;
-
-    // Im(c1*c2) = c1.re*c2.im + c1.im*c2.re
+    r1.re = d0 - d1;
     r0.im = e0 + e1;
+    r1.im = e0 - e1;
 
-    /* In the Last step, twiddle factors are all 1 */
-    output[outindex] = r0;
+    Complex_type_f32 tw0 = twiddle_ptr[twiddle_index];
+
+    output[index] = r0;
+    output[index + distance] = complex_mul(tw0, r1);
 }
 
 static inline void process_butterfly_last_radix2_full(Complex_type_f32 *input,
@@ -449,3 +448,84 @@ static inline void process_butterfly_last_radix2_full(Complex_type_f32 *input,
     output[outindex] = r0;
     output[outindex + 1] = r1;
 }
+
+static inline int bit_rev_index(const plp_fft_instance_f32 *S, int index, int log2M) {
+    /* reversing 2 * index over log2(N) bits is the same as reversing index over log2(N/2) bits */
+    if (S->pBitReverseLUT) {
+        return S->pBitReverseLUT[2 * index];
+    } else {
+        return bit_rev_radix2(index, log2M);
+    }
+}
+
+static inline void reorder_pair(Complex_type_f32 *data, int j, int index, int conjugate) {
+    /* every pair is swapped once, by its lower index */
+    if (index >= j) {
+        Complex_type_f32 a = data[j];
+        Complex_type_f32 b = data[index];
+        if (conjugate) {
+            a.im = -a.im;
+            b.im = -b.im;
+        }
+        data[j] = b;
+        data[index] = a;
+    }
+}
+
+static inline void process_split_real(Complex_type_f32 *data,
+                                      int k,
+                                      int M,
+                                      const Complex_type_f32 *twiddle_ptr) {
+
+    Complex_type_f32 a = data[k];
+    Complex_type_f32 b = data[M - k];
+    Complex_type_f32 e, o, t;
+
+    // even part Z[k] + Z*[M-k], odd part -j (Z[k] - Z*[M-k])
+    e.re = a.re + b.re;
+    e.im = a.im - b.im;
+    o.re = a.im + b.im;
+    o.im = b.re - a.re;
+
+    t = complex_mul(twiddle_ptr[k], o);
+
+    data[k].re = 0.5f * (e.re + t.re);
+    data[k].im = 0.5f * (e.im + t.im);
+    data[M - k].re = 0.5f * (e.re - t.re);
+    data[M - k].im = 0.5f * (t.im - e.im);
+}
+
+static inline void process_merge_real(const Complex_type_f32 *input,
+                                      Complex_type_f32 *output,
+                                      int k,
+                                      int M,
+                                      const Complex_type_f32 *twiddle_ptr,
+                                      float32_t scale) {
+
+    Complex_type_f32 a = input[k];
+    Complex_type_f32 b = input[M - k];
+    Complex_type_f32 e, d, v, w;
+
+    if (k == 0) {
+        // DC and Nyquist bins are real
+        output[0].re = scale * (a.re + b.re);
+        output[0].im = scale * (b.re - a.re);
+        return;
+    }
+
+    // even part X[k] + X*[M-k], odd part W_N^{-k} (X[k] - X*[M-k])
+    e.re = a.re + b.re;
+    e.im = a.im - b.im;
+    d.re = a.re - b.re;
+    d.im = a.im + b.im;
+
+    w = twiddle_ptr[k];
+    v.re = w.re * d.re + w.im * d.im;
+    v.im = w.re * d.im - w.im * d.re;
+
+    // conjugates of Z[k] = (e + j v) / 2 and Z[M-k] = (e* + j v*) / 2
+    output[k].re = scale * (e.re - v.im);
+    output[k].im = -scale * (e.im + v.re);
+    output[M - k].re = scale * (e.re + v.im);
+    output[M - k].im = scale * (e.im - v.re);
+}
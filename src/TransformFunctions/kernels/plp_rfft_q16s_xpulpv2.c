@@ -0,0 +1,107 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16s_xpulpv2.c
+ * Description:  16-bit fixed point FFT on real input data for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/*
+ * Split pass of the real FFT of length N = 2M. The complex FFT of z[n] = x[2n] + j x[2n+1] gives
+ * Z[k] (scaled by 1/M), and the bins k and M - k of the real FFT are computed together:
+ *   E = Z[k] + Z*[M-k],  O = -j (Z[k] - Z*[M-k]),  T = W_N^k O
+ *   X[k] = (E + T) / 2,  X[M-k] = (E - T)* / 2
+ * The inputs and the outputs are shifted by 1, which scales the result to X/N.
+ */
+
+static inline void plp_rfft_split_q16(int16_t *p, uint32_t M, const int16_t *pCoef, uint32_t k) {
+    v2s a, b, s, d, o, CoSi;
+    int32_t er, ei, tr, ti;
+    uint32_t l = M - k;
+
+    a = __SRA2(*(v2s *)&p[2 * k], ((v2s){ 1, 1 }));
+    b = __SRA2(*(v2s *)&p[2 * l], ((v2s){ 1, 1 }));
+    s = __ADD2(a, b);
+    d = __SUB2(a, b);
+
+    er = s[0];
+    ei = d[1];
+    o = __PACK2(s[1], -d[0]);
+
+    CoSi = *(v2s *)&pCoef[2 * k];
+
+    tr = __DOTP2(o, CoSi) >> 15;
+    ti = __DOTP2(o, __PACK2(-CoSi[1], CoSi[0])) >> 15;
+
+    *((v2s *)&p[2 * k]) = __PACK2((er + tr) >> 1, (ei + ti) >> 1);
+    *((v2s *)&p[2 * l]) = __PACK2((er - tr) >> 1, (ti - ei) >> 1);
+}
+
+/**
+   @brief      16-bit fixed-point FFT on real input data for XPULPV2.
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values)
+   @return      none
+*/
+void plp_rfft_q16s_xpulpv2(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+    uint32_t M = S->fftLenReal >> 1;
+    uint32_t k;
+    int32_t re, im;
+
+    /* the complex FFT of length M works in-place */
+    if (pSrc != pDst) {
+        for (k = 0; k < M; k++) {
+            ((int32_t *)pDst)[k] = ((const int32_t *)pSrc)[k];
+        }
+    }
+
+    plp_cfft_q16s_xpulpv2(S->pCfft, pDst, 0, 1, 15);
+
+    /* DC and Nyquist bins */
+    re = pDst[0] >> 1;
+    im = pDst[1] >> 1;
+    pDst[0] = re + im;
+    pDst[1] = 0;
+    pDst[2 * M] = re - im;
+    pDst[2 * M + 1] = 0;
+
+    for (k = 1; k <= (M >> 1); k++) {
+        plp_rfft_split_q16(pDst, M, S->pTwiddleRFFT, k);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
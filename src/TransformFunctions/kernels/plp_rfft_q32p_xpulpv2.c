@@ -0,0 +1,135 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q32p_xpulpv2.c
+ * Description:  Parallel 32-bit fixed point FFT on real input data for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/*
+ * Split pass of the real FFT of length N = 2M. The complex FFT of z[n] = x[2n] + j x[2n+1] gives
+ * Z[k] (scaled by 1/M), and the bins k and M - k of the real FFT are computed together:
+ *   E = Z[k] + Z*[M-k],  O = -j (Z[k] - Z*[M-k]),  T = W_N^k O
+ *   X[k] = (E + T) / 2,  X[M-k] = (E - T)* / 2
+ * Shifting the inputs by 2 includes the factor 1/2 and scales the result to X/N.
+ */
+
+static inline void plp_rfft_split_q32(int32_t *p, uint32_t M, const int32_t *pCoef, uint32_t k) {
+    int32_t ar, ai, br, bi, er, ei, odr, odi, tr, ti, co, si;
+    uint32_t l = M - k;
+
+    ar = p[2 * k] >> 2;
+    ai = p[2 * k + 1] >> 2;
+    br = p[2 * l] >> 2;
+    bi = p[2 * l + 1] >> 2;
+
+    er = ar + br;
+    ei = ai - bi;
+    odr = ai + bi;
+    odi = br - ar;
+
+    co = pCoef[2 * k];
+    si = pCoef[2 * k + 1];
+
+    tr = (int32_t)(((int64_t)odr * co + (int64_t)odi * si) >> 31);
+    ti = (int32_t)(((int64_t)odi * co - (int64_t)odr * si) >> 31);
+
+    p[2 * k] = er + tr;
+    p[2 * k + 1] = ei + ti;
+    p[2 * l] = er - tr;
+    p[2 * l + 1] = ti - ei;
+}
+
+/**
+   @brief      Parallel 32-bit fixed-point FFT on real input data for XPULPV2.
+
+   The copy of the input, the complex FFT (plp_cfft_q32p_xpulpv2) and the split pass are divided
+   among the cores. The result is bit-exact to plp_rfft_q32s_xpulpv2.
+
+   @param[in]   args    points to the plp_rfft_instance_q32_parallel
+   @return      none
+*/
+void plp_rfft_q32p_xpulpv2(void *args) {
+    plp_rfft_instance_q32_parallel *a = (plp_rfft_instance_q32_parallel *)args;
+    const plp_rfft_instance_q32 *S = a->S;
+    const int32_t *pSrc = a->pSrc;
+    int32_t *pDst = a->pDst;
+    uint32_t nPE = a->nPE;
+
+    int core_id = hal_core_id();
+    uint32_t M = S->fftLenReal >> 1;
+    uint32_t k, step;
+    int32_t re, im;
+
+    /* the complex FFT of length M works in-place */
+    if (pSrc != pDst) {
+        step = (M + nPE - 1) / nPE;
+        for (k = core_id * step; k < MIN(M, core_id * step + step); k++) {
+            pDst[2 * k] = pSrc[2 * k];
+            pDst[2 * k + 1] = pSrc[2 * k + 1];
+        }
+        hal_team_barrier();
+    }
+
+    plp_cfft_instance_q32_parallel cfftArgs = { .S = (plp_cfft_instance_q32 *)S->pCfft,
+                                                .p1 = pDst,
+                                                .ifftFlag = 0,
+                                                .bitReverseFlag = 1,
+                                                .fracBits = 31,
+                                                .nPE = nPE };
+    plp_cfft_q32p_xpulpv2((void *)&cfftArgs);
+
+    hal_team_barrier();
+
+    if (core_id == 0) {
+        /* DC and Nyquist bins */
+        re = pDst[0] >> 1;
+        im = pDst[1] >> 1;
+        pDst[0] = re + im;
+        pDst[1] = 0;
+        pDst[2 * M] = re - im;
+        pDst[2 * M + 1] = 0;
+    }
+
+    step = ((M >> 1) + nPE - 1) / nPE;
+    for (k = 1 + core_id * step; k <= MIN(M >> 1, core_id * step + step); k++) {
+        plp_rfft_split_q32(pDst, M, S->pTwiddleRFFT, k);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
@@ -0,0 +1,108 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_q16s_xpulpv2.c
+ * Description:  16-bit fixed point inverse FFT producing real output data for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/*
+ * Merge pass of the inverse real FFT of length N = 2M. The bins k and M - k of the half spectrum
+ * give the bins k and M - k of the complex sequence z[n] = x[2n] + j x[2n+1]:
+ *   E = X[k] + X*[M-k],  D = X[k] - X*[M-k],  V = W_N^-k D
+ *   Z[k] = (E + jV) / 2,  Z[M-k] = (E* + jV*) / 2
+ * Shifting the inputs by 1 includes the factor 1/2, the result is saturated. The real and
+ * imaginary parts of Z are stored swapped, such that the forward complex FFT computes the inverse
+ * FFT of Z (scaled by 1/M) with swapped real and imaginary parts.
+ */
+
+static inline void plp_rifft_merge_q16(
+    const int16_t *pSrc, int16_t *p, uint32_t M, const int16_t *pCoef, uint32_t k) {
+    v2s a, b, s, d, D, CoSi;
+    int32_t er, ei, vr, vi;
+    uint32_t l = M - k;
+
+    if (k == 0) {
+        /* DC and Nyquist bins are real */
+        er = pSrc[0] >> 1;
+        ei = pSrc[2 * M] >> 1;
+        *((v2s *)&p[0]) = __PACK2(er - ei, er + ei);
+        return;
+    }
+
+    a = __SRA2(*(v2s *)&pSrc[2 * k], ((v2s){ 1, 1 }));
+    b = __SRA2(*(v2s *)&pSrc[2 * l], ((v2s){ 1, 1 }));
+    s = __ADD2(a, b);
+    d = __SUB2(a, b);
+
+    er = s[0];
+    ei = d[1];
+    D = __PACK2(d[0], s[1]);
+
+    CoSi = *(v2s *)&pCoef[2 * k];
+
+    vr = __DOTP2(D, __PACK2(CoSi[0], -CoSi[1])) >> 15;
+    vi = __DOTP2(D, __PACK2(CoSi[1], CoSi[0])) >> 15;
+
+    *((v2s *)&p[2 * k]) = __PACK2(__CLIP(ei + vr, 15), __CLIP(er - vi, 15));
+    *((v2s *)&p[2 * l]) = __PACK2(__CLIP(vr - ei, 15), __CLIP(er + vi, 15));
+}
+
+/**
+   @brief      16-bit fixed-point inverse FFT producing real output data for XPULPV2.
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values, may be equal to pSrc
+   @return      none
+*/
+void plp_rifft_q16s_xpulpv2(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+    uint32_t M = S->fftLenReal >> 1;
+    uint32_t k;
+
+    for (k = 0; k <= (M >> 1); k++) {
+        plp_rifft_merge_q16(pSrc, pDst, M, S->pTwiddleRFFT, k);
+    }
+
+    plp_cfft_q16s_xpulpv2(S->pCfft, pDst, 0, 1, 15);
+
+    /* swap back the real and imaginary parts */
+    for (k = 0; k < M; k++) {
+        v2s z = *(v2s *)&pDst[2 * k];
+        *((v2s *)&pDst[2 * k]) = __PACK2(z[1], z[0]);
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
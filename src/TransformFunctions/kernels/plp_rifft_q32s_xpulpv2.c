@@ -0,0 +1,118 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_q32s_xpulpv2.c
+ * Description:  32-bit fixed point inverse FFT producing real output data for XPULPV2
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup fft
+ * @{
+ */
+
+/*
+ * Merge pass of the inverse real FFT of length N = 2M. The bins k and M - k of the half spectrum
+ * give the bins k and M - k of the complex sequence z[n] = x[2n] + j x[2n+1]:
+ *   E = X[k] + X*[M-k],  D = X[k] - X*[M-k],  V = W_N^-k D
+ *   Z[k] = (E + jV) / 2,  Z[M-k] = (E* + jV*) / 2
+ * Shifting the inputs by 1 includes the factor 1/2, the result is saturated. The real and
+ * imaginary parts of Z are stored swapped, such that the forward complex FFT computes the inverse
+ * FFT of Z (scaled by 1/M) with swapped real and imaginary parts.
+ */
+
+static inline int32_t plp_rifft_sat_q32(int64_t x) {
+    return (int32_t)(x > INT32_MAX ? INT32_MAX : (x < INT32_MIN ? INT32_MIN : x));
+}
+
+static inline void plp_rifft_merge_q32(
+    const int32_t *pSrc, int32_t *p, uint32_t M, const int32_t *pCoef, uint32_t k) {
+    int32_t ar, ai, br, bi, er, ei, dr, di, vr, vi, co, si;
+    uint32_t l = M - k;
+
+    if (k == 0) {
+        /* DC and Nyquist bins are real */
+        ar = pSrc[0] >> 1;
+        br = pSrc[2 * M] >> 1;
+        p[0] = ar - br;
+        p[1] = ar + br;
+        return;
+    }
+
+    ar = pSrc[2 * k] >> 1;
+    ai = pSrc[2 * k + 1] >> 1;
+    br = pSrc[2 * l] >> 1;
+    bi = pSrc[2 * l + 1] >> 1;
+
+    er = ar + br;
+    ei = ai - bi;
+    dr = ar - br;
+    di = ai + bi;
+
+    co = pCoef[2 * k];
+    si = pCoef[2 * k + 1];
+
+    vr = (int32_t)(((int64_t)dr * co - (int64_t)di * si) >> 31);
+    vi = (int32_t)(((int64_t)di * co + (int64_t)dr * si) >> 31);
+
+    p[2 * k] = plp_rifft_sat_q32((int64_t)ei + vr);
+    p[2 * k + 1] = plp_rifft_sat_q32((int64_t)er - vi);
+    p[2 * l] = plp_rifft_sat_q32((int64_t)vr - ei);
+    p[2 * l + 1] = plp_rifft_sat_q32((int64_t)er + vi);
+}
+
+/**
+   @brief      32-bit fixed-point inverse FFT producing real output data for XPULPV2.
+   @param[in]   S       points to an instance of the 32-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values, may be equal to pSrc
+   @return      none
+*/
+void plp_rifft_q32s_xpulpv2(const plp_rfft_instance_q32 *S, const int32_t *pSrc, int32_t *pDst) {
+    uint32_t M = S->fftLenReal >> 1;
+    uint32_t k;
+    int32_t re;
+
+    for (k = 0; k <= (M >> 1); k++) {
+        plp_rifft_merge_q32(pSrc, pDst, M, S->pTwiddleRFFT, k);
+    }
+
+    plp_cfft_q32s_xpulpv2(S->pCfft, pDst, 0, 1, 31);
+
+    /* swap back the real and imaginary parts */
+    for (k = 0; k < M; k++) {
+        re = pDst[2 * k + 1];
+        pDst[2 * k + 1] = pDst[2 * k];
+        pDst[2 * k] = re;
+    }
+}
+
+/**
+ * @} end of FFT group
+ */
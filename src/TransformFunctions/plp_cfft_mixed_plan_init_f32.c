@@ -0,0 +1,133 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_cfft_mixed_plan_init_f32.c
+ * Description:  Plan creation for the floating-point mixed-radix FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @defgroup cfftMixed  Mixed-radix FFT
+  This module contains the floating-point FFT for any length N = 2^a 3^b 5^c. The length is
+  decomposed into radix-8, radix-4, radix-2, radix-5 and radix-3 stages once, when the plan is
+  created, preferring the radix-8 stages which need the least operations per point. The powers of
+  two which are not a multiple of 8 are completed by a 4-point or two 4-point stages (instead of a
+  2-point and an 8-point stage). Only a single factor 2 is computed by a 2-point stage.
+ */
+
+/**
+   @addtogroup cfftMixed
+   @{
+*/
+
+/**
+   @brief      Create the plan of a floating-point mixed-radix FFT.
+   @param[out] S          points to the plan to initialize
+   @param[in]  N          length of the FFT, must be of the form 2^a 3^b 5^c
+   @param[in]  pTwiddle   points to a buffer of N complex values, which is filled with the
+                          twiddle factors \f$W_N^k = e^{-j \frac{2 \pi}{N} k}\f$, k = 0 .. N-1
+   @param[in]  pScratch   points to a buffer of N complex values, used by the transform
+   @return     0 on success, 1 if N has a prime factor larger than 5 or is zero
+*/
+int plp_cfft_mixed_plan_init_f32(plp_cfft_mixed_plan_f32 *S,
+                                 uint32_t N,
+                                 Complex_type_f32 *pTwiddle,
+                                 Complex_type_f32 *pScratch) {
+
+    uint32_t n = N;
+    uint32_t n2 = 0, n3 = 0, n5 = 0;
+    uint32_t nStages = 0;
+    uint32_t i;
+
+    if (N == 0) {
+        return 1;
+    }
+
+    while ((n & 0x1U) == 0) {
+        n >>= 1;
+        n2++;
+    }
+    while (n % 3 == 0) {
+        n /= 3;
+        n3++;
+    }
+    while (n % 5 == 0) {
+        n /= 5;
+        n5++;
+    }
+    if (n != 1) {
+        return 1;
+    }
+
+    for (i = 0; i < n2 / 3; i++) {
+        S->radix[nStages++] = 8;
+    }
+    switch (n2 % 3) {
+    case 1:
+        if (nStages > 0) {
+            // 16 = 4 * 4 is cheaper than 8 * 2
+            S->radix[nStages - 1] = 4;
+            S->radix[nStages++] = 4;
+        } else {
+            S->radix[nStages++] = 2;
+        }
+        break;
+    case 2:
+        S->radix[nStages++] = 4;
+        break;
+    }
+    for (i = 0; i < n5; i++) {
+        S->radix[nStages++] = 5;
+    }
+    for (i = 0; i < n3; i++) {
+        S->radix[nStages++] = 3;
+    }
+
+    // the second half is the complex conjugate of the first one, which keeps the angles small
+    for (i = 0; i <= N / 2; i++) {
+        float32_t phi = (2.0f * (float32_t)M_PI / N) * i;
+        pTwiddle[i].re = cosf(phi);
+        pTwiddle[i].im = -sinf(phi);
+    }
+    for (; i < N; i++) {
+        pTwiddle[i].re = pTwiddle[N - i].re;
+        pTwiddle[i].im = -pTwiddle[N - i].im;
+    }
+
+    S->FFTLength = N;
+    S->nStages = nStages;
+    S->pTwiddle = pTwiddle;
+    S->pScratch = pScratch;
+
+    return 0;
+}
+
+/**
+   @} end of cfftMixed group
+*/
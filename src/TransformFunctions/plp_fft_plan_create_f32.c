@@ -0,0 +1,156 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fft_plan_create_f32.c
+ * Description:  Runtime plan creation for the floating-point complex FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup fftPlan
+ */
+
+/**
+   @addtogroup fftPlan
+   @{
+*/
+
+#define PLP_FFT_PLAN_F32_TWIDDLE_OFFSET ((sizeof(plp_fft_plan_f32) + 7) & ~7U)
+
+/**
+   @brief      Size of the memory needed by plp_fft_plan_create_f32.
+   @param[in]  N     length of the FFT, power of two from 4 to 65536
+   @return     number of bytes, or 0 if N is not supported
+*/
+uint32_t plp_fft_plan_size_f32(uint32_t N) {
+
+    uint32_t radix = plp_cfft_f32_radix(N);
+
+    if (radix == 0) {
+        return 0;
+    }
+
+    // the radix-r butterflies read the twiddle factors up to (r-1)/r * N
+    return PLP_FFT_PLAN_F32_TWIDDLE_OFFSET + (N - N / radix) * sizeof(Complex_type_f32) +
+           N * sizeof(uint16_t);
+}
+
+/**
+   @brief      Creates the plan of a floating-point complex FFT (plp_cfft_f32), computing the
+               twiddle factors and the digit reversal table of the radix used for N at runtime.
+   @param[in]  N     length of the FFT, power of two from 4 to 65536
+   @param[in]  mem   points to plp_fft_plan_size_f32(N) bytes of memory (8-byte aligned), preferably
+                     in L1, which hold the plan and its tables. If mem is NULL, the memory is
+                     allocated in L1 and released by plp_fft_plan_destroy_f32.
+   @return     pointer to the plan, use &plan->S as instance of plp_cfft_f32. NULL if N is not
+               supported or if the allocation failed.
+*/
+plp_fft_plan_f32 *plp_fft_plan_create_f32(uint32_t N, void *mem) {
+
+    uint32_t size = plp_fft_plan_size_f32(N);
+    uint32_t radix = plp_cfft_f32_radix(N);
+    uint32_t digitBits = radix == 8 ? 3 : (radix == 4 ? 2 : 1);
+    uint32_t log2N = 0;
+    plp_fft_plan_f32 *plan;
+    Complex_type_f32 *pTwiddle;
+    uint16_t *pBitReverseLUT;
+    uint32_t k, d;
+
+    if (size == 0) {
+        return NULL;
+    }
+
+    plan = (plp_fft_plan_f32 *)mem;
+    if (mem == NULL) {
+        plan = (plp_fft_plan_f32 *)hal_cl_l1_malloc(size);
+        if (plan == NULL) {
+            return NULL;
+        }
+    }
+
+    pTwiddle = (Complex_type_f32 *)((uint8_t *)plan + PLP_FFT_PLAN_F32_TWIDDLE_OFFSET);
+    pBitReverseLUT = (uint16_t *)&pTwiddle[N - N / radix];
+
+    for (k = 0; k < N - N / radix; k++) {
+        double c, s;
+        plp_fft_cos_sin(N, k, &c, &s);
+        pTwiddle[k].re = (float32_t)c;
+        pTwiddle[k].im = (float32_t)-s;
+    }
+
+    // reverse the order of the base-radix digits of every index
+    while ((1U << log2N) < N) {
+        log2N++;
+    }
+    for (k = 0; k < N; k++) {
+        uint32_t index = k;
+        uint32_t rev = 0;
+        for (d = 0; d < log2N / digitBits; d++) {
+            rev = (rev << digitBits) | (index & (radix - 1));
+            index >>= digitBits;
+        }
+        pBitReverseLUT[k] = (uint16_t)rev;
+    }
+
+    plan->S.FFTLength = N;
+    plan->S.bitReverseFlag = 1;
+    plan->S.pTwiddleFactors = (const float32_t *)pTwiddle;
+    plan->S.pBitReverseLUT = pBitReverseLUT;
+    plan->pMem = mem == NULL ? (void *)plan : NULL;
+    plan->memSize = size;
+
+    return plan;
+}
+
+/**
+   @brief      Destroys a plan created by plp_fft_plan_create_f32. The memory is released if it
+               was allocated by the plan, memory provided by the caller can be reused afterwards.
+   @param[in]  plan  points to the plan
+   @return     none
+*/
+void plp_fft_plan_destroy_f32(plp_fft_plan_f32 *plan) {
+
+    void *pMem;
+    uint32_t memSize;
+
+    if (plan == NULL) {
+        return;
+    }
+
+    pMem = plan->pMem;
+    memSize = plan->memSize;
+
+    plan->S.FFTLength = 0;
+    plan->S.pTwiddleFactors = NULL;
+    plan->S.pBitReverseLUT = NULL;
+
+    if (pMem != NULL) {
+        hal_cl_l1_free(pMem, memSize);
+    }
+}
+
+/**
+   @} end of fftPlan group
+*/
@@ -0,0 +1,140 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fft_plan_create_q16.c
+ * Description:  Runtime plan creation for the q16 complex FFT
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup fftPlan
+ */
+
+/**
+   @addtogroup fftPlan
+   @{
+*/
+
+#define PLP_FFT_PLAN_Q16_TWIDDLE_OFFSET ((sizeof(plp_fft_plan_q16) + 7) & ~7U)
+
+/**
+   @brief      Size of the memory needed by plp_fft_plan_create_q16.
+   @param[in]  N     length of the FFT, power of two from 16 to 4096
+   @return     number of bytes, or 0 if N is not supported
+*/
+uint32_t plp_fft_plan_size_q16(uint32_t N) {
+
+    if (N < 16 || N > 4096 || (N & (N - 1)) != 0) {
+        return 0;
+    }
+
+    return PLP_FFT_PLAN_Q16_TWIDDLE_OFFSET + (3 * N / 2) * sizeof(int16_t) +
+           plp_fft_bitrev_table_length(N) * sizeof(uint16_t);
+}
+
+/**
+   @brief      Creates the plan of a 16-bit fixed-point complex FFT (plp_cfft_q16), computing the
+               twiddle factors and the bit reversal table at runtime.
+   @param[in]  N     length of the FFT, power of two from 16 to 4096
+   @param[in]  mem   points to plp_fft_plan_size_q16(N) bytes of memory (8-byte aligned), preferably
+                     in L1, which hold the plan and its tables. If mem is NULL, the memory is
+                     allocated in L1 and released by plp_fft_plan_destroy_q16.
+   @return     pointer to the plan, use &plan->S as instance of plp_cfft_q16. NULL if N is not
+               supported or if the allocation failed.
+*/
+plp_fft_plan_q16 *plp_fft_plan_create_q16(uint32_t N, void *mem) {
+
+    uint32_t size = plp_fft_plan_size_q16(N);
+    plp_fft_plan_q16 *plan;
+    int16_t *pTwiddle;
+    uint16_t *pBitRevTable;
+    uint32_t k;
+
+    if (size == 0) {
+        return NULL;
+    }
+
+    plan = (plp_fft_plan_q16 *)mem;
+    if (mem == NULL) {
+        plan = (plp_fft_plan_q16 *)hal_cl_l1_malloc(size);
+        if (plan == NULL) {
+            return NULL;
+        }
+    }
+
+    pTwiddle = (int16_t *)((uint8_t *)plan + PLP_FFT_PLAN_Q16_TWIDDLE_OFFSET);
+    pBitRevTable = (uint16_t *)&pTwiddle[3 * N / 2];
+
+    // 3N/4 twiddle factors, interleaved (cos, sin) in Q1.15
+    for (k = 0; k < 3 * N / 4; k++) {
+        double c, s;
+        plp_fft_cos_sin(N, k, &c, &s);
+        pTwiddle[2 * k] = (int16_t)plp_fft_to_fixed(c, 15);
+        pTwiddle[2 * k + 1] = (int16_t)plp_fft_to_fixed(s, 15);
+    }
+
+    plp_fft_bitrev_table(N, pBitRevTable);
+
+    plan->S.fftLen = N;
+    plan->S.pTwiddle = pTwiddle;
+    plan->S.pBitRevTable = (const int16_t *)pBitRevTable;
+    plan->S.bitRevLength = plp_fft_bitrev_table_length(N);
+    plan->pMem = mem == NULL ? (void *)plan : NULL;
+    plan->memSize = size;
+
+    return plan;
+}
+
+/**
+   @brief      Destroys a plan created by plp_fft_plan_create_q16. The memory is released if it
+               was allocated by the plan, memory provided by the caller can be reused afterwards.
+   @param[in]  plan  points to the plan
+   @return     none
+*/
+void plp_fft_plan_destroy_q16(plp_fft_plan_q16 *plan) {
+
+    void *pMem;
+    uint32_t memSize;
+
+    if (plan == NULL) {
+        return;
+    }
+
+    pMem = plan->pMem;
+    memSize = plan->memSize;
+
+    plan->S.fftLen = 0;
+    plan->S.pTwiddle = NULL;
+    plan->S.pBitRevTable = NULL;
+    plan->S.bitRevLength = 0;
+
+    if (pMem != NULL) {
+        hal_cl_l1_free(pMem, memSize);
+    }
+}
+
+/**
+   @} end of fftPlan group
+*/
@@ -0,0 +1,163 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_fft_plan_tables.c
+ * Description:  Twiddle factor and bit reversal table generation for the FFT plans
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup fft
+ */
+
+/**
+  @defgroup fftPlan  FFT plans
+  The FFT plans compute the twiddle factor and bit reversal tables of an FFT at runtime, into
+  memory provided by the caller or allocated in L1 by the plan. Only the tables of the lengths
+  which are used take memory, and the twiddle factors can be read from the TCDM in a single cycle,
+  instead of reading the constant tables of plp_common_tables.c from L2. The generated tables
+  match the constant ones to within one LSB.
+ */
+
+/**
+   @addtogroup fftPlan
+   @{
+*/
+
+/**
+   @brief      Computes cos(2 pi k / N) and sin(2 pi k / N) in double precision. The angle is
+               reduced to the first octant, such that the tables are exactly symmetric.
+   @param[in]  N      length of the FFT, must be a multiple of 8
+   @param[in]  k      index of the twiddle factor, 0 <= k < N
+   @param[out] pCos   cos(2 pi k / N)
+   @param[out] pSin   sin(2 pi k / N)
+   @return     none
+*/
+void plp_fft_cos_sin(uint32_t N, uint32_t k, double *pCos, double *pSin) {
+
+    uint32_t quadrant = (4 * k) / N;
+    uint32_t r = k - quadrant * (N / 4);
+    double c, s;
+
+    if (2 * r <= N / 4) {
+        double phi = (2.0 * M_PI * r) / N;
+        c = cos(phi);
+        s = sin(phi);
+    } else {
+        double phi = (2.0 * M_PI * (N / 4 - r)) / N;
+        c = sin(phi);
+        s = cos(phi);
+    }
+
+    switch (quadrant) {
+    case 0:
+        *pCos = c;
+        *pSin = s;
+        break;
+    case 1:
+        *pCos = -s;
+        *pSin = c;
+        break;
+    case 2:
+        *pCos = -c;
+        *pSin = -s;
+        break;
+    default:
+        *pCos = s;
+        *pSin = -c;
+        break;
+    }
+}
+
+/**
+   @brief      Rounds x * 2^fracBits to the nearest integer (ties away from zero) and saturates
+               it to the range of a (fracBits + 1)-bit signed integer.
+   @param[in]  x          value in [-1, 1]
+   @param[in]  fracBits   number of fractional bits, 15 or 31
+   @return     the fixed-point value
+*/
+int32_t plp_fft_to_fixed(double x, uint32_t fracBits) {
+
+    double scale = (double)(1U << (fracBits - 1)) * 2.0;
+    double max = scale - 1.0;
+    double y = x * scale;
+
+    y = y < 0.0 ? -floor(-y + 0.5) : floor(y + 0.5);
+    if (y > max) {
+        y = max;
+    } else if (y < -scale) {
+        y = -scale;
+    }
+    return (int32_t)y;
+}
+
+/**
+   @brief      Generates the bit reversal table used by plp_bitreversal_16s_* and
+               plp_bitreversal_32s_*. For every index i with i < bitrev(i), the table contains the
+               pair (8 * i, 8 * bitrev(i)), in increasing order of i.
+   @param[in]  N        length of the FFT, power of two, at most 8192
+   @param[out] pTable   points to the table, of plp_fft_bitrev_table_length(N) values
+   @return     none
+*/
+void plp_fft_bitrev_table(uint32_t N, uint16_t *pTable) {
+
+    uint32_t log2N = 0;
+    uint32_t i, j, b, n = 0;
+
+    while ((1U << log2N) < N) {
+        log2N++;
+    }
+
+    for (i = 0; i < N; i++) {
+        j = 0;
+        for (b = 0; b < log2N; b++) {
+            j |= ((i >> b) & 0x1U) << (log2N - 1 - b);
+        }
+        if (i < j) {
+            pTable[n++] = (uint16_t)(8 * i);
+            pTable[n++] = (uint16_t)(8 * j);
+        }
+    }
+}
+
+/**
+   @brief      Length of the bit reversal table of an N-point FFT: the indices which are not
+               palindromes in binary representation.
+   @param[in]  N     length of the FFT, power of two
+   @return     number of entries of the table
+*/
+uint32_t plp_fft_bitrev_table_length(uint32_t N) {
+
+    uint32_t log2N = 0;
+
+    while ((1U << log2N) < N) {
+        log2N++;
+    }
+    return N - (1U << ((log2N + 1) / 2));
+}
+
+/**
+   @} end of fftPlan group
+*/
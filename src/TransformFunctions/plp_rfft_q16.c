@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rfft_q16.c
+ * Description:  16-bit fixed point FFT on real input data
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief      Glue code for the 16-bit fixed-point FFT on real input data.
+
+   The N real values are transformed with a complex FFT of length N/2, followed by a split pass.
+   The output contains the N/2 + 1 complex bins 0 .. N/2 in natural order, scaled by 1/N, i.e. the
+   output format is the same as for the complex FFT of length N:
+   Q1.15 -> Q(1+log2(N)).(15-log2(N)).
+
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N real values
+   @param[out]  pDst    points to the output buffer of N + 2 values (N/2 + 1 complex values). pDst
+                        may be equal to pSrc, if this buffer has a size of N + 2 values.
+   @return      none
+*/
+void plp_rfft_q16(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_rfft_q16s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_rfft_q16s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+   @} end of FFT group
+*/
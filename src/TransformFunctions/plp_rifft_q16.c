@@ -0,0 +1,65 @@
+/* =====================================================================
+ * Project:      PULP DSP Library
+ * Title:        plp_rifft_q16.c
+ * Description:  16-bit fixed point inverse FFT producing real output data
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V0
+ *
+ * Target Processor: PULP cores
+ * ===================================================================== */
+/*
+ * Copyright (C) 2026 ETH Zurich and University of Bologna.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plp_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+   @addtogroup fft
+   @{
+*/
+
+/**
+   @brief      Glue code for the 16-bit fixed-point inverse FFT producing real output data.
+
+   The N/2 + 1 complex bins 0 .. N/2 of a conjugate-symmetric spectrum are merged into N/2 complex
+   values, transformed with a complex FFT of length N/2 and returned as N real values. The
+   imaginary parts of the bins 0 and N/2 are ignored. The result is the inverse FFT including the
+   factor 1/N, with the same format as the input. Hence, applied to the output of plp_rfft_q16,
+   it returns the original signal scaled by 1/N, i.e. Q1.15 -> Q(1+log2(N)).(15-log2(N)).
+
+   @param[in]   S       points to an instance of the 16-bit real FFT structure
+   @param[in]   pSrc    points to the input buffer of N + 2 values (N/2 + 1 complex values)
+   @param[out]  pDst    points to the output buffer of N real values. pDst may be equal to pSrc.
+   @return      none
+*/
+void plp_rifft_q16(const plp_rfft_instance_q16 *S, const int16_t *pSrc, int16_t *pDst) {
+
+    if (hal_cluster_id() == ARCHI_FC_CID) {
+        plp_rifft_q16s_rv32im(S, pSrc, pDst);
+    } else {
+        plp_rifft_q16s_xpulpv2(S, pSrc, pDst);
+    }
+}
+
+/**
+   @} end of FFT group
+*/
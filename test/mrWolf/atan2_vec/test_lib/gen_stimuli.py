@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    y = inputs['pSrcY'].value.astype(np.float64)
+    x = inputs['pSrcX'].value.astype(np.float64)
+    if result_parameter.ctype in ('int32_t', 'int16_t'):
+        # angle / pi in Q1.31 or Q1.15
+        bits = 31 if result_parameter.ctype == 'int32_t' else 15
+        dtype = np.int32 if result_parameter.ctype == 'int32_t' else np.int16
+        result = np.round(np.arctan2(y, x) / np.pi * 2**bits)
+        return np.clip(result, -2**bits, 2**bits - 1).astype(dtype)
+    elif result_parameter.ctype == 'float':
+        return np.arctan2(y, x).astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x):
+    if x > 2**31 - 1:
+        return x - 2**32
+    elif x < -2**31:
+        return x + 2**32
+    else:
+        return x
+
+
+def q_add(a, b):
+    return q_sat(a + b)
+
+
+def q_sub(a, b):
+    return q_sat(a - b)
+
+
+def q_mul(a, b, p):
+    return q_roundnorm(a * b, p)
+
+
+def q_roundnorm(a, p):
+    rounding = 1 << (p - 1)
+    return q_sat((a + rounding) >> p)
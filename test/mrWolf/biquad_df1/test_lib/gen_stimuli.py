@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    bits = 16 if result_parameter.ctype == 'int16_t' else 32
+    coeffs = [int(c) for c in inputs['pCoeffs'].value]
+    if bits == 16:
+        # remove the zero after b0 of every stage
+        coeffs = [c for i, c in enumerate(coeffs) if i % 6 != 1]
+    state = [int(s) for s in inputs['pState'].value]
+    x = [int(v) for v in inputs['pSrc'].value]
+
+    # the parallel versions filter num_channels channels, each with its own state
+    num_channels = env.get('num_channels', 1)
+    len_state, len_block = env['len_state'], env['block_size']
+    y = []
+    for c in range(num_channels):
+        y += biquad_cascade(coeffs, state[c * len_state:(c + 1) * len_state],
+                            x[c * len_block:(c + 1) * len_block], env['num_stages'], fix_point,
+                            bits)
+
+    return np.array(y).astype(np.int16 if bits == 16 else np.int32)
+
+
+def biquad_cascade(coeffs, state, x, num_stages, fix_point, bits):
+    for s in range(num_stages):
+        b0, b1, b2, a1, a2 = coeffs[5 * s:5 * s + 5]
+        x1, x2, y1, y2 = state[4 * s:4 * s + 4]
+        y = []
+        for x0 in x:
+            acc = b0 * x0 + b1 * x1 + b2 * x2 + a1 * y1 + a2 * y2
+            y0 = q_sat(q_roundnorm(acc, fix_point), bits)
+            x1, x2, y1, y2 = x0, x1, y0, y1
+            y.append(y0)
+        x = y
+    return x
+
+######################
+# Fixpoint Functions #
+######################
+
+
+def q_sat(x, bits):
+    return min(max(x, -2**(bits - 1)), 2**(bits - 1) - 1)
+
+
+def q_roundnorm(a, p):
+    if p == 0:
+        return a
+    return (a + (1 << (p - 1))) >> p
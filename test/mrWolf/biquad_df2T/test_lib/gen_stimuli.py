@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    coeffs = inputs['pCoeffs'].value.astype(np.float64)
+    state = inputs['pState'].value.astype(np.float64)
+    x = inputs['pSrc'].value.astype(np.float64)
+
+    # the parallel version filters num_channels channels, each with its own state
+    num_channels = env.get('num_channels', 1)
+    len_state, len_block = env['len_state'], env['block_size']
+    y = [biquad_cascade(coeffs, state[c * len_state:(c + 1) * len_state],
+                        x[c * len_block:(c + 1) * len_block], env['num_stages'])
+         for c in range(num_channels)]
+
+    return np.concatenate(y).astype(np.float32)
+
+
+def biquad_cascade(coeffs, state, x, num_stages):
+    for s in range(num_stages):
+        b0, b1, b2, a1, a2 = coeffs[5 * s:5 * s + 5]
+        d1, d2 = state[2 * s:2 * s + 2]
+        y = np.zeros(len(x))
+        for n, x0 in enumerate(x):
+            y[n] = b0 * x0 + d1
+            d1 = b1 * x0 + a1 * y[n] + d2
+            d2 = b2 * x0 + a2 * y[n]
+        x = y
+    return x
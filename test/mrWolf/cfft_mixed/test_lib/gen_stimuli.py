@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    if "return_value" in result_parameter.name:
+        return 0 if is_supported(env['len_n']) else 1
+    elif result_parameter.general_name() == 'pTwiddle':
+        W = np.exp(-2j * np.pi * np.arange(env['len_n']) / env['len_n'])
+        return np.stack([W.real, W.imag], axis=1).astype(np.float32).reshape(env['len_cmplx'])
+    else:
+        x = inputs['pSrc'].value.astype(np.float64)
+        X = np.fft.fft(x[0::2] + 1j * x[1::2])
+        return np.stack([X.real, X.imag], axis=1).astype(np.float32).reshape(env['len_cmplx'])
+
+
+def is_supported(n):
+    """ True if n is of the form 2^a 3^b 5^c """
+    for p in [2, 3, 5]:
+        while n % p == 0:
+            n //= p
+    return n == 1
+
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    # The output of the Q1.31 FFT of length N is in the format Q(1+log2(N)).(31-log2(N)), i.e. the
+    # integer values are scaled down by N. With bitReverseFlag=1, the output is in natural order.
+    n = env['len_n']
+    x = inputs['p1'].value.astype(np.float64)
+    X = np.fft.fft(x[0::2] + 1j * x[1::2]) / n
+    return np.round(np.stack([X.real, X.imag], axis=1)).astype(np.int32).reshape(env['len_cmplx'])
+
+
+###########################
+# generate_stimuli_header #
+###########################
+
+
+if __name__ == "__main__":
+    import sys, os
+    sys.path.append(os.path.abspath(os.path.join(os.path.realpath(__file__), "../../../..")))
+    from pulp_dsp_test import generate_stimuli_header
+    generate_stimuli_header(compute_result)
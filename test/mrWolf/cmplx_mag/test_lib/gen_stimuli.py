@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 
+import math
 import numpy as np
 
 
@@ -54,7 +55,7 @@ def compute_result(result_parameter, inputs, env, fix_point):
     else:
         raise RuntimeError("Unrecognized result type: %s" % ctype)
 
-    if fix_point is None or fix_point == 0:
+    if fix_point is None:
         a = inputs['pSrc'].value.astype(my_type)
         cmplx_a = np.zeros(int(len(a)/2), dtype=np.csingle)
         for i in range(len(a)>>1):
@@ -65,12 +66,11 @@ def compute_result(result_parameter, inputs, env, fix_point):
                 result[i] = 0
         return result
 
-    a = inputs['pSrc'].value.astype(my_type)
-    cmplx_a = np.zeros(int(len(a)/2), dtype=np.csingle)
-    for i in range(len(a)>>1):
-        cmplx_a[i] = a[2*i].astype(np.csingle)/(2**(fix_point)) + (a[2*i + 1].astype(np.csingle)/(2**(fix_point)))*1j
-    # result = np.clip((np.absolute(cmplx_a)*(2**(fix_point))), np.iinfo(my_type).min, np.iinfo(my_type).max).astype(my_type)
-    result = (np.absolute(cmplx_a)*(2**fix_point)).astype(my_type)
+    # |z| * 2^fix_point = sqrt(re^2 + im^2), which is truncated and saturated like in the kernels
+    a = [int(x) for x in inputs['pSrc'].value]
+    result = [min(math.isqrt(a[2*i]**2 + a[2*i+1]**2), np.iinfo(my_type).max)
+              for i in range(len(a)>>1)]
+    result = np.array(result).astype(my_type)
     return result
 
 
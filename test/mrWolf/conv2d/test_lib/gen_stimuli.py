@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    if result_parameter.ctype == 'int32_t':
+        dtype = np.int64
+    elif result_parameter.ctype == 'float':
+        dtype = np.float32
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
+
+    x = inputs['pSrc'].value.astype(dtype).reshape((env['src_rows'], env['src_cols']))
+    h = inputs['pKernel'].value.astype(dtype).reshape((env['ker_rows'], env['ker_cols']))
+    dst_rows = env['src_rows'] - env['ker_rows'] + 1
+    dst_cols = env['src_cols'] - env['ker_cols'] + 1
+
+    # valid 2D convolution, the kernel is flipped in both dimensions
+    result = np.zeros((dst_rows, dst_cols), dtype=dtype)
+    for m in range(env['ker_rows']):
+        for n in range(env['ker_cols']):
+            result += x[m:m + dst_rows, n:n + dst_cols] * h[env['ker_rows'] - 1 - m,
+                                                              env['ker_cols'] - 1 - n]
+
+    # the integer kernels accumulate in 32 bits and wrap around
+    return result.reshape((env['len_dst'], )).astype(np.int32 if dtype == np.int64 else dtype)
@@ -19,40 +19,24 @@ def compute_result(result_parameter, inputs, env, fix_point):
     env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
     fix_point: None (if no fixpoint is used) or decimal point
     """
-    if result_parameter.ctype == 'int32_t':
-        a = inputs['srcA'].value.astype(np.int32)
-        b = inputs['srcB'].value.astype(np.int32)
-        if fix_point is None:
-            return np.correlate(a, b, mode='full')
-        else:
-            c = np.correlate(a, b, mode='full')
-            c = c/2**fix_point
-            return c.astype(np.int32)
-    elif result_parameter.ctype == 'int16_t':
-      a = inputs['srcA'].value.astype(np.int16)
-      b = inputs['srcB'].value.astype(np.int16)
-      if fix_point is None:
-          return np.correlate(a, b, mode='full')
-      else:
-          c = np.correlate(a, b, mode='full')
-          c = c/2**fix_point
-          return c.astype(np.int16)
-
-    elif result_parameter.ctype == 'int8_t':
-      a = inputs['srcA'].value.astype(np.int8)
-      b = inputs['srcB'].value.astype(np.int8)
-      if fix_point is None:
-          return np.correlate(a, b, mode='full')
-      else:
-          c = np.correlate(a, b, mode='full')
-          c = c/2**fix_point
-          return c.astype(np.int8)
-
-    elif result_parameter.ctype == 'float':
-        raise RuntimeError("Float not implemented")
-    else:
+    if result_parameter.ctype != 'int32_t':
         raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
 
+    a = inputs['srcA'].value.astype(np.int64)
+    b = inputs['srcB'].value.astype(np.int64)
+    if fix_point is None:
+        return np.correlate(a, b, mode='full').astype(np.int32)
+
+    # the fixed point versions round every product to fix_point fractional bits before summing
+    len_a, len_b = len(a), len(b)
+    c = np.zeros(len_a + len_b - 1, dtype=np.int64)
+    for k in range(len(c)):
+        lag = k - (len_b - 1)
+        n = np.arange(max(0, -lag), min(len_b, len_a - lag))
+        p = a[n + lag] * b[n]
+        c[k] = np.sum(((p >> (fix_point - 1)) + 1) >> 1)
+    return c.astype(np.int32)
+
 
 ######################
 # Fixpoint Functions #
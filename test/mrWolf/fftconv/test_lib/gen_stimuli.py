@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    a = inputs['srcA'].value.astype(np.float64)
+    b = inputs['srcB'].value.astype(np.float64)
+    c = np.convolve(a, b, mode='full')
+    if result_parameter.ctype == 'int32_t':
+        c = np.round(c / 2**fix_point)
+        return c.astype(np.int32)
+    elif result_parameter.ctype == 'float':
+        return c.astype(np.float32)
+    else:
+        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
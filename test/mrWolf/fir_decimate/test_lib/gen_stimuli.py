@@ -0,0 +1,40 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    num_taps = env['num_taps']
+    decimation = env['decimation']
+    # the coefficients are stored in time-reversed order, the delay line holds the last
+    # num_taps - 1 samples of the previous block. Only every decimation-th output is computed.
+    c = inputs['pCoeffs'].value.astype(np.float64)
+    x = np.concatenate([inputs['pState'].value[:num_taps - 1], inputs['pSrc'].value])
+    x = x.astype(np.float64)
+    y = np.array([np.dot(c, x[m * decimation:m * decimation + num_taps])
+                  for m in range(env['len_out'])])
+
+    if result_parameter.ctype == 'float':
+        return y.astype(np.float32)
+    if fix_point is None:
+        return y.astype(np.int64).astype(np.int32)
+
+    y = np.floor(y / 2**fix_point + 0.5)
+    if result_parameter.ctype == 'int16_t':
+        return np.clip(y, -2**15, 2**15 - 1).astype(np.int16)
+    return np.clip(y, -2**31, 2**31 - 1).astype(np.int32)
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+##################
+# compute_result #
+##################
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.dtype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+    num_taps = env['num_taps']
+    y, e = lms(inputs['pCoeffs'].value, inputs['pState'].value[:num_taps - 1],
+        inputs['pSrc'].value, inputs['pRef'].value, env['mu'], fix_point,
+        result_parameter.ctype)
+    if result_parameter.general_name() == 'pOut':
+        return y
+    if result_parameter.general_name() == 'pErr':
+        return e
+    raise RuntimeError("Unrecognized result name: %s" % result_parameter.name)
+
+
+def sat(x, bits):
+    return max(-2**(bits - 1), min(2**(bits - 1) - 1, x))
+
+
+def round_norm(x, frac):
+    return (x + (1 << (frac - 1))) >> frac if frac > 0 else x
+
+
+def lms(coeffs, history, src, ref, mu, frac, ctype):
+    """
+    Runs the filter sample by sample, like the kernels. The coefficients are stored in
+    time-reversed order, the delay line holds the num_taps - 1 previous samples.
+    """
+    num_taps = len(coeffs)
+    if ctype == 'float':
+        f32 = np.float32
+        c = [f32(v) for v in coeffs]
+        s = [f32(v) for v in history] + [f32(v) for v in src]
+        mu = f32(mu)
+        y, e = [], []
+        for n in range(len(src)):
+            acc = f32(0)
+            for k in range(num_taps):
+                acc = f32(acc + c[k] * s[n + k])
+            y.append(acc)
+            e.append(f32(f32(ref[n]) - acc))
+            alpha = f32(mu * e[-1])
+            c = [f32(c[k] + alpha * s[n + k]) for k in range(num_taps)]
+        return np.array(y, dtype=np.float32), np.array(e, dtype=np.float32)
+
+    bits = 16 if ctype == 'int16_t' else 32
+    mu = int(round(mu * 2**frac))
+    c = [int(v) for v in coeffs]
+    s = [int(v) for v in history] + [int(v) for v in src]
+    y, e = [], []
+    for n in range(len(src)):
+        acc = sum(c[k] * s[n + k] for k in range(num_taps))
+        y.append(sat(round_norm(acc, frac), bits))
+        e.append(sat(int(ref[n]) - y[-1], bits))
+        alpha = sat(round_norm(mu * e[-1], frac), bits)
+        c = [sat(c[k] + round_norm(alpha * s[n + k], frac), bits) for k in range(num_taps)]
+    dtype = np.int16 if bits == 16 else np.int32
+    return np.array(y, dtype=dtype), np.array(e, dtype=dtype)
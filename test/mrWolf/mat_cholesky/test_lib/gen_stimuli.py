@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+import math
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    n = env['len_n']
+    A = inputs['pSrc'].value.reshape((n, n))
+
+    if "return_value" in result_parameter.name:
+        return 0
+
+    if inputs['pSrc'].ctype == 'float':
+        L = np.linalg.cholesky(A.astype(np.float64)).astype(np.float32)
+    else:
+        L = np.array(cholesky_q32([[int(x) for x in row] for row in A], fix_point), dtype=np.int32)
+    return L.reshape((env['len_mat'], ))
+
+
+def cholesky_q32(A, frac_bits):
+    """ bit-exact Cholesky decomposition in fix-point """
+    n = len(A)
+    L = [[0] * n for _ in range(n)]
+    for j in range(n):
+        acc = (A[j][j] << frac_bits) - sum(L[j][k] * L[j][k] for k in range(j))
+        L[j][j] = math.isqrt(acc)
+        for i in range(j + 1, n):
+            acc = (A[i][j] << frac_bits) - sum(L[i][k] * L[j][k] for k in range(j))
+            L[i][j] = div_trunc(acc, L[j][j])
+    return L
+
+
+def div_trunc(a, b):
+    """ integer division rounding towards zero, like in C """
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    n = env['len_n']
+    A = inputs['pSrc'].value.reshape((n, n))
+
+    if inputs['pSrc'].ctype == 'float':
+        lu, perm, ret = lu_f32(A.astype(np.float32))
+    else:
+        lu, perm, ret = lu_q32([[int(x) for x in row] for row in A], fix_point)
+
+    if "return_value" in result_parameter.name:
+        return ret
+    elif "pPerm" in result_parameter.name:
+        return np.array(perm, dtype=np.uint32)
+    else:
+        return np.array(lu).reshape((env['len_mat'], )).astype(A.dtype)
+
+
+def lu_f32(A):
+    """ LU decomposition with partial pivoting, with the same float32 operations as the kernel """
+    n = A.shape[0]
+    A = A.copy()
+    perm = list(range(n))
+    for k in range(n):
+        pivot = k + int(np.argmax(np.abs(A[k:, k])))
+        if A[pivot, k] == 0:
+            return A, perm, 1
+        A[[k, pivot]] = A[[pivot, k]]
+        perm[k], perm[pivot] = perm[pivot], perm[k]
+        pivot_inv = np.float32(1) / A[k, k]
+        for i in range(k + 1, n):
+            factor = A[i, k] * pivot_inv
+            A[i, k] = factor
+            A[i, k + 1:] -= factor * A[k, k + 1:]
+    return A, perm, 0
+
+
+def lu_q32(A, frac_bits):
+    """ bit-exact LU decomposition in fix-point """
+    n = len(A)
+    perm = list(range(n))
+    for k in range(n):
+        col = [abs(A[i][k]) for i in range(k, n)]
+        pivot = k + col.index(max(col))
+        if A[pivot][k] == 0:
+            return A, perm, 1
+        A[k], A[pivot] = A[pivot], A[k]
+        perm[k], perm[pivot] = perm[pivot], perm[k]
+        for i in range(k + 1, n):
+            factor = div_trunc(A[i][k] << frac_bits, A[k][k])
+            A[i][k] = factor
+            for j in range(k + 1, n):
+                A[i][j] -= (factor * A[k][j]) >> frac_bits
+    return A, perm, 0
+
+
+def div_trunc(a, b):
+    """ integer division rounding towards zero, like in C """
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    n = env['len_n']
+    k = env['len_k']
+    scale = 1 if fix_point is None else 2**fix_point
+    L = inputs['pL'].value.reshape((n, n)).astype(np.float64) / scale
+    B = inputs['pB'].value.reshape((n, k)).astype(np.float64) / scale
+
+    X = np.linalg.solve(L @ L.T, B)
+
+    if inputs['pL'].ctype == 'float':
+        return X.astype(np.float32).reshape((env['len_rhs'], ))
+    else:
+        return np.round(X * scale).astype(np.int32).reshape((env['len_rhs'], ))
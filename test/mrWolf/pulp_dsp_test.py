@@ -18,6 +18,22 @@ GENERATE_STIMULI = "gen_stimuli"
 # L2_MEM_SIZE_KB = 448
 TEST_MEM_SIZE_KB = 256
 
+# Makefile rules used when the tests are run on the host (PULP_RTOS=host), against the library built
+# with `make host` in the root directory of pulp-dsp.
+HOST_RULES = dedent(
+    """\
+    PULP_DSP_HOME ?= $(CURDIR)/../../../../..
+    HOST_CC ?= gcc
+    all:
+    \t$(HOST_CC) -DRTOS_HOST -I$(PULP_DSP_HOME)/include -O3 -g $(TFLAGS) \\
+    \t    $(PULP_APP_FC_SRCS) $(PULP_APP_CL_SRCS) -o $(PULP_APP) \\
+    \t    -L$(PULP_DSP_HOME)/lib/host -lplpdsp -lm -pthread
+    run:
+    \t./$(PULP_APP)
+    clean:
+    \trm -f $(PULP_APP)"""
+)
+
 
 class Variable(object):
     """Variable"""
@@ -133,6 +149,8 @@ class Argument(object):
             return np.int16
         if self.ctype == "int32_t":
             return np.int32
+        if self.ctype == "uint32_t":
+            return np.uint32
         if self.ctype == "float":
             return np.float32
         raise RuntimeError("Unknown type: %s" % self.ctype)
@@ -267,8 +285,8 @@ class ArrayArgument(Argument):
             return dedent(
                 """\
                 {l1_name} = hal_cl_l1_malloc(sizeof({ctype}) * {len});
-                hal_cl_dma_cmd((unsigned int){l2_name},
-                              (unsigned int){l1_name},
+                hal_cl_dma_cmd((uintptr_t){l2_name},
+                              (uintptr_t){l1_name},
                               sizeof({ctype}) * {len},
                               HAL_CL_DMA_DIR_EXT2LOC, 0, &copy);
                 hal_cl_dma_cmd_wait(&copy);
@@ -295,8 +313,9 @@ class ArrayArgument(Argument):
         dtype = self.get_dtype()
         if callable(self.value):
             self.value = call_dynamic_function(self.value, env, version, device)
-        if self.value == GENERATE_STIMULI:
-            self.value = call_dynamic_function(gen_stimuli, env, version, device, variable=self)
+        # self.value may already be an array here, so compare to GENERATE_STIMULI only if it is a str
+        if isinstance(self.value, str) and self.value == GENERATE_STIMULI:
+            self.value = call_dynamic_function(gen_stimuli, env, version, device, argument=self)
         if isinstance(self.value, str):
             self.value = env[self.value]
         if self.value is None or (isinstance(self.value, (tuple, list)) and len(self.value) == 2):
@@ -362,7 +381,8 @@ class OutputArgument(ArrayArgument):
                    env, version, device, var_type.
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
-        skip_check: Boolean, if True, the output is not checked.
+        skip_check: Boolean or function, if True, the output is not checked. The function can take
+                    the arguments: env, version, device, var_type.
         """
         super(OutputArgument, self).__init__(name, ctype, length, 0, use_l1, in_function)
         self.tolerance = tolerance
@@ -378,11 +398,13 @@ class OutputArgument(ArrayArgument):
         - Apply the version (var_type or ret_type)
         - Apply use_l1 flag
         - Interpret the length of the variable
-        - Apply the tolerance
+        - Apply the tolerance and the skip_check flag
         - Alter the name to contain the test id
         """
         if callable(self.tolerance):
             self.tolerance = call_dynamic_function(self.tolerance, env, version, device)
+        if callable(self.skip_check):
+            self.skip_check = call_dynamic_function(self.skip_check, env, version, device)
         return super(OutputArgument, self).apply(env, var_type, version, use_l1, idx, device)
 
     def check_str(self, target):
@@ -458,7 +480,8 @@ class InplaceArgument(OutputArgument):
                    as absolute.
         in_function: Boolean, if True, add this argument to the function signature. Set this to
                      False, and use CustomArgument to create struts.
-        skip_check: Boolean, if True, the output is not checked.
+        skip_check: Boolean or function, if True, the output is not checked. The function can take
+                    the arguments: env, version, device, var_type.
         """
         super(InplaceArgument, self).__init__(name, ctype, length, use_l1, tolerance, in_function,
                                               skip_check)
@@ -950,7 +973,7 @@ class AggregatedTest(object):
                 float f;
             } __u2f;
 
-            #define ABS(x) (x > 0 ? x : -x)
+            #define ABS(x) ((x) > 0 ? (x) : -(x))
 
             #endif//__PULP_DSP_TEST__COMMON_H__
             """
@@ -1065,10 +1088,14 @@ class AggregatedTest(object):
                 ifdef TFLAGS
                     PULP_CFLAGS += $(TFLAGS)
                 endif
+                ifeq '$(PULP_RTOS)'  'host'
+                {host_rules}
+                else
                 include $(PULP_SDK_HOME)/install/rules/pulp_rt.mk
                 PULP_CFLAGS += -D DATA=$(CONFIG_BUILD_DIR)$(BUILD_DIR_EXT)
+                endif
                 """
-            ))
+            ).format(host_rules=HOST_RULES))
 
     def generate_riscy_test_program(self, start, end):
         """ generate all files needed for the riscy test """
@@ -1090,6 +1117,8 @@ class AggregatedTest(object):
                     pi_cluster_open(&cluster_dev);
                     pi_cluster_send_task_to_cl(&cluster_dev, &cluster_task);
                     pi_cluster_close(&cluster_dev);
+                #elif defined(RTOS_HOST)
+                    hal_host_cluster_call(cluster_entry, NULL);
                 #else
                     rt_cluster_mount(1, 0, 0, NULL);
                     rt_cluster_call(NULL, 0, cluster_entry, NULL, NULL, 0, 0, 0, NULL);
@@ -1153,12 +1182,14 @@ class AggregatedTest(object):
                     ifeq '$(PULP_RTOS)'  'pmsis'
                     PULP_CFLAGS += -DRTOS_PMSIS
                     include $(RULES_DIR)/pmsis_rules.mk
+                    else ifeq '$(PULP_RTOS)'  'host'
+                    {host_rules}
                     else
                     include $(PULP_SDK_HOME)/install/rules/pulp_rt.mk
                     endif
                     PULP_CFLAGS += -D DATA=$(CONFIG_BUILD_DIR)$(BUILD_DIR_EXT)                        
                 """
-            ))
+            ).format(host_rules=HOST_RULES))
 
 
 def generate_test_program(_config, _output, test_obj, start, end):
@@ -1450,7 +1481,7 @@ def tolerance_check_str(acq, exp, tolerance, ctype, indent, target):
         # In case of float: add a tiny absolute offset of 0.0001
         return dedent(
             """\
-            {indent}float __tol = ABS({tol:E} * (float){exp} + 0.0001);
+            {indent}float __tol = ABS({tol:E} * (float){exp}) + 0.0001;
             {indent}if (!({acq} >= ({ty})({exp} - __tol) &&
             {indent}      {acq} <= ({ty})({exp} + __tol))) {{\
             """
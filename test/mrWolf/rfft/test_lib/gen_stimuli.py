@@ -3,11 +3,6 @@
 import numpy as np
 
 
-##################
-# compute_result #
-##################
-
-
 def compute_result(result_parameter, inputs, env, fix_point):
     """
     Funciton to generate the expected result of the testcase.
@@ -19,48 +14,13 @@ def compute_result(result_parameter, inputs, env, fix_point):
     env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
     fix_point: None (if no fixpoint is used) or decimal point
     """
-    if result_parameter.ctype == 'int32_t':
-        raise RuntimeError("Int not implemented")
-        
-        # if fix_point is None or fix_point == 0:
-            
-        # else:
-            
-    elif result_parameter.ctype == 'float':
-        a = inputs['pSrc'].value.astype(np.float32)
-        result = np.array(np.fft.rfft(a), dtype=np.float32)
-    else:
-        raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
-
-    return result
-
-
-######################
-# Fixpoint Functions #
-######################
-
-
-def q_sat(x):
-    if x > 2**31 - 1:
-        return x - 2**32
-    elif x < -2**31:
-        return x + 2**32
-    else:
-        return x
-
-
-def q_add(a, b):
-    return q_sat(a + b)
-
-
-def q_sub(a, b):
-    return q_sat(a - b)
-
-
-def q_mul(a, b, p):
-    return q_roundnorm(a * b, p)
 
+    x = inputs['pSrc'].value.astype(np.float64)
+    X = np.fft.rfft(x)
+    if result_parameter.ctype == 'float':
+        return np.stack([X.real, X.imag], axis=1).astype(np.float32).reshape(env['len_out'])
 
-def q_roundnorm(a, p):
-    rounding = 1 << (p - 1)
-    return q_sat((a + rounding) >> p)
+    # The fixed-point real FFT is scaled by 1/N, like the complex FFT of length N
+    X = np.round(X / env['len_n'])
+    dtype = np.int16 if result_parameter.ctype == 'int16_t' else np.int32
+    return np.stack([X.real, X.imag], axis=1).astype(dtype).reshape(env['len_out'])
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+import numpy as np
+
+
+def compute_result(result_parameter, inputs, env, fix_point):
+    """
+    Funciton to generate the expected result of the testcase.
+
+    Arguments
+    ---------
+    result_parameter: Either OutputArgument or ReturnValue (see pulp_dsp_test.py)
+    inputs: Dict mapping name to the Argument, with arg.value, arg.ctype (and arg.length)
+    env: Dict mapping the variable (SweepVariable or DynamicVariable) names to their value.
+    fix_point: None (if no fixpoint is used) or decimal point
+    """
+
+    n = env['len_n']
+    Y = inputs['pSrc'].value.astype(np.float64).reshape(n // 2 + 1, 2)
+    Y = Y[:, 0] + 1j * Y[:, 1]
+    Y[0] = Y[0].real
+    Y[-1] = Y[-1].real
+
+    # The inverse includes the factor 1/N, the output has the same format as the input
+    x = np.fft.irfft(Y, n)
+    if result_parameter.ctype == 'float':
+        return x.astype(np.float32)
+
+    dtype = np.int16 if result_parameter.ctype == 'int16_t' else np.int32
+    return np.round(x).astype(dtype)
@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 
+import math
 import numpy as np
 
 
@@ -30,8 +31,8 @@ def compute_result(result_parameter, inputs, env, fix_point):
         else:
             if fix_point != 0:
                 for xa, xb in zip(p, p):
-                    accu = q_add(accu, (xa * xb) >> fix_point)
-        result[0] = accu/bS;
+                    accu = q_add(accu, (int(xa) * int(xb)) >> fix_point)
+        result[0] = q_rms(accu, bS, fix_point);
     elif result_parameter.ctype == 'int16_t':
         p = inputs['pSrc'].value.astype(np.int16)
         result = np.zeros(1, dtype=np.int16)
@@ -41,8 +42,8 @@ def compute_result(result_parameter, inputs, env, fix_point):
         else:
             if fix_point != 0:
                 for xa, xb in zip(p, p):
-                    accu = q_add(accu, (xa * xb) >> fix_point)
-        result[0] = accu/bS;                    
+                    accu = q_add(accu, (int(xa) * int(xb)) >> fix_point)
+        result[0] = min(q_rms(accu, bS, fix_point), 0x7FFF)
     elif result_parameter.ctype == 'int8_t':
         p = inputs['pSrc'].value.astype(np.int8)
         result = np.zeros(1, dtype=np.int8)
@@ -52,13 +53,12 @@ def compute_result(result_parameter, inputs, env, fix_point):
         else:
             if fix_point != 0:
                 for xa, xb in zip(p, p):
-                    accu = q_add(accu, (xa * xb) >> fix_point)
-        result[0] = accu/bS;                    
+                    accu = q_add(accu, (int(xa) * int(xb)) >> fix_point)
+        result[0] = min(q_rms(accu, bS, fix_point), 0x7F)
     elif result_parameter.ctype == 'float':
         p = inputs['pSrc'].value.astype(np.float32)
         result = np.zeros(1, dtype=np.float32)
-        result[0] = np.dot(p, p)
-        result[0] = result[0]/bS;
+        result[0] = np.sqrt(np.dot(p, p) / bS)
     else:
         raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
 
@@ -70,6 +70,13 @@ def compute_result(result_parameter, inputs, env, fix_point):
 ######################
 
 
+def q_rms(accu, bS, p):
+    """ square root of the mean square, with the same truncation as the fixed point kernels """
+    if p is None:
+        p = 0
+    return math.isqrt((int(accu) // bS) << p)
+
+
 def q_sat(x):
     if x > 2**31 - 1:
         return x - 2**32
@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 
+import math
 import numpy as np
 
 
@@ -22,36 +23,15 @@ def compute_result(result_parameter, inputs, env, fix_point):
     bS = inputs['blockSize'].value
     if(fix_point == None):
         fix_point = 0
-    if result_parameter.ctype == 'int32_t':
-        p = inputs['pSrc'].value.astype(np.int32)
-        result = np.zeros(1, dtype=np.int32)
-        for xa, xb in zip(p, p):
-            result[0] = q_add(result[0], (xa * xb) >> fix_point)
-        sq_mean = (np.square(np.mean(p)))/(2**fix_point)
-        result[0] = q_add(result[0]/bS,-int(sq_mean))
-        result[0] = int(2**(fix_point)*np.sqrt(float(result[0])/2**(fix_point)))
-    elif result_parameter.ctype == 'int16_t':
-        p = inputs['pSrc'].value.astype(np.int16)
-        result = np.zeros(1, dtype=np.int16)
-        for xa, xb in zip(p, p):
-            result[0] = q_add(result[0], (xa * xb) >> fix_point)
-        sq_mean = (np.square(np.mean(p)))/(2**fix_point)
-        result[0] = q_add(result[0]/bS,-int(sq_mean))
-        result[0] = int(2**(fix_point)*np.sqrt(float(result[0])/2**(fix_point)))
-    elif result_parameter.ctype == 'int8_t':
-        p = inputs['pSrc'].value.astype(np.int8)
-        result = np.zeros(1, dtype=np.int8)
-        for xa, xb in zip(p, p):
-            result[0] = q_add(result[0], (xa * xb) >> fix_point)
-        sq_mean = (np.square(np.mean(p)))/(2**fix_point)
-        result[0] = q_add(result[0]/bS,-int(sq_mean))
-        result[0] = q_sat_8(int(2**(fix_point)*np.sqrt(float(result[0])/2**(fix_point))))
+    if result_parameter.ctype in ('int32_t', 'int16_t', 'int8_t'):
+        # exact variance, saturated like in plp_var_q32, then floor(sqrt(var * 2^fix_point))
+        var = q_var(inputs['pSrc'].value, bS, fix_point, 31)
+        result = np.array([math.isqrt(var << fix_point)],
+                          dtype=np.dtype(result_parameter.ctype[:-2]))
     elif result_parameter.ctype == 'float':
-        p = inputs['pSrc'].value.astype(np.float32)
+        p = inputs['pSrc'].value.astype(np.float32).astype(np.float64)
         result = np.zeros(1, dtype=np.float32)
-        result[0] = np.var(p)
-        result[0] = np.sqrt(result[0])
-        
+        result[0] = np.sqrt(np.var(p))
     else:
         raise RuntimeError("Unrecognized result type: %s" % result_parameter.ctype)
 
@@ -63,6 +43,14 @@ def compute_result(result_parameter, inputs, env, fix_point):
 ######################
 
 
+def q_var(x, n, p, bits):
+    """ exact variance floor((n * sum(x^2) - sum(x)^2) / (n^2 * 2^p)), saturated """
+    x = [int(v) for v in x]
+    s = sum(x)
+    ss = sum(v * v for v in x)
+    return min((n * ss - s * s) // (n * n * 2**p), 2**bits - 1)
+
+
 def q_sat(x):
     if x > 2**31 - 1:
         return x - 2**32
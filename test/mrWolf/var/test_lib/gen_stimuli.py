@@ -23,29 +23,13 @@ def compute_result(result_parameter, inputs, env, fix_point):
     if(fix_point == None):
         fix_point = 0
     if result_parameter.ctype == 'int32_t':
-        p = inputs['pSrc'].value.astype(np.int32)
-        result = np.zeros(1, dtype=np.int32)
-        for xa, xb in zip(p, p):
-            result[0] = q_add(result[0], (xa * xb) >> fix_point)
-        sq_mean = q_sat(np.square(np.mean(p)))
-        result[0] = q_add(result[0]/bS,-(int(sq_mean)>>fix_point))
+        result = np.array([q_var(inputs['pSrc'].value, bS, fix_point, 31)], dtype=np.int32)
     elif result_parameter.ctype == 'int16_t':
-        p = inputs['pSrc'].value.astype(np.int16)
-        result = np.zeros(1, dtype=np.int16)
-        for xa, xb in zip(p, p):
-            result[0] = q_add(result[0], (xa * xb) >> fix_point)
-        sq_mean = q_sat(np.square(np.mean(p)))
-        result[0] = q_add(result[0]/bS,-(int(sq_mean)>>fix_point))
+        result = np.array([q_var(inputs['pSrc'].value, bS, fix_point, 15)], dtype=np.int16)
     elif result_parameter.ctype == 'int8_t':
-        p = inputs['pSrc'].value.astype(np.int8)
-        result = np.zeros(1, dtype=np.int8)
-        for xa, xb in zip(p, p):
-            result[0] = q_add(result[0], (xa * xb) >> fix_point)
-        sq_mean = q_sat_8(np.square(np.mean(p)))
-        result[0] = q_sat_8(q_add(result[0]/bS,-(int(sq_mean)>>fix_point)))
-        #print(result)
+        result = np.array([q_var(inputs['pSrc'].value, bS, fix_point, 7)], dtype=np.int8)
     elif result_parameter.ctype == 'float':
-        p = inputs['pSrc'].value.astype(np.float32)
+        p = inputs['pSrc'].value.astype(np.float32).astype(np.float64)
         result = np.zeros(1, dtype=np.float32)
         result[0] = np.var(p)
     else:
@@ -59,6 +43,14 @@ def compute_result(result_parameter, inputs, env, fix_point):
 ######################
 
 
+def q_var(x, n, p, bits):
+    """ exact variance floor((n * sum(x^2) - sum(x)^2) / (n^2 * 2^p)), saturated """
+    x = [int(v) for v in x]
+    s = sum(x)
+    ss = sum(v * v for v in x)
+    return min((n * ss - s * s) // (n * n * 2**p), 2**bits - 1)
+
+
 def q_sat(x):
     if x > 2**31 - 1:
         return x - 2**32